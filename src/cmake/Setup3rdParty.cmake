@@ -19,11 +19,10 @@ set(CONDUIT_TPL_DLL_PATHS)
 # Threads support
 ################################
 if(UNIX AND NOT APPLE)
-    if(ENABLE_RELAY_WEBSERVER)
-        # on some linux platforms we need to explicitly link threading
-        # options.
-        find_package( Threads REQUIRED )
-    endif()
+    # on some linux platforms we need to explicitly link threading
+    # options (used by conduit's task execution policy and the
+    # relay web server)
+    find_package( Threads REQUIRED )
 endif()
 
 ################################
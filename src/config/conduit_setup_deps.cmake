@@ -26,13 +26,10 @@ endif()
 # Setup Threads
 ###############################################################################
 if(UNIX AND NOT APPLE)
-    # if built web server support, we depend on Threads::Threads
+    # conduit (task execution policy) depends on Threads::Threads
     # in our exported targets so we need to bootstrap that here
-    if(EXISTS ${_IMPORT_ROOT}/include/conduit/conduit_relay_web.hpp)
-
-        if(NOT TARGET Threads::Threads)
-            find_package( Threads REQUIRED )
-        endif()
+    if(NOT TARGET Threads::Threads)
+        find_package( Threads REQUIRED )
     endif()
 endif()
 
@@ -0,0 +1,627 @@
+// Copyright (c) Lawrence Livermore National Security, LLC and other Conduit
+// Project developers. See top-level LICENSE AND COPYRIGHT files for dates and
+// other details. No copyright assignment is required to contribute to Conduit.
+
+//-----------------------------------------------------------------------------
+///
+/// file: conduit_benchmark.cpp
+///
+/// Reports timings of conduit hot paths. These used to be printed by
+/// unit tests, the unit tests now only check correctness with small data.
+///
+/// usage: conduit_benchmark [--list] [benchmark ...]
+///
+/// With no arguments, all benchmarks are run.
+///
+//-----------------------------------------------------------------------------
+#include <cmath>
+#include <cstring>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <conduit.hpp>
+#include <conduit_execution.hpp>
+
+using namespace conduit;
+using conduit::utils::Timer;
+
+//-----------------------------------------------------------------------------
+// object child name lookups, scanning child names vs the schema hash index
+//-----------------------------------------------------------------------------
+void
+benchmark_object_index_lookup()
+{
+    index_t orig_threshold = Schema::object_index_threshold();
+
+    index_t num_children_cases[3] = {10, 100, 1000};
+    index_t num_lookups = 1000000;
+
+    for(int c=0; c < 3; c++)
+    {
+        index_t num_children = num_children_cases[c];
+        std::vector<std::string> names;
+        for(index_t i=0; i < num_children; i++)
+        {
+            std::ostringstream oss;
+            oss << "field_" << i;
+            names.push_back(oss.str());
+        }
+
+        float timings[2];
+        for(int use_index=0; use_index < 2; use_index++)
+        {
+            // threshold of 0 disables the hash index, lookups scan
+            Schema::set_object_index_threshold(use_index ? 1 : 0);
+
+            Schema s;
+            for(index_t i=0; i < num_children; i++)
+            {
+                s.add_child(names[(size_t)i]);
+            }
+
+            index_t sum = 0;
+            Timer t;
+            for(index_t i=0; i < num_lookups; i++)
+            {
+                sum += s.child_index(names[(size_t)(i % num_children)]);
+            }
+            timings[use_index] = t.elapsed();
+
+            // sanity check the lookups
+            index_t num_full = num_lookups / num_children;
+            index_t rem = num_lookups % num_children;
+            index_t expected = num_full * (num_children * (num_children - 1) / 2)
+                               + rem * (rem - 1) / 2;
+            if(sum != expected)
+            {
+                std::cout << "unexpected lookup results" << std::endl;
+            }
+        }
+
+        std::cout << "children: " << num_children
+                  << " lookups: " << num_lookups
+                  << " scan: " << timings[0]
+                  << " hash index: " << timings[1]
+                  << std::endl;
+    }
+
+    Schema::set_object_index_threshold(orig_threshold);
+}
+
+//-----------------------------------------------------------------------------
+// chunked reductions and scans, serial vs the task pool
+//-----------------------------------------------------------------------------
+void
+benchmark_task()
+{
+    index_t n = 1 << 22;
+    std::vector<float64> vals(n);
+    for(index_t i = 0; i < n; i++)
+        vals[i] = (float64)(i % 1000);
+
+    auto chunk_sum = [&](index_t b, index_t e)
+    {
+        float64 s = 0.0;
+        for(index_t i = b; i < e; i++)
+            s += vals[i];
+        return s;
+    };
+    auto plus = [](float64 lhs, float64 rhs) { return lhs + rhs; };
+
+    Timer t_serial;
+    float64 serial_sum =
+        execution::reduce_chunks<execution::SerialExec>(
+            0, n, 0.0, chunk_sum, plus);
+    float t_serial_elapsed = t_serial.elapsed();
+
+    execution::task::set_number_of_threads(4);
+    Timer t_task;
+    float64 task_sum =
+        execution::reduce_chunks<execution::TaskExec>(
+            0, n, 0.0, chunk_sum, plus);
+    float t_task_elapsed = t_task.elapsed();
+
+    std::vector<index_t> offsets(n);
+    Timer t_scan_serial;
+    execution::exclusive_scan<execution::SerialExec>(
+        vals, offsets, n, (index_t)0);
+    float t_scan_serial_elapsed = t_scan_serial.elapsed();
+
+    Timer t_scan_task;
+    execution::exclusive_scan<execution::TaskExec>(
+        vals, offsets, n, (index_t)0);
+    float t_scan_task_elapsed = t_scan_task.elapsed();
+    execution::task::set_number_of_threads(1);
+
+    if(serial_sum != task_sum)
+    {
+        std::cout << "unexpected reduce results" << std::endl;
+    }
+
+    std::cout << "reduce serial:      " << t_serial_elapsed << " s" << std::endl;
+    std::cout << "reduce task (4 th): " << t_task_elapsed   << " s" << std::endl;
+    std::cout << "scan serial:        " << t_scan_serial_elapsed << " s" << std::endl;
+    std::cout << "scan task (4 th):   " << t_scan_task_elapsed   << " s" << std::endl;
+}
+
+//-----------------------------------------------------------------------------
+// DataArray min, minmax and sum
+//-----------------------------------------------------------------------------
+void
+benchmark_summary_stats()
+{
+    index_t num_vals = 1 << 22;
+    Node n;
+    n.set(DataType::float64(num_vals));
+    float64_array vals = n.value();
+    for(index_t i=0; i < num_vals; i++)
+    {
+        vals[i] = (float64)(i % 1000) - 500.0;
+    }
+
+    Timer t_min;
+    float64 v_min = vals.min();
+    float t_min_elapsed = t_min.elapsed();
+
+    Timer t_minmax;
+    float64 mm_min, mm_max;
+    vals.minmax(mm_min,mm_max);
+    float t_minmax_elapsed = t_minmax.elapsed();
+
+    Timer t_sum;
+    float64 v_sum = vals.sum();
+    float t_sum_elapsed = t_sum.elapsed();
+
+    std::cout << "min:    " << t_min_elapsed    << " s"
+              << " (" << v_min << ")" << std::endl;
+    std::cout << "minmax: " << t_minmax_elapsed << " s"
+              << " (" << mm_min << ", " << mm_max << ")" << std::endl;
+    std::cout << "sum:    " << t_sum_elapsed    << " s"
+              << " (" << v_sum << ")" << std::endl;
+}
+
+//-----------------------------------------------------------------------------
+// converting DataArray::set() and Node::to_data_type()
+//-----------------------------------------------------------------------------
+void
+benchmark_set_converting()
+{
+    index_t num_vals = 1 << 22;
+    Node n_src;
+    n_src.set(DataType::int32(num_vals));
+    int32_array src = n_src.value();
+    for(index_t i=0; i < num_vals; i++)
+    {
+        src[i] = (int32) i;
+    }
+
+    Node n_dest;
+    n_dest.set(DataType::int64(num_vals));
+    int64_array dest = n_dest.value();
+
+    Timer t_set;
+    dest.set(src);
+    float t_set_elapsed = t_set.elapsed();
+
+    Timer t_to_dtype;
+    Node n_res;
+    n_src.to_data_type(DataType::FLOAT64_ID,n_res);
+    float t_to_dtype_elapsed = t_to_dtype.elapsed();
+
+    std::cout << "set int32 -> int64:        "
+              << t_set_elapsed << " s" << std::endl;
+    std::cout << "to_data_type int32 -> f64: "
+              << t_to_dtype_elapsed << " s" << std::endl;
+}
+
+//-----------------------------------------------------------------------------
+// DataAccessor element access vs DataAccessor::visit()
+//-----------------------------------------------------------------------------
+void
+benchmark_visit()
+{
+    index_t num_vals = 1 << 22;
+    Node n;
+    n.set(DataType::int32(num_vals));
+    int32_array arr = n.value();
+    for(index_t i=0; i < num_vals; i++)
+    {
+        arr[i] = (int32)(i % 8);
+    }
+
+    index_t_accessor acc = n.value();
+
+    Timer t_element;
+    index_t res_element = 0;
+    for(index_t i=0; i < acc.number_of_elements(); i++)
+    {
+        res_element += acc[i];
+    }
+    float t_element_elapsed = t_element.elapsed();
+
+    Timer t_visit;
+    index_t res_visit = acc.visit([](const auto &vals)
+    {
+        index_t res = 0;
+        for(index_t i = 0; i < vals.number_of_elements(); i++)
+        {
+            res += vals[i];
+        }
+        return res;
+    });
+    float t_visit_elapsed = t_visit.elapsed();
+
+    if(res_element != res_visit)
+    {
+        std::cout << "unexpected visit results" << std::endl;
+    }
+
+    std::cout << "element loop: " << t_element_elapsed << " s" << std::endl;
+    std::cout << "visit:        " << t_visit_elapsed   << " s" << std::endl;
+}
+
+//-----------------------------------------------------------------------------
+// Node::compact_to() vs Node::compact_to_arena() for trees of small leaves
+//-----------------------------------------------------------------------------
+void
+benchmark_compact_to_arena()
+{
+    Node n;
+    for(int d=0; d < 10; d++)
+    {
+        std::ostringstream oss;
+        oss << "domain_" << d << "/fields/";
+        for(int f=0; f < 250; f++)
+        {
+            std::ostringstream f_oss;
+            f_oss << oss.str() << "f" << f;
+            Node &fld = n[f_oss.str()];
+            fld["association"] = "element";
+            fld["topology"]    = "mesh";
+            fld["values"].set(DataType::float64(8));
+        }
+    }
+
+    Node n_res;
+
+    Timer t_compact;
+    n.compact_to(n_res);
+    float t_compact_elapsed = t_compact.elapsed();
+
+    n_res.reset();
+    Timer t_arena;
+    n.compact_to_arena(n_res);
+    float t_arena_elapsed = t_arena.elapsed();
+
+    std::cout << "compact_to: "       << t_compact_elapsed << " s" << std::endl;
+    std::cout << "compact_to_arena: " << t_arena_elapsed   << " s" << std::endl;
+}
+
+//-----------------------------------------------------------------------------
+// Schema::equals() rejecting on a fingerprint mismatch vs the full walk
+//-----------------------------------------------------------------------------
+void
+benchmark_fingerprint_equals()
+{
+    Schema s;
+    for(index_t i = 0; i < 1000; i++)
+    {
+        std::ostringstream oss;
+        oss << "field_" << i;
+        s[oss.str() + "/values"].set(DataType::float64(100));
+        s[oss.str() + "/ids"].set(DataType::int32(100));
+    }
+    Schema s_copy(s);
+    // differs in the last leaf, so the walk has to visit everything
+    Schema s_diff(s);
+    s_diff["field_999/ids"].set(DataType::int32(99));
+
+    const index_t num_checks = 100;
+    bool ok = true;
+
+    // seed the cached fingerprints
+    s.fingerprint();
+    s_copy.fingerprint();
+    s_diff.fingerprint();
+
+    Timer t_fp;
+    for(index_t i = 0; i < num_checks; i++)
+    {
+        ok = ok && !s.equals(s_diff);
+    }
+    float64 fp_time = t_fp.elapsed();
+
+    // matching fingerprints still walk the tree
+    Timer t_walk;
+    for(index_t i = 0; i < num_checks; i++)
+    {
+        ok = ok && s.equals(s_copy);
+    }
+    float64 walk_time = t_walk.elapsed();
+
+    if(!ok)
+    {
+        std::cout << "unexpected equals results" << std::endl;
+    }
+
+    std::cout << "equals checks: " << num_checks
+              << " fingerprint reject: " << fp_time
+              << " full walk: " << walk_time
+              << std::endl;
+}
+
+//-----------------------------------------------------------------------------
+// generating and parsing json vs binary schemas
+//-----------------------------------------------------------------------------
+void
+benchmark_binary_vs_json_schema()
+{
+    // mesh like schema with ~20k leaves
+    Schema s;
+    for(index_t d = 0; d < 1000; d++)
+    {
+        std::ostringstream oss;
+        oss << "domain_" << d;
+        Schema &dom = s[oss.str()];
+        dom["coordsets/coords/type"].set(DataType::char8_str(9));
+        dom["coordsets/coords/values/x"].set(DataType::float64(100));
+        dom["coordsets/coords/values/y"].set(DataType::float64(100));
+        dom["coordsets/coords/values/z"].set(DataType::float64(100));
+        dom["topologies/mesh/type"].set(DataType::char8_str(13));
+        dom["topologies/mesh/coordset"].set(DataType::char8_str(7));
+        dom["topologies/mesh/elements/shape"].set(DataType::char8_str(4));
+        dom["topologies/mesh/elements/connectivity"].set(DataType::int32(400));
+        for(index_t f = 0; f < 12; f++)
+        {
+            std::ostringstream f_oss;
+            f_oss << "fields/field_" << f;
+            dom[f_oss.str() + "/values"].set(DataType::float64(100));
+        }
+    }
+    Schema s_compact;
+    s.compact_to(s_compact);
+
+    Timer t_json_gen;
+    std::string json = s_compact.to_json();
+    float64 json_gen_time = t_json_gen.elapsed();
+
+    Timer t_json_parse;
+    Schema s_json(json);
+    float64 json_parse_time = t_json_parse.elapsed();
+
+    Timer t_bin_gen;
+    std::vector<uint8> bin;
+    s_compact.to_binary(bin);
+    float64 bin_gen_time = t_bin_gen.elapsed();
+
+    Timer t_bin_parse;
+    Schema s_bin;
+    s_bin.from_binary(bin);
+    float64 bin_parse_time = t_bin_parse.elapsed();
+
+    std::cout << "json bytes: " << json.size()
+              << " gen: " << json_gen_time
+              << " parse: " << json_parse_time << std::endl
+              << "binary bytes: " << bin.size()
+              << " gen: " << bin_gen_time
+              << " parse: " << bin_parse_time << std::endl;
+}
+
+//-----------------------------------------------------------------------------
+// json and yaml number emission throughput
+//-----------------------------------------------------------------------------
+void
+benchmark_number_emission()
+{
+    const index_t nele = 1000000;
+    Node n;
+    n["int64"].set(DataType::int64(nele));
+    n["float32"].set(DataType::float32(nele));
+    n["float64"].set(DataType::float64(nele));
+
+    int64   *i64_ptr = n["int64"].value();
+    float32 *f32_ptr = n["float32"].value();
+    float64 *f64_ptr = n["float64"].value();
+    for(index_t i = 0; i < nele; i++)
+    {
+        i64_ptr[i] = i * 7919 - nele;
+        f32_ptr[i] = (float32)(i * 0.1);
+        f64_ptr[i] = i * 1.0e-3 + 1.0 / (i + 1);
+    }
+
+    const char *names[3] = {"int64","float32","float64"};
+    for(int i = 0; i < 3; i++)
+    {
+        const Node &n_leaf = n[names[i]];
+        Timer t_json;
+        std::string json = n_leaf.to_json();
+        float64 json_time = t_json.elapsed();
+
+        Timer t_yaml;
+        std::string yaml = n_leaf.to_yaml();
+        float64 yaml_time = t_yaml.elapsed();
+
+        std::cout << names[i]
+                  << " json: " << json.size() / json_time / 1.0e6 << " MB/s"
+                  << " yaml: " << yaml.size() / yaml_time / 1.0e6 << " MB/s"
+                  << std::endl;
+    }
+}
+
+//-----------------------------------------------------------------------------
+// streaming json and yaml parsing vs building a document tree first
+//-----------------------------------------------------------------------------
+void
+benchmark_stream_parse()
+{
+    // large inline numeric arrays, where building a document tree first
+    // needs several times the size of the output
+    const index_t num_vals = 1000000;
+    Node n_src;
+    n_src["ints"].set(DataType::int64(num_vals));
+    n_src["floats"].set(DataType::float64(num_vals));
+    int64_array   ints   = n_src["ints"].value();
+    float64_array floats = n_src["floats"].value();
+    for(index_t i = 0; i < num_vals; i++)
+    {
+        ints[i]   = i * 7919 - num_vals;
+        floats[i] = std::sin((float64)i) * 1000.0;
+    }
+
+    const std::string protocols[] = {"json", "yaml"};
+    for(int p = 0; p < 2; p++)
+    {
+        const std::string &protocol = protocols[p];
+        std::string txt = protocol == "json" ? n_src.to_json()
+                                             : n_src.to_yaml();
+        float64 mb = txt.size() / (1024.0 * 1024.0);
+
+        Node n_stream;
+        Generator g_stream(txt,protocol);
+        Timer t_stream;
+        g_stream.walk(n_stream);
+        float64 stream_time = t_stream.elapsed();
+
+        Node n_dom;
+        Generator g_dom(txt,protocol);
+        g_dom.set_streaming(false);
+        Timer t_dom;
+        g_dom.walk(n_dom);
+        float64 dom_time = t_dom.elapsed();
+
+        std::cout << protocol << " parse of " << mb << " MB" << std::endl
+                  << "  document tree: " << dom_time << " s ("
+                  << mb / dom_time << " MB/s)" << std::endl
+                  << "  streaming:     " << stream_time << " s ("
+                  << mb / stream_time << " MB/s)" << std::endl;
+    }
+}
+
+//-----------------------------------------------------------------------------
+// base64 encode and decode throughput, with 1 and 4 task threads
+//-----------------------------------------------------------------------------
+void
+benchmark_base64()
+{
+    const index_t nbytes = 64 * (1 << 20);
+    std::vector<uint8> src((size_t)nbytes);
+    for(index_t i = 0; i < nbytes; i++)
+    {
+        src[(size_t)i] = (uint8)((i * 2654435761u) >> 13);
+    }
+
+    std::vector<char>  enc((size_t)utils::base64_encode_buffer_size(nbytes));
+    std::vector<uint8> dec((size_t)utils::base64_decode_buffer_size((index_t)enc.size()));
+    const index_t enc_len = ((nbytes + 2) / 3) * 4;
+    const float64 mb = nbytes / (1024.0 * 1024.0);
+
+    const index_t num_threads[] = {1, 4};
+    for(int t = 0; t < 2; t++)
+    {
+        execution::task::set_number_of_threads(num_threads[t]);
+
+        Timer enc_timer;
+        utils::base64_encode(src.data(),nbytes,enc.data());
+        float64 enc_time = enc_timer.elapsed();
+
+        Timer dec_timer;
+        utils::base64_decode(enc.data(),enc_len,dec.data());
+        float64 dec_time = dec_timer.elapsed();
+
+        std::cout << "base64 of " << mb << " MB, "
+                  << num_threads[t] << " task thread(s)" << std::endl
+                  << "  encode: " << mb / enc_time << " MB/s" << std::endl
+                  << "  decode: " << mb / dec_time << " MB/s" << std::endl;
+    }
+    execution::task::set_number_of_threads(1);
+}
+
+//-----------------------------------------------------------------------------
+struct Benchmark
+{
+    const char *name;
+    void      (*func)();
+};
+
+//-----------------------------------------------------------------------------
+const Benchmark benchmarks[] =
+{
+    {"object_index_lookup",    benchmark_object_index_lookup},
+    {"task",                   benchmark_task},
+    {"summary_stats",          benchmark_summary_stats},
+    {"set_converting",         benchmark_set_converting},
+    {"visit",                  benchmark_visit},
+    {"compact_to_arena",       benchmark_compact_to_arena},
+    {"fingerprint_equals", benchmark_fingerprint_equals},
+    {"binary_vs_json_schema",  benchmark_binary_vs_json_schema},
+    {"number_emission",        benchmark_number_emission},
+    {"stream_parse",           benchmark_stream_parse},
+    {"base64",                 benchmark_base64},
+};
+
+const int num_benchmarks = sizeof(benchmarks) / sizeof(benchmarks[0]);
+
+//-----------------------------------------------------------------------------
+void
+usage()
+{
+    std::cout << "usage: conduit_benchmark [--list] [benchmark ...]"
+              << std::endl << std::endl
+              << "runs all benchmarks if none are given, benchmarks:"
+              << std::endl;
+    for(int i=0; i < num_benchmarks; i++)
+    {
+        std::cout << "  " << benchmarks[i].name << std::endl;
+    }
+}
+
+//-----------------------------------------------------------------------------
+int
+main(int argc, char **argv)
+{
+    std::vector<const Benchmark*> to_run;
+
+    for(int a=1; a < argc; a++)
+    {
+        if(strcmp(argv[a],"--list") == 0 || strcmp(argv[a],"--help") == 0)
+        {
+            usage();
+            return 0;
+        }
+
+        const Benchmark *found = NULL;
+        for(int i=0; i < num_benchmarks && found == NULL; i++)
+        {
+            if(strcmp(argv[a],benchmarks[i].name) == 0)
+            {
+                found = &benchmarks[i];
+            }
+        }
+
+        if(found == NULL)
+        {
+            std::cout << "unknown benchmark: " << argv[a] << std::endl;
+            usage();
+            return 1;
+        }
+        to_run.push_back(found);
+    }
+
+    if(to_run.empty())
+    {
+        for(int i=0; i < num_benchmarks; i++)
+        {
+            to_run.push_back(&benchmarks[i]);
+        }
+    }
+
+    for(size_t i=0; i < to_run.size(); i++)
+    {
+        std::cout << "[" << to_run[i]->name << "]" << std::endl;
+        to_run[i]->func();
+    }
+
+    return 0;
+}
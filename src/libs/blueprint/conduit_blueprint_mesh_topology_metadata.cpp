@@ -65,7 +65,9 @@ using SerialExec = conduit::execution::SerialExec;
 #if defined(CONDUIT_USE_OPENMP)
 using ParallelExec = conduit::execution::OpenMPExec;
 #else
-using ParallelExec = conduit::execution::SerialExec;
+// runs serially unless threads or an executor are enabled via
+// conduit::execution::task
+using ParallelExec = conduit::execution::TaskExec;
 #endif
 
 //---------------------------------------------------------------------------
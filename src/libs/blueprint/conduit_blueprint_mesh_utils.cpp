@@ -421,17 +421,30 @@ find_domain_id(const Node &node)
     return domain_id;
 }
 
+//---------------------------------------------------------------------------
+// @brief Wrap slice ids with an accessor (no copies are made).
+inline index_t_accessor
+slice_ids_accessor(const std::vector<int> &ids)
+{
+    return index_t_accessor(ids.data(), DataType::c_int((index_t)ids.size()));
+}
+
+//---------------------------------------------------------------------------
+inline index_t_accessor
+slice_ids_accessor(const std::vector<conduit::index_t> &ids)
+{
+    return index_t_accessor(ids.data(), DataType::index_t((index_t)ids.size()));
+}
+
 //---------------------------------------------------------------------------
 // @brief Slice the n_src array using the indices stored in ids. We use the
-//        array classes for their [] operators that deal with interleaved
+//        array classes' gather method, which deals with interleaved
 //        and non-interleaved arrays.
 template <typename ArrayType, typename IndexType>
 inline void
 typed_slice_array(const ArrayType &src, const std::vector<IndexType> &ids, ArrayType &dest)
 {
-    size_t n = ids.size();
-    for(size_t i = 0; i < n; i++)
-        dest[i] = src[ids[i]];
+    dest.gather(src, slice_ids_accessor(ids));
 }
 
 //---------------------------------------------------------------------------
@@ -2351,6 +2364,12 @@ topology::unstructured::generate_offsets(const Node &topo,
                                          Node &dest_ele_offsets,
                                          Node &dest_subele_offsets)
 {
+#if defined(CONDUIT_USE_OPENMP)
+    using policy = conduit::execution::OpenMPExec;
+#else
+    using policy = conduit::execution::TaskExec;
+#endif
+
     const ShapeType topo_shape(topo);
     const DataType int_dtype = find_widest_dtype(topo, DEFAULT_INT_DTYPES);
     std::string key("elements/connectivity"), stream_key("elements/stream");
@@ -2504,26 +2523,25 @@ topology::unstructured::generate_offsets(const Node &topo,
             topo_conn.dtype().number_of_elements() / topo_shape.indices;
 
         Node shape_node(DataType::int64(num_topo_shapes));
-        int64_array shape_array = shape_node.as_int64_array();
-        for(index_t s = 0; s < num_topo_shapes; s++)
+        int64 *shape_ptr = shape_node.as_int64_ptr();
+        const int64 shape_indices = topo_shape.indices;
+        conduit::execution::for_all<policy>(0, num_topo_shapes, [&](index_t s)
         {
-            shape_array[s] = s * topo_shape.indices;
-        }
+            shape_ptr[s] = s * shape_indices;
+        });
         shape_node.to_data_type(int_dtype.id(), dest_ele_offsets);
     }
     else if(topo_shape.type == "polygonal")
     {
         const Node &topo_size = topo["elements/sizes"];
-        int64_accessor topo_sizes = topo_size.as_int64_accessor();
-        std::vector<int64> shape_array;
-        index_t i = 0;
-        index_t s = 0;
-        while(i < topo_size.dtype().number_of_elements())
+        std::vector<int64> shape_array(topo_size.dtype().number_of_elements());
+        dispatch_array(topo_size, [&](const auto &topo_sizes)
         {
-            shape_array.push_back(s);
-            s += topo_sizes[i];
-            i++;
-        }
+            conduit::execution::exclusive_scan<policy>(topo_sizes,
+                                                       shape_array,
+                                                       topo_sizes.number_of_elements(),
+                                                       (int64)0);
+        });
 
         Node shape_node;
         shape_node.set_external(shape_array);
@@ -2534,33 +2552,35 @@ topology::unstructured::generate_offsets(const Node &topo,
         // Construct any offsets that do not exist.
         if(!elem_offsets_exist)
         {
-            index_t_accessor topo_elem_size = topo["elements/sizes"].value();
-            index_t es_count = topo_elem_size.number_of_elements();
+            const Node &topo_elem_size = topo["elements/sizes"];
+            index_t es_count = topo_elem_size.dtype().number_of_elements();
 
             dest_ele_offsets.set(DataType::index_t(es_count));
-            index_t_array shape_array = dest_ele_offsets.value();
+            index_t *shape_ptr = dest_ele_offsets.value();
 
-            index_t es = 0;
-            for (index_t ei = 0; ei < es_count; ++ei)
+            dispatch_array(topo_elem_size, [&](const auto &sizes)
             {
-                shape_array[ei] = es;
-                es += topo_elem_size[ei];
-            }
+                conduit::execution::exclusive_scan<policy>(sizes,
+                                                           shape_ptr,
+                                                           es_count,
+                                                           (index_t)0);
+            });
         }
         if(!subelem_offsets_exist)
         {
-            index_t_accessor topo_subelem_size = topo["subelements/sizes"].value();
-            index_t ses_count = topo_subelem_size.number_of_elements();
+            const Node &topo_subelem_size = topo["subelements/sizes"];
+            index_t ses_count = topo_subelem_size.dtype().number_of_elements();
 
             dest_subele_offsets.set(DataType::index_t(ses_count));
-            index_t_array subshape_array = dest_subele_offsets.value();
+            index_t *subshape_ptr = dest_subele_offsets.value();
 
-            index_t ses = 0;
-            for (index_t ei = 0; ei < ses_count; ++ei)
+            dispatch_array(topo_subelem_size, [&](const auto &sizes)
             {
-                subshape_array[ei] = ses;
-                ses += topo_subelem_size[ei];
-            }
+                conduit::execution::exclusive_scan<policy>(sizes,
+                                                           subshape_ptr,
+                                                           ses_count,
+                                                           (index_t)0);
+            });
         }
     }
 }
@@ -3701,7 +3721,7 @@ PointQuery::acceleratedSearch(int ndims,
 #if defined(CONDUIT_USE_OPENMP)
     using policy = conduit::execution::OpenMPExec;
 #else
-    using policy = conduit::execution::SerialExec;
+    using policy = conduit::execution::TaskExec;
 #endif
 
     // Special case a few large searches where the types are the same.
@@ -3818,7 +3838,7 @@ PointQuery::normalSearch(int ndims,
 #if defined(CONDUIT_USE_OPENMP)
     using policy = conduit::execution::OpenMPExec;
 #else
-    using policy = conduit::execution::SerialExec;
+    using policy = conduit::execution::TaskExec;
 #endif
 
     // Back up to a brute force search
@@ -16,6 +16,7 @@
 //-----------------------------------------------------------------------------
 
 #include "conduit_node.h"
+#include "conduit_path.h"
 #include "conduit_datatype.h"
 #include "conduit_utils.h"
 
@@ -108,6 +108,48 @@ cpp_datatype_ref(const conduit_datatype *cdatatype)
     return *reinterpret_cast<const DataType*>(cdatatype);
 }
 
+//---------------------------------------------------------------------------//
+Path *
+cpp_path(conduit_path *cpath)
+{
+    return reinterpret_cast<Path*>(cpath);
+}
+
+//---------------------------------------------------------------------------//
+conduit_path *
+c_path(Path *path)
+{
+    return reinterpret_cast<conduit_path*>(path);
+}
+
+//---------------------------------------------------------------------------//
+const Path *
+cpp_path(const conduit_path *cpath)
+{
+    return reinterpret_cast<const Path*>(cpath);
+}
+
+//---------------------------------------------------------------------------//
+const conduit_path *
+c_path(const Path *path)
+{
+    return reinterpret_cast<const conduit_path*>(path);
+}
+
+//---------------------------------------------------------------------------//
+Path &
+cpp_path_ref(conduit_path *cpath)
+{
+    return *reinterpret_cast<Path*>(cpath);
+}
+
+//---------------------------------------------------------------------------//
+const Path &
+cpp_path_ref(const conduit_path *cpath)
+{
+    return *reinterpret_cast<const Path*>(cpath);
+}
+
 }
 //-----------------------------------------------------------------------------
 // -- end conduit:: --
@@ -0,0 +1,71 @@
+// Copyright (c) Lawrence Livermore National Security, LLC and other Conduit
+// Project developers. See top-level LICENSE AND COPYRIGHT files for dates and
+// other details. No copyright assignment is required to contribute to Conduit.
+
+//-----------------------------------------------------------------------------
+///
+/// file: conduit_path.h
+///
+//-----------------------------------------------------------------------------
+
+#ifndef CONDUIT_PATH_H
+#define CONDUIT_PATH_H
+
+#include <stdlib.h>
+#include <stddef.h>
+
+#include "conduit_bitwidth_style_types.h"
+#include "conduit_exports.h"
+#include "conduit_node.h"
+
+//-----------------------------------------------------------------------------
+// -- begin extern C
+//-----------------------------------------------------------------------------
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+//-----------------------------------------------------------------------------
+// -- typedef for conduit_path --
+//-----------------------------------------------------------------------------
+
+struct conduit_path_impl;
+typedef struct conduit_path_impl  conduit_path;
+
+//-----------------------------------------------------------------------------
+// -- conduit_path creation and destruction --
+//-----------------------------------------------------------------------------
+
+CONDUIT_API conduit_path *conduit_path_create(const char *path);
+CONDUIT_API void          conduit_path_destroy(conduit_path *cpath);
+
+//-----------------------------------------------------------------------------
+// -- conduit_path info --
+//-----------------------------------------------------------------------------
+CONDUIT_API conduit_index_t conduit_path_number_of_segments(const conduit_path *cpath);
+
+//-----------------------------------------------------------------------------
+// -- node access using a compiled path --
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+CONDUIT_API conduit_node *conduit_node_fetch_compiled_path(conduit_node *cnode,
+                                                           const conduit_path *cpath);
+
+//-----------------------------------------------------------------------------
+CONDUIT_API conduit_node *conduit_node_fetch_existing_compiled_path(conduit_node *cnode,
+                                                                    const conduit_path *cpath);
+
+//-----------------------------------------------------------------------------
+CONDUIT_API int conduit_node_has_compiled_path(const conduit_node *cnode,
+                                               const conduit_path *cpath);
+
+#ifdef __cplusplus
+}
+#endif
+//-----------------------------------------------------------------------------
+// -- end extern C
+//-----------------------------------------------------------------------------
+
+
+#endif
@@ -0,0 +1,76 @@
+// Copyright (c) Lawrence Livermore National Security, LLC and other Conduit
+// Project developers. See top-level LICENSE AND COPYRIGHT files for dates and
+// other details. No copyright assignment is required to contribute to Conduit.
+
+//-----------------------------------------------------------------------------
+///
+/// file: conduit_path_c.cpp
+///
+//-----------------------------------------------------------------------------
+#include "conduit_path.h"
+
+#include "conduit.hpp"
+#include "conduit_cpp_to_c.hpp"
+
+//-----------------------------------------------------------------------------
+// -- begin extern C
+//-----------------------------------------------------------------------------
+
+extern "C" {
+
+using namespace conduit;
+
+//-----------------------------------------------------------------------------
+// -- basic constructor and destruction -- 
+//-----------------------------------------------------------------------------
+
+//---------------------------------------------------------------------------//
+conduit_path *
+conduit_path_create(const char *path)
+{
+    return c_path(new Path(path));
+}
+
+//---------------------------------------------------------------------------//
+void
+conduit_path_destroy(conduit_path *cpath)
+{
+    delete cpp_path(cpath);
+}
+
+//---------------------------------------------------------------------------//
+conduit_index_t
+conduit_path_number_of_segments(const conduit_path *cpath)
+{
+    return cpp_path(cpath)->number_of_segments();
+}
+
+//-----------------------------------------------------------------------------
+conduit_node *
+conduit_node_fetch_compiled_path(conduit_node *cnode,
+                                 const conduit_path *cpath)
+{
+    return c_node(cpp_node(cnode)->fetch_ptr(cpp_path_ref(cpath)));
+}
+
+//-----------------------------------------------------------------------------
+conduit_node *
+conduit_node_fetch_existing_compiled_path(conduit_node *cnode,
+                                          const conduit_path *cpath)
+{
+    return c_node(&cpp_node(cnode)->fetch_existing(cpp_path_ref(cpath)));
+}
+
+//-----------------------------------------------------------------------------
+int
+conduit_node_has_compiled_path(const conduit_node *cnode,
+                               const conduit_path *cpath)
+{
+    return (int)cpp_node(cnode)->has_path(cpp_path_ref(cpath));
+}
+
+}
+//-----------------------------------------------------------------------------
+// -- end extern C
+//-----------------------------------------------------------------------------
+
@@ -22,10 +22,14 @@
 #include "conduit_data_type.hpp"
 #include "conduit_data_array.hpp"
 #include "conduit_schema.hpp"
+#include "conduit_arena.hpp"
+#include "conduit_path.hpp"
 #include "conduit_node.hpp"
 #include "conduit_generator.hpp"
 #include "conduit_utils.hpp"
+#include "conduit_instrumentation.hpp"
 #include "conduit_data_accessor.hpp"
+#include "conduit_array_view.hpp"
 
 #endif
 
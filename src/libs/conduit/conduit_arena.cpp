@@ -0,0 +1,222 @@
+// Copyright (c) Lawrence Livermore National Security, LLC and other Conduit
+// Project developers. See top-level LICENSE AND COPYRIGHT files for dates and
+// other details. No copyright assignment is required to contribute to Conduit.
+
+//-----------------------------------------------------------------------------
+///
+/// file: conduit_arena.cpp
+///
+//-----------------------------------------------------------------------------
+#include "conduit_arena.hpp"
+
+#include <cstdlib>
+
+#include "conduit_error.hpp"
+#include "conduit_node.hpp"
+
+//-----------------------------------------------------------------------------
+// -- begin conduit:: --
+//-----------------------------------------------------------------------------
+namespace conduit
+{
+
+//-----------------------------------------------------------------------------
+//
+// -- conduit::Arena public methods --
+//
+//-----------------------------------------------------------------------------
+
+//---------------------------------------------------------------------------//
+const size_t Arena::DEFAULT_SLAB_SIZE;
+const size_t Arena::ALIGNMENT;
+
+//---------------------------------------------------------------------------//
+Arena::Arena(size_t slab_size)
+: m_slabs(),
+  m_slab_idx(0),
+  m_offset(0),
+  m_slab_size(slab_size > 0 ? slab_size : DEFAULT_SLAB_SIZE),
+  m_num_allocs(0),
+  m_num_refs(0)
+{}
+
+//---------------------------------------------------------------------------//
+Arena::~Arena()
+{
+    for(size_t i=0; i < m_slabs.size(); i++)
+    {
+        std::free(m_slabs[i].data);
+    }
+}
+
+//---------------------------------------------------------------------------//
+void *
+Arena::allocate(size_t num_bytes)
+{
+    // round up so the next allocation stays aligned
+    num_bytes = aligned_bytes(num_bytes);
+
+    // bump into the current slab, or move on to the next existing slab
+    while(m_slab_idx < m_slabs.size())
+    {
+        Slab &slab = m_slabs[m_slab_idx];
+        if(m_offset + num_bytes <= slab.size)
+        {
+            void *res = slab.data + m_offset;
+            m_offset += num_bytes;
+            m_num_allocs++;
+            return res;
+        }
+        m_slab_idx++;
+        m_offset = 0;
+    }
+
+    // we need a new slab
+    // (malloc provides alignment suitable for any fundamental type)
+    Slab slab;
+    slab.size = num_bytes > m_slab_size ? num_bytes : m_slab_size;
+    slab.data = (char*)std::malloc(slab.size);
+    if(slab.data == NULL)
+    {
+        CONDUIT_ERROR("Arena failed to allocate slab of "
+                      << slab.size << " bytes");
+    }
+    m_slabs.push_back(slab);
+    m_slab_idx = m_slabs.size() - 1;
+    m_offset   = num_bytes;
+    m_num_allocs++;
+    return slab.data;
+}
+
+//---------------------------------------------------------------------------//
+void
+Arena::reserve(size_t num_bytes)
+{
+    num_bytes = aligned_bytes(num_bytes);
+
+    // check the current slab and any slabs we have not reached yet
+    size_t avail = 0;
+    for(size_t i = m_slab_idx; i < m_slabs.size(); i++)
+    {
+        size_t slab_avail = m_slabs[i].size - (i == m_slab_idx ? m_offset : 0);
+        if(slab_avail > avail)
+        {
+            avail = slab_avail;
+        }
+    }
+
+    if(avail >= num_bytes)
+    {
+        return;
+    }
+
+    Slab slab;
+    slab.size = num_bytes;
+    slab.data = (char*)std::malloc(slab.size);
+    if(slab.data == NULL)
+    {
+        CONDUIT_ERROR("Arena failed to allocate slab of "
+                      << slab.size << " bytes");
+    }
+
+    // place the new slab next in line, so the following allocations
+    // come from it
+    if(m_slab_idx < m_slabs.size() && m_offset > 0)
+    {
+        m_slab_idx++;
+    }
+    m_slabs.insert(m_slabs.begin() + m_slab_idx, slab);
+    m_offset = 0;
+}
+
+//---------------------------------------------------------------------------//
+void
+Arena::add_ref()
+{
+    m_num_refs.fetch_add(1);
+}
+
+//---------------------------------------------------------------------------//
+void
+Arena::deallocate(Arena *arena,
+                  void * /*ptr*/)
+{
+    // individual allocations are not recycled, the slabs are
+    // reused once everything has been returned.
+    arena->m_num_allocs--;
+    if(arena->m_num_allocs == 0)
+    {
+        if(arena->m_num_refs.load() == 0)
+        {
+            delete arena;
+        }
+        else
+        {
+            arena->m_slab_idx = 0;
+            arena->m_offset   = 0;
+        }
+    }
+}
+
+//---------------------------------------------------------------------------//
+void
+Arena::release(Arena *arena)
+{
+    if(arena == NULL)
+    {
+        return;
+    }
+
+    if(arena->m_num_refs.fetch_sub(1) == 1 && arena->m_num_allocs == 0)
+    {
+        delete arena;
+    }
+}
+
+//---------------------------------------------------------------------------//
+index_t
+Arena::total_bytes() const
+{
+    index_t res = 0;
+    for(size_t i=0; i < m_slabs.size(); i++)
+    {
+        res += (index_t)m_slabs[i].size;
+    }
+    return res;
+}
+
+//---------------------------------------------------------------------------//
+index_t
+Arena::used_bytes() const
+{
+    if(m_slabs.empty())
+    {
+        return 0;
+    }
+
+    // slabs we moved past count as used (including any slack)
+    index_t res = (index_t)m_offset;
+    for(size_t i=0; i < m_slab_idx && i < m_slabs.size(); i++)
+    {
+        res += (index_t)m_slabs[i].size;
+    }
+    return res;
+}
+
+//---------------------------------------------------------------------------//
+void
+Arena::info(Node &res) const
+{
+    res.reset();
+    res["slab_size"]             = (int64) m_slab_size;
+    res["number_of_slabs"]       = number_of_slabs();
+    res["total_bytes"]           = total_bytes();
+    res["used_bytes"]            = used_bytes();
+    res["number_of_allocations"] = number_of_allocations();
+    res["number_of_references"]  = number_of_references();
+}
+
+}
+//-----------------------------------------------------------------------------
+// -- end conduit:: --
+//-----------------------------------------------------------------------------
@@ -0,0 +1,141 @@
+// Copyright (c) Lawrence Livermore National Security, LLC and other Conduit
+// Project developers. See top-level LICENSE AND COPYRIGHT files for dates and
+// other details. No copyright assignment is required to contribute to Conduit.
+
+//-----------------------------------------------------------------------------
+///
+/// file: conduit_arena.hpp
+///
+//-----------------------------------------------------------------------------
+
+#ifndef CONDUIT_ARENA_HPP
+#define CONDUIT_ARENA_HPP
+
+//-----------------------------------------------------------------------------
+// -- standard lib includes --
+//-----------------------------------------------------------------------------
+#include <vector>
+#include <atomic>
+#include <cstddef>
+#include <new>
+
+//-----------------------------------------------------------------------------
+// -- conduit includes --
+//-----------------------------------------------------------------------------
+#include "conduit_core.hpp"
+
+//-----------------------------------------------------------------------------
+// -- begin conduit:: --
+//-----------------------------------------------------------------------------
+namespace conduit
+{
+
+class Node;
+
+//-----------------------------------------------------------------------------
+// -- begin conduit::Arena --
+//-----------------------------------------------------------------------------
+///
+/// class: conduit::Arena
+///
+/// description:
+///  A slab based bump allocator used to hold the Node and Schema objects
+///  that make up a tree's skeleton (see Node::enable_arena()).
+///
+///  Allocations are carved out of large slabs. Individual deallocations
+///  only update bookkeeping, once all allocations have been returned
+///  the arena rewinds and the existing slabs are reused for the next tree,
+///  so rebuilding a tree does not touch the heap.
+///
+///  Arenas are reference counted: every Node and Schema that creates
+///  objects from an arena holds a reference. The arena (and its slabs)
+///  are freed when there are no references and no live allocations.
+///
+///  Arenas are not thread safe, the intended use is one arena per root
+///  Node, with each thread building its own tree.
+///
+//-----------------------------------------------------------------------------
+class CONDUIT_API Arena
+{
+public:
+    /// default number of bytes in each slab
+    static const size_t DEFAULT_SLAB_SIZE = 65536;
+    /// alignment of all allocations
+    static const size_t ALIGNMENT = 16;
+
+    /// create an arena with no references
+    Arena(size_t slab_size = DEFAULT_SLAB_SIZE);
+    ~Arena();
+
+    /// returns a pointer to `num_bytes` bytes (aligned to ALIGNMENT)
+    void       *allocate(size_t num_bytes);
+
+    /// makes sure at least `num_bytes` bytes are available without
+    /// adding another slab, adds a slab of exactly `num_bytes` if needed
+    void        reserve(size_t num_bytes);
+
+    /// returns `num_bytes` rounded up to a multiple of ALIGNMENT
+    /// (the number of arena bytes used by an allocation of that size)
+    static size_t aligned_bytes(size_t num_bytes)
+                    { return (num_bytes + ALIGNMENT - 1) & ~(ALIGNMENT - 1);}
+
+    /// adds a reference to this arena
+    void        add_ref();
+
+    /// returns an allocation to the arena, rewinds the arena when
+    /// there are no live allocations and frees the arena if there
+    /// are also no references
+    static void deallocate(Arena *arena, void *ptr);
+    /// removes a reference, frees the arena if there are no references
+    /// and no live allocations. NULL is ignored
+    static void release(Arena *arena);
+
+    /// number of references
+    index_t     number_of_references() const
+                    { return m_num_refs.load();}
+    /// number of live allocations
+    index_t     number_of_allocations() const
+                    { return m_num_allocs;}
+    /// number of slabs
+    index_t     number_of_slabs() const
+                    { return (index_t)m_slabs.size();}
+    /// total number of bytes held in slabs
+    index_t     total_bytes() const;
+    /// number of slab bytes handed out since the last rewind
+    index_t     used_bytes() const;
+
+    /// summary of the arena's state
+    void        info(Node &res) const;
+
+private:
+    // arenas are shared via references, they are never copied
+    Arena(const Arena &);
+    Arena &operator=(const Arena &);
+
+    struct Slab
+    {
+        char   *data;
+        size_t  size;
+    };
+
+    std::vector<Slab>   m_slabs;
+    // slab used for the next allocation
+    size_t              m_slab_idx;
+    // bump offset into the current slab
+    size_t              m_offset;
+    size_t              m_slab_size;
+    index_t             m_num_allocs;
+    // references may be added and released from several threads
+    std::atomic<index_t> m_num_refs;
+};
+//-----------------------------------------------------------------------------
+// -- end conduit::Arena --
+//-----------------------------------------------------------------------------
+
+
+}
+//-----------------------------------------------------------------------------
+// -- end conduit:: --
+//-----------------------------------------------------------------------------
+
+#endif
@@ -0,0 +1,288 @@
+// Copyright (c) Lawrence Livermore National Security, LLC and other Conduit
+// Project developers. See top-level LICENSE AND COPYRIGHT files for dates and
+// other details. No copyright assignment is required to contribute to Conduit.
+
+//-----------------------------------------------------------------------------
+///
+/// file: conduit_array_view.hpp
+///
+//-----------------------------------------------------------------------------
+
+#ifndef CONDUIT_ARRAY_VIEW_HPP
+#define CONDUIT_ARRAY_VIEW_HPP
+
+//-----------------------------------------------------------------------------
+// -- standard lib includes --
+//-----------------------------------------------------------------------------
+#include <cstring>
+#include <type_traits>
+
+//-----------------------------------------------------------------------------
+// -- conduit includes --
+//-----------------------------------------------------------------------------
+#include "conduit_core.hpp"
+#include "conduit_data_type.hpp"
+#include "conduit_utils.hpp"
+
+//-----------------------------------------------------------------------------
+// -- begin conduit:: --
+//-----------------------------------------------------------------------------
+namespace conduit
+{
+
+//-----------------------------------------------------------------------------
+// -- begin conduit::ArrayView --
+//-----------------------------------------------------------------------------
+///
+/// class: conduit::ArrayView
+///
+/// description:
+///  Lightweight typed view of array data, handed to the functors passed to
+///  dispatch_array() and DataAccessor::visit().
+///
+///  T is the type of the underlying data (const qualified for read only
+///  views). When IsContiguous is true, elements are tightly packed and
+///  indexing compiles to a plain pointer access, otherwise elements are
+///  stride() bytes apart.
+///
+//-----------------------------------------------------------------------------
+template <typename T, bool IsContiguous>
+class ArrayView
+{
+public:
+    typedef T value_type;
+
+    static const bool is_contiguous = IsContiguous;
+
+    /// `data` points to the first element, stride is in bytes
+    ArrayView(T *data, index_t num_elements, index_t stride)
+    : m_data(data),
+      m_num_elements(num_elements),
+      m_stride(stride)
+    {}
+
+    T              &operator[](index_t idx) const
+                        { return element(idx);}
+
+    T              &element(index_t idx) const
+                        {
+                            return IsContiguous ? m_data[idx] :
+                                *reinterpret_cast<T*>(
+                                    reinterpret_cast<byte_type*>(m_data) +
+                                    m_stride * idx);
+                        }
+
+    /// pointer to the first element
+    T              *data_ptr() const
+                        { return m_data;}
+
+    index_t         number_of_elements() const
+                        { return m_num_elements;}
+
+    /// distance between elements in bytes
+    index_t         stride() const
+                        { return m_stride;}
+
+private:
+    typedef typename std::conditional<std::is_const<T>::value,
+                                      const char,
+                                      char>::type byte_type;
+
+    T       *m_data;
+    index_t  m_num_elements;
+    index_t  m_stride;
+};
+
+//---------------------------------------------------------------------------//
+template <typename T, bool IsContiguous>
+const bool ArrayView<T,IsContiguous>::is_contiguous;
+//-----------------------------------------------------------------------------
+// -- end conduit::ArrayView --
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+// -- begin conduit::detail --
+//-----------------------------------------------------------------------------
+namespace detail
+{
+
+//---------------------------------------------------------------------------//
+// picks the contiguous or strided view for the given leaf type
+//---------------------------------------------------------------------------//
+template <typename T, typename Ptr, typename Func>
+decltype(auto)
+dispatch_array_view(Ptr data,
+                    const DataType &dtype,
+                    Func &&func)
+{
+    typedef typename std::conditional<
+                std::is_const<typename std::remove_pointer<Ptr>::type>::value,
+                const T,
+                T>::type value_type;
+    typedef typename std::conditional<std::is_const<value_type>::value,
+                                      const char,
+                                      char>::type byte_type;
+
+    value_type *ptr = reinterpret_cast<value_type*>(
+                          reinterpret_cast<byte_type*>(data) +
+                          dtype.offset());
+
+    if(dtype.stride() == (index_t)sizeof(T))
+    {
+        return func(ArrayView<value_type,true>(ptr,
+                                               dtype.number_of_elements(),
+                                               dtype.stride()));
+    }
+
+    return func(ArrayView<value_type,false>(ptr,
+                                            dtype.number_of_elements(),
+                                            dtype.stride()));
+}
+
+//---------------------------------------------------------------------------//
+// bulk conversion kernels
+//
+// contiguous (src, dest) pairs use plain pointer loops (a memcpy for
+// matching types), which compilers vectorize for the common widening
+// and narrowing cases (int32 to int64, float32 to float64, etc)
+//---------------------------------------------------------------------------//
+template <typename D, typename S>
+inline void
+convert_elements(const S *src,
+                 D *dest,
+                 index_t num_elements)
+{
+    for(index_t i = 0; i < num_elements; i++)
+    {
+        dest[i] = (D) src[i];
+    }
+}
+
+//---------------------------------------------------------------------------//
+template <typename T>
+inline void
+convert_elements(const T *src,
+                 T *dest,
+                 index_t num_elements)
+{
+    if(num_elements > 0 && src != dest)
+    {
+        std::memcpy(dest, src, sizeof(T) * num_elements);
+    }
+}
+
+//---------------------------------------------------------------------------//
+// copies (and converts) the first num_elements values of src to dest
+//---------------------------------------------------------------------------//
+template <typename S, bool SrcContig, typename D, bool DestContig>
+inline void
+copy_elements(const ArrayView<S,SrcContig> &src,
+              const ArrayView<D,DestContig> &dest,
+              index_t num_elements)
+{
+    if(SrcContig && DestContig)
+    {
+        convert_elements(src.data_ptr(), dest.data_ptr(), num_elements);
+        return;
+    }
+
+    for(index_t i = 0; i < num_elements; i++)
+    {
+        dest[i] = (D) src[i];
+    }
+}
+
+//---------------------------------------------------------------------------//
+template <typename Ptr, typename Func>
+decltype(auto)
+dispatch_array(Ptr data,
+               const DataType &dtype,
+               Func &&func)
+{
+    switch(dtype.id())
+    {
+        // ints
+        case DataType::INT8_ID:
+            return dispatch_array_view<int8>(data,dtype,func);
+        case DataType::INT16_ID:
+            return dispatch_array_view<int16>(data,dtype,func);
+        case DataType::INT32_ID:
+            return dispatch_array_view<int32>(data,dtype,func);
+        case DataType::INT64_ID:
+            return dispatch_array_view<int64>(data,dtype,func);
+        // uints
+        case DataType::UINT8_ID:
+            return dispatch_array_view<uint8>(data,dtype,func);
+        case DataType::UINT16_ID:
+            return dispatch_array_view<uint16>(data,dtype,func);
+        case DataType::UINT32_ID:
+            return dispatch_array_view<uint32>(data,dtype,func);
+        case DataType::UINT64_ID:
+            return dispatch_array_view<uint64>(data,dtype,func);
+        // floats
+        case DataType::FLOAT32_ID:
+            return dispatch_array_view<float32>(data,dtype,func);
+        case DataType::FLOAT64_ID:
+            return dispatch_array_view<float64>(data,dtype,func);
+    }
+
+    // empty data is visited as an empty view
+    if(!dtype.is_empty())
+    {
+        CONDUIT_ERROR("dispatch_array does not support dtype: "
+                      << dtype.name());
+    }
+    return dispatch_array_view<float64>(data,
+                                        DataType::float64(0),
+                                        func);
+}
+
+}
+//-----------------------------------------------------------------------------
+// -- end conduit::detail --
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+///
+/// dispatch_array resolves the numeric type of array data once and calls
+/// `func` with an ArrayView of that type, for example:
+///
+///   index_t total = dispatch_array(data, dtype, [](const auto &view)
+///   {
+///       index_t res = 0;
+///       for(index_t i = 0; i < view.number_of_elements(); i++)
+///           res += (index_t) view[i];
+///       return res;
+///   });
+///
+/// `func` is instantiated for each numeric leaf type, with both contiguous
+/// and strided views, so it must return the same type in all cases.
+/// Empty dtypes are passed as an empty view, other non numeric dtypes
+/// are an error.
+///
+//-----------------------------------------------------------------------------
+template <typename Func>
+decltype(auto)
+dispatch_array(void *data,
+               const DataType &dtype,
+               Func &&func)
+{
+    return detail::dispatch_array(data,dtype,func);
+}
+
+//---------------------------------------------------------------------------//
+template <typename Func>
+decltype(auto)
+dispatch_array(const void *data,
+               const DataType &dtype,
+               Func &&func)
+{
+    return detail::dispatch_array(data,dtype,func);
+}
+
+}
+//-----------------------------------------------------------------------------
+// -- end conduit:: --
+//-----------------------------------------------------------------------------
+
+#endif
@@ -75,17 +75,19 @@ template <typename T>
 T
 DataAccessor<T>::min()  const
 {
-    T res = std::numeric_limits<T>::max();
-    for(index_t i = 0; i < number_of_elements(); i++)
+    return visit([](const auto &vals)
     {
-        const T &val = element(i);
-        if(val < res)
+        T res = std::numeric_limits<T>::max();
+        for(index_t i = 0; i < vals.number_of_elements(); i++)
         {
-            res = val;
+            const T val = (T) vals[i];
+            if(val < res)
+            {
+                res = val;
+            }
         }
-    }
-
-    return res;
+        return res;
+    });
 }
 
 //---------------------------------------------------------------------------// 
@@ -93,17 +95,19 @@ template <typename T>
 T
 DataAccessor<T>::max() const
 {
-    T res = std::numeric_limits<T>::lowest();
-    for(index_t i = 0; i < number_of_elements(); i++)
+    return visit([](const auto &vals)
     {
-        const T &val = element(i);
-        if(val > res)
+        T res = std::numeric_limits<T>::lowest();
+        for(index_t i = 0; i < vals.number_of_elements(); i++)
         {
-            res = val;
+            const T val = (T) vals[i];
+            if(val > res)
+            {
+                res = val;
+            }
         }
-    }
-
-    return res;
+        return res;
+    });
 }
 
 
@@ -112,14 +116,15 @@ template <typename T>
 T
 DataAccessor<T>::sum() const
 {
-    T res =0;
-    for(index_t i = 0; i < number_of_elements(); i++)
+    return visit([](const auto &vals)
     {
-        const T &val = element(i);
-        res += val;
-    }
-
-    return res;
+        T res = 0;
+        for(index_t i = 0; i < vals.number_of_elements(); i++)
+        {
+            res += (T) vals[i];
+        }
+        return res;
+    });
 }
 
 //---------------------------------------------------------------------------// 
@@ -127,12 +132,15 @@ template <typename T>
 float64
 DataAccessor<T>::mean() const
 {
-    float64 res =0;
-    for(index_t i = 0; i < number_of_elements(); i++)
+    float64 res = visit([](const auto &vals)
     {
-        const T &val = element(i);
-        res += val;
-    }
+        float64 res = 0;
+        for(index_t i = 0; i < vals.number_of_elements(); i++)
+        {
+            res += (T) vals[i];
+        }
+        return res;
+    });
 
     res = res / float64(number_of_elements());
     return res;
@@ -143,15 +151,18 @@ template <typename T>
 index_t
 DataAccessor<T>::count(T val) const
 {
-    index_t res= 0;
-    for(index_t i = 0; i < number_of_elements(); i++)
+    return visit([val](const auto &vals)
     {
-        if(element(i) == val)
+        index_t res = 0;
+        for(index_t i = 0; i < vals.number_of_elements(); i++)
         {
-            res++;
+            if((T) vals[i] == val)
+            {
+                res++;
+            }
         }
-    }
-    return res;
+        return res;
+    });
 }
 
 //---------------------------------------------------------------------------//
@@ -380,6 +391,36 @@ DataAccessor<T>::fill(T value)
 }
 
 
+//---------------------------------------------------------------------------//
+template <typename T>
+void
+DataAccessor<T>::fill(T *dest,
+                      index_t begin,
+                      index_t end) const
+{
+    if(begin < 0 || end < begin || end > number_of_elements())
+    {
+        CONDUIT_ERROR("DataAccessor::fill: invalid element range ["
+                      << begin << ", " << end << ") "
+                      << "(number of elements: "
+                      << number_of_elements() << ")");
+    }
+
+    if(begin == end)
+    {
+        return;
+    }
+
+    visit([&](const auto &vals)
+    {
+        // view of the selected range
+        typedef typename std::remove_reference<decltype(vals)>::type view_type;
+        view_type src(&vals[begin], end - begin, vals.stride());
+        ArrayView<T,true> dst(dest, end - begin, (index_t) sizeof(T));
+        detail::copy_elements(src, dst, end - begin);
+    });
+}
+
 //---------------------------------------------------------------------------//
 template <typename T>
 std::string
@@ -437,47 +478,41 @@ template <typename T>
 void
 DataAccessor<T>::to_json_stream(std::ostream &os) const
 {
+    // values are formatted into a buffer that is written to the stream
+    // in large chunks
+    static const size_t flush_bytes = 1 << 16;
+
     index_t nele = number_of_elements();
+    std::string buffer;
+    buffer.reserve(std::min((size_t)nele * 8 + 2, flush_bytes + 64));
+
     // note: nele == 0 case:
     // https://github.com/LLNL/conduit/issues/992
     // we want empty arrays to display as [] not empty string
     if(nele == 0 || nele > 1)
-        os << "[";
+        buffer += '[';
 
-    bool first=true;
     for(index_t idx = 0; idx < nele; idx++)
     {
-        if(!first)
-            os << ", ";
-
-        // need to deal with nan and infs for fp cases
-        if(std::is_floating_point<T>::value)
-        {
-            std::string fs = utils::float64_to_string((float64)element(idx));
-            //check for inf and nan
-            // looking for 'n' covers inf and nan
-            bool inf_or_nan = fs.find('n') != std::string::npos;
+        if(idx > 0)
+            buffer.append(", ",2);
 
-            if(inf_or_nan)
-                os << "\"";
+        // (quotes inf and nan for fp cases)
+        utils::append_json_number(buffer,element(idx));
 
-            os << fs;
-
-            if(inf_or_nan)
-                os << "\"";
-        }
-        else
+        if(buffer.size() >= flush_bytes)
         {
-            os << element(idx);
+            os.write(buffer.data(),(std::streamsize)buffer.size());
+            buffer.clear();
         }
-
-        first=false;
     }
     // note: nele == 0 case:
     // https://github.com/LLNL/conduit/issues/992
     // we want empty arrays to display as [] not empty string
     if(nele == 0 || nele > 1)
-        os << "]";
+        buffer += ']';
+
+    os.write(buffer.data(),(std::streamsize)buffer.size());
 }
 
 //---------------------------------------------------------------------------//
@@ -561,26 +596,10 @@ DataAccessor<T>::to_summary_string_stream(std::ostream &os,
             if(idx > 0 )
                 os << ", ";
 
-            // need to deal with nan and infs for fp cases
-            if(std::is_floating_point<T>::value)
-            {
-                std::string fs = utils::float64_to_string((float64)element(idx));
-                //check for inf and nan
-                // looking for 'n' covers inf and nan
-                bool inf_or_nan = fs.find('n') != std::string::npos;
-
-                if(inf_or_nan)
-                    os << "\"";
-
-                os << fs;
-
-                if(inf_or_nan)
-                    os << "\"";
-            }
-            else
-            {
-                os << element(idx);
-            }
+            // (quotes inf and nan for fp cases)
+            std::string fs;
+            utils::append_json_number(fs,element(idx));
+            os << fs;
 
             idx++;
 
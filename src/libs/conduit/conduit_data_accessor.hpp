@@ -18,6 +18,7 @@
 #include "conduit_core.hpp"
 #include "conduit_data_type.hpp"
 #include "conduit_utils.hpp"
+#include "conduit_array_view.hpp"
 
 
 //-----------------------------------------------------------------------------
@@ -85,6 +86,10 @@ public:
 
     void            fill(T value);
 
+    /// copies (and converts) elements [begin, end) into the contiguous
+    /// dest buffer, which must hold at least end - begin values
+    void            fill(T *dest, index_t begin, index_t end) const;
+
     const void     *element_ptr(index_t idx) const
                     {
                          return static_cast<const char*>(m_data) +
@@ -97,6 +102,18 @@ public:
     const DataType &dtype()    const 
                         { return m_dtype;}
 
+    /// calls func with a typed ArrayView of the underlying data,
+    /// resolving the data's type once instead of per element
+    /// (see dispatch_array())
+    template <typename Func>
+    decltype(auto)  visit(Func &&func) const
+                        {
+                            return dispatch_array(
+                                        static_cast<const void*>(m_data),
+                                        m_dtype,
+                                        func);
+                        }
+
 
 
 //-----------------------------------------------------------------------------
@@ -15,6 +15,7 @@
 #include <algorithm>
 #include <cstring>
 #include <limits>
+#include <type_traits>
 
 
 //-----------------------------------------------------------------------------
@@ -23,6 +24,8 @@
 #include "conduit_node.hpp"
 #include "conduit_utils.hpp"
 #include "conduit_log.hpp"
+#include "conduit_execution.hpp"
+#include "conduit_instrumentation.hpp"
 
 // Easier access to the Conduit logging functions
 using namespace conduit::utils;
@@ -447,56 +450,464 @@ DataArray<T>::diff_compatible(const DataArray<T> &array, Node &info, const float
 ///
 //---------------------------------------------------------------------------// 
 
-//---------------------------------------------------------------------------// 
+//-----------------------------------------------------------------------------
+// -- begin conduit::detail --
+//-----------------------------------------------------------------------------
+namespace detail
+{
+
+//---------------------------------------------------------------------------//
+// arrays with at least this many elements are reduced in parallel
+// (when conduit is built with OpenMP)
+//---------------------------------------------------------------------------//
+static const index_t data_array_parallel_threshold = 1 << 20;
+
+//---------------------------------------------------------------------------//
+// element views used by the reduction kernels, contiguous arrays use
+// a plain pointer so the kernel loops can be vectorized
+//---------------------------------------------------------------------------//
+template <typename T>
+struct ContiguousElements
+{
+    const T *m_data;
+
+    const T &operator[](index_t idx) const
+    { return m_data[idx]; }
+};
+
+//---------------------------------------------------------------------------//
 template <typename T>
+struct StridedElements
+{
+    const char *m_data;
+    index_t     m_stride;
+
+    const T &operator[](index_t idx) const
+    { return *reinterpret_cast<const T*>(m_data + m_stride * idx); }
+};
+
+//---------------------------------------------------------------------------//
+// calls func with the proper element view for the given data and dtype,
+// the switch between contiguous and strided access happens once
+//---------------------------------------------------------------------------//
+template <typename T, typename Func>
+auto
+visit_elements(const void *data,
+               const DataType &dtype,
+               Func &&func) -> decltype(func(ContiguousElements<T>()))
+{
+    const char *base = static_cast<const char*>(data) + dtype.offset();
+    if(dtype.stride() == (index_t)sizeof(T))
+    {
+        ContiguousElements<T> ele = {reinterpret_cast<const T*>(base)};
+        return func(ele);
+    }
+
+    if(dtype.stride() == 0 && dtype.number_of_elements() > 1)
+    {
+        CONDUIT_WARN("Node index calculation with with stride = 0");
+    }
+
+    StridedElements<T> ele = {base, dtype.stride()};
+    return func(ele);
+}
+
+//---------------------------------------------------------------------------//
+// runs a chunked reduction over [0, num_ele)
+//---------------------------------------------------------------------------//
+template <typename R, typename ChunkFunc, typename Combine>
+R
+reduce_elements(index_t num_ele,
+                const R &init,
+                ChunkFunc &&chunk_func,
+                Combine &&combine)
+{
+#if defined(CONDUIT_USE_OPENMP)
+    if(num_ele >= data_array_parallel_threshold)
+    {
+        return execution::reduce_chunks<execution::OpenMPExec>(0,
+                                                               num_ele,
+                                                               init,
+                                                               chunk_func,
+                                                               combine);
+    }
+#endif
+    return execution::reduce_chunks<execution::SerialExec>(0,
+                                                           num_ele,
+                                                           init,
+                                                           chunk_func,
+                                                           combine);
+}
+
+//---------------------------------------------------------------------------//
+// reduction kernels
+//
+// these use several independent accumulators, which breaks the loop
+// carried dependency and allows the compiler to vectorize the loops
+// over contiguous data without reassociating floating point math
+//---------------------------------------------------------------------------//
+template <typename T, typename Elements>
 T
-DataArray<T>::min()  const
+min_kernel(const Elements &ele, index_t begin, index_t end)
+{
+    T acc[4] = {std::numeric_limits<T>::max(),
+                std::numeric_limits<T>::max(),
+                std::numeric_limits<T>::max(),
+                std::numeric_limits<T>::max()};
+    index_t i = begin;
+    for(; i + 4 <= end; i += 4)
+    {
+        acc[0] = ele[i]     < acc[0] ? ele[i]     : acc[0];
+        acc[1] = ele[i + 1] < acc[1] ? ele[i + 1] : acc[1];
+        acc[2] = ele[i + 2] < acc[2] ? ele[i + 2] : acc[2];
+        acc[3] = ele[i + 3] < acc[3] ? ele[i + 3] : acc[3];
+    }
+    for(; i < end; i++)
+    {
+        acc[0] = ele[i] < acc[0] ? ele[i] : acc[0];
+    }
+    acc[0] = acc[1] < acc[0] ? acc[1] : acc[0];
+    acc[2] = acc[3] < acc[2] ? acc[3] : acc[2];
+    return acc[2] < acc[0] ? acc[2] : acc[0];
+}
+
+//---------------------------------------------------------------------------//
+template <typename T, typename Elements>
+T
+max_kernel(const Elements &ele, index_t begin, index_t end)
+{
+    T acc[4] = {std::numeric_limits<T>::lowest(),
+                std::numeric_limits<T>::lowest(),
+                std::numeric_limits<T>::lowest(),
+                std::numeric_limits<T>::lowest()};
+    index_t i = begin;
+    for(; i + 4 <= end; i += 4)
+    {
+        acc[0] = ele[i]     > acc[0] ? ele[i]     : acc[0];
+        acc[1] = ele[i + 1] > acc[1] ? ele[i + 1] : acc[1];
+        acc[2] = ele[i + 2] > acc[2] ? ele[i + 2] : acc[2];
+        acc[3] = ele[i + 3] > acc[3] ? ele[i + 3] : acc[3];
+    }
+    for(; i < end; i++)
+    {
+        acc[0] = ele[i] > acc[0] ? ele[i] : acc[0];
+    }
+    acc[0] = acc[1] > acc[0] ? acc[1] : acc[0];
+    acc[2] = acc[3] > acc[2] ? acc[3] : acc[2];
+    return acc[2] > acc[0] ? acc[2] : acc[0];
+}
+
+//---------------------------------------------------------------------------//
+template <typename T>
+struct MinMax
+{
+    T min;
+    T max;
+};
+
+//---------------------------------------------------------------------------//
+template <typename T, typename Elements>
+MinMax<T>
+minmax_kernel(const Elements &ele, index_t begin, index_t end)
+{
+    T acc_min[2] = {std::numeric_limits<T>::max(),
+                    std::numeric_limits<T>::max()};
+    T acc_max[2] = {std::numeric_limits<T>::lowest(),
+                    std::numeric_limits<T>::lowest()};
+    index_t i = begin;
+    for(; i + 2 <= end; i += 2)
+    {
+        acc_min[0] = ele[i]     < acc_min[0] ? ele[i]     : acc_min[0];
+        acc_max[0] = ele[i]     > acc_max[0] ? ele[i]     : acc_max[0];
+        acc_min[1] = ele[i + 1] < acc_min[1] ? ele[i + 1] : acc_min[1];
+        acc_max[1] = ele[i + 1] > acc_max[1] ? ele[i + 1] : acc_max[1];
+    }
+    for(; i < end; i++)
+    {
+        acc_min[0] = ele[i] < acc_min[0] ? ele[i] : acc_min[0];
+        acc_max[0] = ele[i] > acc_max[0] ? ele[i] : acc_max[0];
+    }
+    MinMax<T> res;
+    res.min = acc_min[1] < acc_min[0] ? acc_min[1] : acc_min[0];
+    res.max = acc_max[1] > acc_max[0] ? acc_max[1] : acc_max[0];
+    return res;
+}
+
+//---------------------------------------------------------------------------//
+template <typename R, typename Elements>
+R
+sum_kernel(const Elements &ele, index_t begin, index_t end)
+{
+    R acc[4] = {0, 0, 0, 0};
+    index_t i = begin;
+    for(; i + 4 <= end; i += 4)
+    {
+        acc[0] += ele[i];
+        acc[1] += ele[i + 1];
+        acc[2] += ele[i + 2];
+        acc[3] += ele[i + 3];
+    }
+    for(; i < end; i++)
+    {
+        acc[0] += ele[i];
+    }
+    return (acc[0] + acc[1]) + (acc[2] + acc[3]);
+}
+
+//---------------------------------------------------------------------------//
+template <typename T, typename Elements>
+index_t
+count_kernel(const Elements &ele, index_t begin, index_t end, T value)
+{
+    index_t res = 0;
+    for(index_t i = begin; i < end; i++)
+    {
+        res += (ele[i] == value) ? 1 : 0;
+    }
+    return res;
+}
+
+//---------------------------------------------------------------------------//
+// Kahan-Babuska (Neumaier) compensated sum
+//---------------------------------------------------------------------------//
+template <typename T>
+struct CompensatedSum
 {
-    T res = std::numeric_limits<T>::max();
-    for(index_t i = 0; i < number_of_elements(); i++)
+    T sum;
+    T comp;
+
+    void add(T value)
     {
-        const T &val = element(i);
-        if(val < res)
+        T t = sum + value;
+        if( (sum >= 0 ? sum : -sum) >= (value >= 0 ? value : -value) )
         {
-            res = val;
+            comp += (sum - t) + value;
         }
+        else
+        {
+            comp += (value - t) + sum;
+        }
+        sum = t;
     }
+};
 
+//---------------------------------------------------------------------------//
+template <typename T, typename Elements>
+CompensatedSum<T>
+kahan_sum_kernel(const Elements &ele, index_t begin, index_t end)
+{
+    CompensatedSum<T> res = {0, 0};
+    for(index_t i = begin; i < end; i++)
+    {
+        res.add(ele[i]);
+    }
     return res;
 }
 
-//---------------------------------------------------------------------------// 
+//---------------------------------------------------------------------------//
 template <typename T>
 T
-DataArray<T>::max() const
+kahan_sum(const void *data, const DataType &dtype, std::true_type)
+{
+    CompensatedSum<T> init = {0, 0};
+    CompensatedSum<T> res = visit_elements<T>(data, dtype, [&](const auto &ele)
+    {
+        return reduce_elements(dtype.number_of_elements(),
+                               init,
+                               [&](index_t begin, index_t end)
+                               {
+                                   return kahan_sum_kernel<T>(ele, begin, end);
+                               },
+                               [](CompensatedSum<T> lhs,
+                                  const CompensatedSum<T> &rhs)
+                               {
+                                   lhs.add(rhs.sum);
+                                   lhs.comp += rhs.comp;
+                                   return lhs;
+                               });
+    });
+    return res.sum + res.comp;
+}
+
+//---------------------------------------------------------------------------//
+// integer case: sums are exact, no compensation needed
+//---------------------------------------------------------------------------//
+template <typename T>
+T
+kahan_sum(const void *data, const DataType &dtype, std::false_type)
+{
+    return visit_elements<T>(data, dtype, [&](const auto &ele)
+    {
+        return reduce_elements(dtype.number_of_elements(),
+                               T(0),
+                               [&](index_t begin, index_t end)
+                               {
+                                   return sum_kernel<T>(ele, begin, end);
+                               },
+                               [](T lhs, T rhs) { return T(lhs + rhs); });
+    });
+}
+
+//---------------------------------------------------------------------------//
+// copies (and converts) values from src into dest using the bulk
+// conversion kernels
+//---------------------------------------------------------------------------//
+template <typename T, typename U>
+void
+copy_data_array(DataArray<T> &dest,
+                const DataArray<U> &src)
 {
-    T res = std::numeric_limits<T>::lowest();
-    for(index_t i = 0; i < number_of_elements(); i++)
+    index_t num_ele = dest.number_of_elements();
+    if(!std::is_same<T,U>::value)
     {
-        const T &val = element(i);
-        if(val > res)
+        instrumentation::record_conversion((size_t)num_ele);
+    }
+    dispatch_array_view<T>(dest.data_ptr(),
+                           dest.dtype(),
+                           [&](const auto &dest_vals)
+    {
+        dispatch_array_view<U>(static_cast<const void*>(src.data_ptr()),
+                               src.dtype(),
+                               [&](const auto &src_vals)
         {
-            res = val;
-        }
+            copy_elements(src_vals, dest_vals, num_ele);
+        });
+    });
+}
+
+//---------------------------------------------------------------------------//
+// returns a pointer to the given indices as contiguous index_t values,
+// converting into buffer when needed
+//---------------------------------------------------------------------------//
+inline const index_t *
+contiguous_indices(const DataAccessor<index_t> &indices,
+                   std::vector<index_t> &buffer)
+{
+    const DataType &idx_dtype = indices.dtype();
+    if(idx_dtype.id() == DataType::index_t(1).id() &&
+       idx_dtype.stride() == (index_t)sizeof(index_t))
+    {
+        return static_cast<const index_t*>(indices.element_ptr(0));
     }
 
-    return res;
+    buffer.resize((size_t)indices.number_of_elements());
+    indices.fill(buffer.data(), 0, indices.number_of_elements());
+    return buffer.data();
 }
 
+}
+//-----------------------------------------------------------------------------
+// -- end conduit::detail --
+//-----------------------------------------------------------------------------
+
+//---------------------------------------------------------------------------// 
+template <typename T>
+T
+DataArray<T>::min()  const
+{
+    return detail::visit_elements<T>(m_data, m_dtype, [&](const auto &ele)
+    {
+        return detail::reduce_elements(number_of_elements(),
+                                       std::numeric_limits<T>::max(),
+                                       [&](index_t begin, index_t end)
+                                       {
+                                           return detail::min_kernel<T>(ele,
+                                                                        begin,
+                                                                        end);
+                                       },
+                                       [](T lhs, T rhs)
+                                       {
+                                           return rhs < lhs ? rhs : lhs;
+                                       });
+    });
+}
+
+//---------------------------------------------------------------------------// 
+template <typename T>
+T
+DataArray<T>::max() const
+{
+    return detail::visit_elements<T>(m_data, m_dtype, [&](const auto &ele)
+    {
+        return detail::reduce_elements(number_of_elements(),
+                                       std::numeric_limits<T>::lowest(),
+                                       [&](index_t begin, index_t end)
+                                       {
+                                           return detail::max_kernel<T>(ele,
+                                                                        begin,
+                                                                        end);
+                                       },
+                                       [](T lhs, T rhs)
+                                       {
+                                           return rhs > lhs ? rhs : lhs;
+                                       });
+    });
+}
+
+//---------------------------------------------------------------------------// 
+template <typename T>
+void
+DataArray<T>::minmax(T &min_value, T &max_value) const
+{
+    detail::MinMax<T> init;
+    init.min = std::numeric_limits<T>::max();
+    init.max = std::numeric_limits<T>::lowest();
+
+    detail::MinMax<T> res = detail::visit_elements<T>(m_data,
+                                                      m_dtype,
+                                                      [&](const auto &ele)
+    {
+        return detail::reduce_elements(number_of_elements(),
+                                       init,
+                                       [&](index_t begin, index_t end)
+                                       {
+                                           return detail::minmax_kernel<T>(ele,
+                                                                           begin,
+                                                                           end);
+                                       },
+                                       [](detail::MinMax<T> lhs,
+                                          const detail::MinMax<T> &rhs)
+                                       {
+                                           lhs.min = rhs.min < lhs.min ? rhs.min : lhs.min;
+                                           lhs.max = rhs.max > lhs.max ? rhs.max : lhs.max;
+                                           return lhs;
+                                       });
+    });
+
+    min_value = res.min;
+    max_value = res.max;
+}
 
 //---------------------------------------------------------------------------// 
 template <typename T>
 T
 DataArray<T>::sum() const
 {
-    T res =0;
-    for(index_t i = 0; i < number_of_elements(); i++)
-    {
-        const T &val = element(i);
-        res += val;
-    }
+    return detail::visit_elements<T>(m_data, m_dtype, [&](const auto &ele)
+    {
+        return detail::reduce_elements(number_of_elements(),
+                                       T(0),
+                                       [&](index_t begin, index_t end)
+                                       {
+                                           return detail::sum_kernel<T>(ele,
+                                                                        begin,
+                                                                        end);
+                                       },
+                                       [](T lhs, T rhs)
+                                       {
+                                           return T(lhs + rhs);
+                                       });
+    });
+}
 
-    return res;
+//---------------------------------------------------------------------------// 
+template <typename T>
+T
+DataArray<T>::kahan_sum() const
+{
+    return detail::kahan_sum<T>(m_data,
+                                m_dtype,
+                                std::is_floating_point<T>());
 }
 
 //---------------------------------------------------------------------------// 
@@ -504,12 +915,21 @@ template <typename T>
 float64
 DataArray<T>::mean() const
 {
-    float64 res =0;
-    for(index_t i = 0; i < number_of_elements(); i++)
-    {
-        const T &val = element(i);
-        res += val;
-    }
+    float64 res = detail::visit_elements<T>(m_data, m_dtype, [&](const auto &ele)
+    {
+        return detail::reduce_elements(number_of_elements(),
+                                       float64(0),
+                                       [&](index_t begin, index_t end)
+                                       {
+                                           return detail::sum_kernel<float64>(ele,
+                                                                              begin,
+                                                                              end);
+                                       },
+                                       [](float64 lhs, float64 rhs)
+                                       {
+                                           return lhs + rhs;
+                                       });
+    });
 
     res = res / float64(number_of_elements());
     return res;
@@ -520,15 +940,22 @@ template <typename T>
 index_t
 DataArray<T>::count(T val) const
 {
-    index_t res= 0;
-    for(index_t i = 0; i < number_of_elements(); i++)
-    {
-        if(element(i) == val)
-        {
-            res++;
-        }
-    }
-    return res;
+    return detail::visit_elements<T>(m_data, m_dtype, [&](const auto &ele)
+    {
+        return detail::reduce_elements(number_of_elements(),
+                                       index_t(0),
+                                       [&](index_t begin, index_t end)
+                                       {
+                                           return detail::count_kernel<T>(ele,
+                                                                          begin,
+                                                                          end,
+                                                                          val);
+                                       },
+                                       [](index_t lhs, index_t rhs)
+                                       {
+                                           return lhs + rhs;
+                                       });
+    });
 }
 
 //---------------------------------------------------------------------------// 
@@ -596,71 +1023,48 @@ template <typename T>
 void            
 DataArray<T>::to_json_stream(std::ostream &os) const 
 { 
+    if(!m_dtype.is_number())
+    {
+        CONDUIT_ERROR("Leaf type \"" 
+                      <<  m_dtype.name()
+                      << "\"" 
+                      << "is not supported in conduit::DataArray.")
+    }
+
+    // values are formatted into a buffer that is written to the stream
+    // in large chunks
+    static const size_t flush_bytes = 1 << 16;
+
     index_t nele = number_of_elements();
+    std::string buffer;
+    buffer.reserve(std::min((size_t)nele * 8 + 2, flush_bytes + 64));
+
     // note: nele == 0 case: 
     // https://github.com/LLNL/conduit/issues/992
     // we want empty arrays to display as [] not empty string
     if(nele == 0 || nele > 1)
-        os << "[";
+        buffer += '[';
 
-    bool first=true;
     for(index_t idx = 0; idx < nele; idx++)
     {
-        if(!first)
-            os << ", ";
-        switch(m_dtype.id())
+        if(idx > 0)
+            buffer.append(", ",2);
+
+        utils::append_json_number(buffer,element(idx));
+
+        if(buffer.size() >= flush_bytes)
         {
-            // ints 
-            case DataType::INT8_ID:
-            case DataType::INT16_ID: 
-            case DataType::INT32_ID:
-            case DataType::INT64_ID:
-            {
-                 os << (int64) element(idx);
-                 break;
-            }
-            // uints
-            case DataType::UINT8_ID:
-            case DataType::UINT16_ID:
-            case DataType::UINT32_ID:
-            case DataType::UINT64_ID:
-            {
-                os << (uint64) element(idx);
-                break;
-            }
-            // floats 
-            case DataType::FLOAT32_ID: 
-            case DataType::FLOAT64_ID: 
-            {
-                std::string fs = utils::float64_to_string((float64)element(idx));
-                //check for inf and nan
-                // looking for 'n' covers inf and nan
-                bool inf_or_nan = fs.find('n') != std::string::npos;
-                
-                if(inf_or_nan)
-                    os << "\"";
-                
-                os << fs;
-
-                if(inf_or_nan)
-                    os << "\"";
-                break;
-            }
-            default:
-            {
-                CONDUIT_ERROR("Leaf type \"" 
-                              <<  m_dtype.name()
-                              << "\"" 
-                              << "is not supported in conduit::DataArray.")
-            }
+            os.write(buffer.data(),(std::streamsize)buffer.size());
+            buffer.clear();
         }
-        first=false;
     }
     // note: nele == 0 case: 
     // https://github.com/LLNL/conduit/issues/992
     // we want empty arrays to display as [] not empty string
     if(nele == 0 || nele > 1)
-        os << "]";
+        buffer += ']';
+
+    os.write(buffer.data(),(std::streamsize)buffer.size());
 }
 
 //---------------------------------------------------------------------------//
@@ -1465,6 +1869,92 @@ DataArray<T>::fill(float64 value)
     }
 }
 
+//-----------------------------------------------------------------------------
+// gather and scatter
+//-----------------------------------------------------------------------------
+
+//---------------------------------------------------------------------------//
+template <typename T>
+void
+DataArray<T>::gather(const DataArray<T> &src,
+                     const DataAccessor<index_t> &indices)
+{
+    index_t num_idx = indices.number_of_elements();
+    if(num_idx > number_of_elements())
+    {
+        CONDUIT_ERROR("DataArray::gather: number of indices (" << num_idx
+                      << ") exceeds the number of elements in the "
+                      << "destination array (" << number_of_elements()
+                      << ")");
+    }
+
+    std::vector<index_t> idx_buffer;
+    const index_t *idx = detail::contiguous_indices(indices, idx_buffer);
+    index_t src_num_ele = src.number_of_elements();
+
+    detail::dispatch_array_view<T>(m_data,
+                                   m_dtype,
+                                   [&](const auto &dest_vals)
+    {
+        detail::dispatch_array_view<T>(static_cast<const void*>(src.data_ptr()),
+                                       src.dtype(),
+                                       [&](const auto &src_vals)
+        {
+            for(index_t i = 0; i < num_idx; i++)
+            {
+                if(idx[i] < 0 || idx[i] >= src_num_ele)
+                {
+                    CONDUIT_ERROR("DataArray::gather: index " << idx[i]
+                                  << " is out of range (number of "
+                                  << "elements: " << src_num_ele << ")");
+                }
+                dest_vals[i] = src_vals[idx[i]];
+            }
+        });
+    });
+}
+
+//---------------------------------------------------------------------------//
+template <typename T>
+void
+DataArray<T>::scatter(DataArray<T> &dest,
+                      const DataAccessor<index_t> &indices) const
+{
+    index_t num_idx = indices.number_of_elements();
+    if(num_idx > number_of_elements())
+    {
+        CONDUIT_ERROR("DataArray::scatter: number of indices (" << num_idx
+                      << ") exceeds the number of elements in the "
+                      << "source array (" << number_of_elements()
+                      << ")");
+    }
+
+    std::vector<index_t> idx_buffer;
+    const index_t *idx = detail::contiguous_indices(indices, idx_buffer);
+    index_t dest_num_ele = dest.number_of_elements();
+
+    detail::dispatch_array_view<T>(dest.data_ptr(),
+                                   dest.dtype(),
+                                   [&](const auto &dest_vals)
+    {
+        detail::dispatch_array_view<T>(static_cast<const void*>(m_data),
+                                       m_dtype,
+                                       [&](const auto &src_vals)
+        {
+            for(index_t i = 0; i < num_idx; i++)
+            {
+                if(idx[i] < 0 || idx[i] >= dest_num_ele)
+                {
+                    CONDUIT_ERROR("DataArray::scatter: index " << idx[i]
+                                  << " is out of range (number of "
+                                  << "elements: " << dest_num_ele << ")");
+                }
+                dest_vals[idx[i]] = src_vals[i];
+            }
+        });
+    });
+}
+
 //---------------------------------------------------------------------------//
 // assign operator overloads for initializer_list
 //---------------------------------------------------------------------------//
@@ -1763,47 +2253,31 @@ template <typename T>
 void
 DataArray<T>::set(const DataArray<int8> &values)
 {
-    index_t num_elems = m_dtype.number_of_elements();
-    for(index_t i=0; i <num_elems; i++)
-    {
-        this->element(i) = (T)values[i];
-    }
+    detail::copy_data_array(*this,values);
 }
 
 //---------------------------------------------------------------------------//
 template <typename T>
 void
 DataArray<T>::set(const DataArray<int16> &values)
-{ 
-    index_t num_elems = m_dtype.number_of_elements();
-    for(index_t i=0; i <num_elems; i++)
-    {
-        this->element(i) = (T)values[i];
-    }
+{
+    detail::copy_data_array(*this,values);
 }
 
 //---------------------------------------------------------------------------//
 template <typename T>
 void
 DataArray<T>::set(const DataArray<int32> &values)
-{ 
-    index_t num_elems = m_dtype.number_of_elements();
-    for(index_t i=0; i <num_elems; i++)
-    {
-        this->element(i) = (T)values[i];
-    }
+{
+    detail::copy_data_array(*this,values);
 }
 
 //---------------------------------------------------------------------------//
 template <typename T>
 void
 DataArray<T>::set(const DataArray<int64> &values)
-{ 
-    index_t num_elems = m_dtype.number_of_elements();
-    for(index_t i=0; i <num_elems; i++)
-    {
-        this->element(i) = (T)values[i];
-    }
+{
+    detail::copy_data_array(*this,values);
 }
 
 //---------------------------------------------------------------------------//
@@ -1815,23 +2289,15 @@ template <typename T>
 void
 DataArray<T>::set(const DataArray<uint8> &values)
 {
-    index_t num_elems = m_dtype.number_of_elements();
-    for(index_t i=0; i <num_elems; i++)
-    {
-        this->element(i) = (T)values[i];
-    }
+    detail::copy_data_array(*this,values);
 }
 
 //---------------------------------------------------------------------------//
 template <typename T>
 void
 DataArray<T>::set(const DataArray<uint16> &values)
-{ 
-    index_t num_elems = m_dtype.number_of_elements();
-    for(index_t i=0; i <num_elems; i++)
-    {
-        this->element(i) = (T)values[i];
-    }
+{
+    detail::copy_data_array(*this,values);
 }
 
 //---------------------------------------------------------------------------//
@@ -1839,11 +2305,7 @@ template <typename T>
 void
 DataArray<T>::set(const DataArray<uint32> &values)
 {
-    index_t num_elems = m_dtype.number_of_elements();
-    for(index_t i=0; i <num_elems; i++)
-    {
-        this->element(i) = (T)values[i];
-    }
+    detail::copy_data_array(*this,values);
 }
 
 //---------------------------------------------------------------------------//
@@ -1851,11 +2313,7 @@ template <typename T>
 void
 DataArray<T>::set(const DataArray<uint64> &values)
 {
-    index_t num_elems = m_dtype.number_of_elements();
-    for(index_t i=0; i <num_elems; i++)
-    {
-        this->element(i) = (T)values[i];
-    }
+    detail::copy_data_array(*this,values);
 }
 
 //---------------------------------------------------------------------------//
@@ -1867,11 +2325,7 @@ template <typename T>
 void
 DataArray<T>::set(const DataArray<float32> &values)
 {
-    index_t num_elems = m_dtype.number_of_elements();
-    for(index_t i=0; i <num_elems; i++)
-    {
-        this->element(i) = (T)values[i];
-    }
+    detail::copy_data_array(*this,values);
 }
 
 //---------------------------------------------------------------------------//
@@ -1879,11 +2333,7 @@ template <typename T>
 void
 DataArray<T>::set(const DataArray<float64> &values)
 {
-    index_t num_elems = m_dtype.number_of_elements();
-    for(index_t i=0; i <num_elems; i++)
-    {
-        this->element(i) = (T)values[i];
-    }
+    detail::copy_data_array(*this,values);
 }
 
 //---------------------------------------------------------------------------//
@@ -2126,18 +2576,10 @@ DataArray<T>::to_summary_string_stream(std::ostream &os,
                 case DataType::FLOAT32_ID:
                 case DataType::FLOAT64_ID:
                 {
-                    std::string fs = utils::float64_to_string((float64)element(idx));
-                    //check for inf and nan
-                    // looking for 'n' covers inf and nan
-                    bool inf_or_nan = fs.find('n') != std::string::npos;
-
-                    if(inf_or_nan)
-                        os << "\"";
-
+                    // (quotes inf and nan)
+                    std::string fs;
+                    utils::append_json_number(fs,element(idx));
                     os << fs;
-
-                    if(inf_or_nan)
-                        os << "\"";
                     break;
                 }
                 default:
@@ -107,9 +107,18 @@ public:
     ///
     /// Summary Stats Helpers
     ///
+    /// These run tight loops over the raw data for contiguous arrays.
+    /// When conduit is built with OpenMP, large arrays are split
+    /// across threads.
+    ///
     T               min()  const;
     T               max()  const;
+    /// finds both the min and max in a single pass
+    void            minmax(T &min_value, T &max_value) const;
     T               sum()  const;
+    /// compensated (Kahan-Babuska) sum, reduces round off error for
+    /// floating point types (same as sum() for integer types)
+    T               kahan_sum() const;
     float64         mean() const;
     
     /// counts number of occurrences of given value
@@ -344,6 +353,19 @@ public:
     void            fill(float32 value);
     void            fill(float64 value);
 
+//-----------------------------------------------------------------------------
+// Gather and Scatter
+//-----------------------------------------------------------------------------
+    /// copies the src values selected by indices into this array:
+    ///   this[i] = src[indices[i]], for i < indices.number_of_elements()
+    void            gather(const DataArray<T> &src,
+                           const DataAccessor<index_t> &indices);
+
+    /// copies the values of this array into dest at the given indices:
+    ///   dest[indices[i]] = this[i], for i < indices.number_of_elements()
+    void            scatter(DataArray<T> &dest,
+                            const DataAccessor<index_t> &indices) const;
+
 //-----------------------------------------------------------------------------
 // Transforms
 //-----------------------------------------------------------------------------
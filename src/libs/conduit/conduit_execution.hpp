@@ -17,6 +17,7 @@
 // conduit lib includes
 //-----------------------------------------------------------------------------
 #include "conduit_execution_serial.hpp"
+#include "conduit_execution_task.hpp"
 #if defined(CONDUIT_USE_OPENMP)
 #include "conduit_execution_omp.hpp"
 #endif
@@ -40,6 +41,19 @@ struct SerialExec
 {
     using for_policy = seq::for_policy;
     using sort_policy = seq::sort_policy;
+    using reduce_policy = seq::reduce_policy;
+    using scan_policy = seq::scan_policy;
+};
+
+//---------------------------------------------------------------------------
+/// Runs work as tasks on the built-in thread pool or on the executor
+/// installed with task::set_task_executor(). Does not require OpenMP.
+struct TaskExec
+{
+    using for_policy = task::for_policy;
+    using sort_policy = task::sort_policy;
+    using reduce_policy = task::reduce_policy;
+    using scan_policy = task::scan_policy;
 };
 
 #if defined(CONDUIT_USE_OPENMP)
@@ -48,6 +62,8 @@ struct OpenMPExec
 {
     using for_policy = omp::for_policy;
     using sort_policy = omp::sort_policy;
+    using reduce_policy = omp::reduce_policy;
+    using scan_policy = omp::scan_policy;
 };
 #endif
 
@@ -61,6 +77,18 @@ for_all(size_t begin, size_t end, Func &&func)
     exec(begin, end, func);
 }
 
+/// `grain` is a hint for the minimum number of iterations to run as one
+/// unit of work, larger values reduce scheduling overhead for cheap
+/// loop bodies
+template <typename ExecutionPolicy, typename Func>
+inline void
+for_all(size_t begin, size_t end, Func &&func, index_t grain)
+{
+    using policy = typename ExecutionPolicy::for_policy;
+    policy exec;
+    exec(begin, end, func, grain);
+}
+
 template <typename ExecutionPolicy, typename Iterator>
 inline void
 sort(Iterator begin, Iterator end)
@@ -79,6 +107,227 @@ sort(Iterator begin, Iterator end, Predicate &&predicate)
     exec(begin, end, predicate);
 }
 
+//---------------------------------------------------------------------------
+/// Splits [begin, end) into chunks (one per thread for parallel policies),
+/// computes a partial result for each with chunk_func(chunk_begin, chunk_end)
+/// and returns init combined with the partial results, in chunk order,
+/// using combine(lhs, rhs).
+///
+/// Working on chunks lets chunk_func run a tight loop over its range,
+/// which the compiler can vectorize.
+template <typename ExecutionPolicy, typename T, typename ChunkFunc, typename Combine>
+inline T
+reduce_chunks(index_t begin, index_t end, const T &init,
+              ChunkFunc &&chunk_func, Combine &&combine)
+{
+    using policy = typename ExecutionPolicy::reduce_policy;
+    policy exec;
+    return exec(begin, end, init, chunk_func, combine);
+}
+
+/// reduce_chunks with a grain size hint (the minimum chunk size)
+template <typename ExecutionPolicy, typename T, typename ChunkFunc, typename Combine>
+inline T
+reduce_chunks(index_t begin, index_t end, const T &init,
+              ChunkFunc &&chunk_func, Combine &&combine, index_t grain)
+{
+    using policy = typename ExecutionPolicy::reduce_policy;
+    policy exec;
+    return exec(begin, end, init, chunk_func, combine, grain);
+}
+
+//---------------------------------------------------------------------------
+/// Chunked scan over [begin, end). Parallel policies run two passes:
+/// chunk_reduce(chunk_begin, chunk_end) computes each chunk's total, then
+/// chunk_scan(chunk_begin, chunk_end, start) writes the scan of each chunk
+/// starting from `start` (init combined with the totals of all prior
+/// chunks) and returns its total combined with `start`. Serial policies
+/// only call chunk_scan. Returns init combined with all items.
+template <typename ExecutionPolicy, typename T,
+          typename ChunkReduce, typename ChunkScan, typename Combine>
+inline T
+scan_chunks(index_t begin, index_t end, const T &init,
+            ChunkReduce &&chunk_reduce, ChunkScan &&chunk_scan,
+            Combine &&combine, index_t grain = 0)
+{
+    using policy = typename ExecutionPolicy::scan_policy;
+    policy exec;
+    return exec(begin, end, init, chunk_reduce, chunk_scan, combine, grain);
+}
+
+//---------------------------------------------------------------------------
+// Algorithms built on the chunked primitives above. These work with any
+// policy and accept arrays that support operator[] (raw pointers,
+// std::vector, DataArray, DataAccessor, ArrayView, etc).
+//---------------------------------------------------------------------------
+
+//---------------------------------------------------------------------------
+/// Returns init combined with func(i) for all i in [begin, end).
+/// combine must be associative.
+template <typename ExecutionPolicy, typename T, typename Func, typename Combine>
+inline T
+reduce(index_t begin, index_t end, const T &init,
+       Func &&func, Combine &&combine, index_t grain = 0)
+{
+    return reduce_chunks<ExecutionPolicy>(begin, end, init,
+        [&](index_t chunk_begin, index_t chunk_end)
+        {
+            T res = func(chunk_begin);
+            for(index_t i = chunk_begin + 1; i < chunk_end; i++)
+                res = combine(res, func(i));
+            return res;
+        },
+        combine, grain);
+}
+
+/// Returns init plus the sum of func(i) for all i in [begin, end).
+template <typename ExecutionPolicy, typename T, typename Func>
+inline T
+reduce(index_t begin, index_t end, const T &init, Func &&func)
+{
+    return reduce_chunks<ExecutionPolicy>(begin, end, init,
+        [&](index_t chunk_begin, index_t chunk_end)
+        {
+            T res = T(0);
+            for(index_t i = chunk_begin; i < chunk_end; i++)
+                res += func(i);
+            return res;
+        },
+        [](const T &lhs, const T &rhs) { return lhs + rhs; });
+}
+
+//---------------------------------------------------------------------------
+/// Writes output[i] = init op input[0] op ... op input[i-1] for i in
+/// [0, n) and returns the total (init combined with all n inputs).
+/// `output` may be `input` (in place scan). op must be associative.
+template <typename ExecutionPolicy, typename InputArray, typename OutputArray,
+          typename T, typename BinaryOp>
+inline T
+exclusive_scan(const InputArray &input, OutputArray &&output, index_t n,
+               const T &init, BinaryOp &&op, index_t grain = 0)
+{
+    return scan_chunks<ExecutionPolicy>(0, n, init,
+        [&](index_t chunk_begin, index_t chunk_end)
+        {
+            T res = static_cast<T>(input[chunk_begin]);
+            for(index_t i = chunk_begin + 1; i < chunk_end; i++)
+                res = op(res, static_cast<T>(input[i]));
+            return res;
+        },
+        [&](index_t chunk_begin, index_t chunk_end, T start)
+        {
+            for(index_t i = chunk_begin; i < chunk_end; i++)
+            {
+                const T val = static_cast<T>(input[i]);
+                output[i] = start;
+                start = op(start, val);
+            }
+            return start;
+        },
+        op, grain);
+}
+
+/// exclusive prefix sum, for example sizes to offsets
+template <typename ExecutionPolicy, typename InputArray, typename OutputArray,
+          typename T>
+inline T
+exclusive_scan(const InputArray &input, OutputArray &&output, index_t n,
+               const T &init)
+{
+    return exclusive_scan<ExecutionPolicy>(input, output, n, init,
+        [](const T &lhs, const T &rhs) { return lhs + rhs; });
+}
+
+//---------------------------------------------------------------------------
+/// Writes output[i] = init op input[0] op ... op input[i] for i in
+/// [0, n) and returns the total. `output` may be `input`.
+template <typename ExecutionPolicy, typename InputArray, typename OutputArray,
+          typename T, typename BinaryOp>
+inline T
+inclusive_scan(const InputArray &input, OutputArray &&output, index_t n,
+               const T &init, BinaryOp &&op, index_t grain = 0)
+{
+    return scan_chunks<ExecutionPolicy>(0, n, init,
+        [&](index_t chunk_begin, index_t chunk_end)
+        {
+            T res = static_cast<T>(input[chunk_begin]);
+            for(index_t i = chunk_begin + 1; i < chunk_end; i++)
+                res = op(res, static_cast<T>(input[i]));
+            return res;
+        },
+        [&](index_t chunk_begin, index_t chunk_end, T start)
+        {
+            for(index_t i = chunk_begin; i < chunk_end; i++)
+            {
+                start = op(start, static_cast<T>(input[i]));
+                output[i] = start;
+            }
+            return start;
+        },
+        op, grain);
+}
+
+/// inclusive prefix sum
+template <typename ExecutionPolicy, typename InputArray, typename OutputArray,
+          typename T>
+inline T
+inclusive_scan(const InputArray &input, OutputArray &&output, index_t n,
+               const T &init)
+{
+    return inclusive_scan<ExecutionPolicy>(input, output, n, init,
+        [](const T &lhs, const T &rhs) { return lhs + rhs; });
+}
+
+//---------------------------------------------------------------------------
+/// Returns the number of i in [begin, end) where pred(i) is true.
+template <typename ExecutionPolicy, typename Predicate>
+inline index_t
+count_if(index_t begin, index_t end, Predicate &&pred, index_t grain = 0)
+{
+    return reduce_chunks<ExecutionPolicy>(begin, end, (index_t)0,
+        [&](index_t chunk_begin, index_t chunk_end)
+        {
+            index_t res = 0;
+            for(index_t i = chunk_begin; i < chunk_end; i++)
+                res += pred(i) ? 1 : 0;
+            return res;
+        },
+        [](index_t lhs, index_t rhs) { return lhs + rhs; },
+        grain);
+}
+
+//---------------------------------------------------------------------------
+/// Counts how many i in [begin, end) fall into each bin, where bin(i)
+/// returns the bin index. Returns num_bins counts, bin indices outside
+/// [0, num_bins) are not counted. Parallel policies count each chunk
+/// into its own histogram, so num_bins should be modest.
+template <typename ExecutionPolicy, typename BinFunc>
+inline std::vector<index_t>
+histogram(index_t begin, index_t end, index_t num_bins, BinFunc &&bin,
+          index_t grain = 0)
+{
+    const std::vector<index_t> init(static_cast<size_t>(num_bins), 0);
+    return reduce_chunks<ExecutionPolicy>(begin, end, init,
+        [&](index_t chunk_begin, index_t chunk_end)
+        {
+            std::vector<index_t> res(static_cast<size_t>(num_bins), 0);
+            for(index_t i = chunk_begin; i < chunk_end; i++)
+            {
+                const index_t b = static_cast<index_t>(bin(i));
+                if(b >= 0 && b < num_bins)
+                    res[static_cast<size_t>(b)]++;
+            }
+            return res;
+        },
+        [](std::vector<index_t> lhs, const std::vector<index_t> &rhs)
+        {
+            for(size_t b = 0; b < lhs.size(); b++)
+                lhs[b] += rhs[b];
+            return lhs;
+        },
+        grain);
+}
+
 }
 //-----------------------------------------------------------------------------
 // -- end conduit::execution --
@@ -22,6 +22,9 @@
 #include <omp.h>
 #endif
 
+#include <algorithm>
+#include <vector>
+
 //-----------------------------------------------------------------------------
 // -- begin conduit --
 //-----------------------------------------------------------------------------
@@ -40,18 +43,45 @@ namespace execution
 namespace omp
 {
 
+#if defined(CONDUIT_USE_OPENMP)
+//---------------------------------------------------------------------------
+/// number of chunks used to split n items: one per thread, or one per
+/// `grain` items when a grain size hint is given
+inline index_t
+number_of_chunks(index_t n, index_t grain)
+{
+    index_t nchunks = static_cast<index_t>(omp_get_max_threads());
+    if(grain > 0)
+        nchunks = (n + grain - 1) / grain;
+    if(nchunks > n)
+        nchunks = n;
+    return nchunks < 1 ? 1 : nchunks;
+}
+#endif
+
 //---------------------------------------------------------------------------
 struct for_policy
 {
     template <typename Func>
-    inline void operator()(index_t begin, index_t end, Func &&func)
+    inline void operator()(index_t begin, index_t end, Func &&func,
+                           index_t grain = 0)
     {
 #if defined(CONDUIT_USE_OPENMP)
 //        #pragma message("omp::for_policy -> OMP")
-        #pragma omp parallel for
-        for(index_t i = begin; i < end; i++)
-            func(i);
+        if(grain > 0)
+        {
+            #pragma omp parallel for schedule(dynamic, grain)
+            for(index_t i = begin; i < end; i++)
+                func(i);
+        }
+        else
+        {
+            #pragma omp parallel for
+            for(index_t i = begin; i < end; i++)
+                func(i);
+        }
 #else
+        (void) grain;
 //        #pragma message("omp::for_policy -> serial")
         for(index_t i = begin; i < end; i++)
             func(i);
@@ -81,6 +111,93 @@ struct sort_policy
     }
 };
 
+//---------------------------------------------------------------------------
+struct reduce_policy
+{
+    template <typename T, typename ChunkFunc, typename Combine>
+    inline T operator()(index_t begin, index_t end, const T &init,
+                        ChunkFunc &&chunk_func, Combine &&combine,
+                        index_t grain = 0)
+    {
+        if(begin >= end)
+            return init;
+#if defined(CONDUIT_USE_OPENMP)
+//        #pragma message("omp::reduce_policy -> OMP")
+        // one chunk per thread (or per grain items), partial results are
+        // combined in chunk order so the result does not depend on thread
+        // scheduling
+        const index_t n = end - begin;
+        const index_t nchunks = number_of_chunks(n, grain);
+        std::vector<T> partials(static_cast<size_t>(nchunks), init);
+        #pragma omp parallel for
+        for(index_t c = 0; c < nchunks; c++)
+        {
+            const index_t chunk_begin = begin + (n * c) / nchunks;
+            const index_t chunk_end   = begin + (n * (c + 1)) / nchunks;
+            partials[static_cast<size_t>(c)] = chunk_func(chunk_begin, chunk_end);
+        }
+        T res = init;
+        for(size_t c = 0; c < partials.size(); c++)
+            res = combine(res, partials[c]);
+        return res;
+#else
+//        #pragma message("omp::reduce_policy -> serial")
+        (void) grain;
+        return combine(init, chunk_func(begin, end));
+#endif
+    }
+};
+
+//---------------------------------------------------------------------------
+struct scan_policy
+{
+    template <typename T, typename ChunkReduce, typename ChunkScan, typename Combine>
+    inline T operator()(index_t begin, index_t end, const T &init,
+                        ChunkReduce &&chunk_reduce, ChunkScan &&chunk_scan,
+                        Combine &&combine, index_t grain = 0)
+    {
+        if(begin >= end)
+            return init;
+#if defined(CONDUIT_USE_OPENMP)
+        const index_t n = end - begin;
+        const index_t nchunks = number_of_chunks(n, grain);
+        if(nchunks == 1)
+            return chunk_scan(begin, end, init);
+        // pass 1: reduce each chunk
+        std::vector<T> partials(static_cast<size_t>(nchunks), init);
+        #pragma omp parallel for
+        for(index_t c = 0; c < nchunks; c++)
+        {
+            const index_t chunk_begin = begin + (n * c) / nchunks;
+            const index_t chunk_end   = begin + (n * (c + 1)) / nchunks;
+            partials[static_cast<size_t>(c)] = chunk_reduce(chunk_begin, chunk_end);
+        }
+        // exclusive scan of the chunk results gives each chunk's start value
+        T total = init;
+        for(size_t c = 0; c < partials.size(); c++)
+        {
+            T chunk_total = partials[c];
+            partials[c] = total;
+            total = combine(total, chunk_total);
+        }
+        // pass 2: scan each chunk from its start value
+        #pragma omp parallel for
+        for(index_t c = 0; c < nchunks; c++)
+        {
+            const index_t chunk_begin = begin + (n * c) / nchunks;
+            const index_t chunk_end   = begin + (n * (c + 1)) / nchunks;
+            chunk_scan(chunk_begin, chunk_end, partials[static_cast<size_t>(c)]);
+        }
+        return total;
+#else
+        (void) chunk_reduce;
+        (void) combine;
+        (void) grain;
+        return chunk_scan(begin, end, init);
+#endif
+    }
+};
+
 }
 //-----------------------------------------------------------------------------
 // -- end conduit::execution::omp --
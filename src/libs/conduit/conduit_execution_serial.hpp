@@ -16,6 +16,8 @@
 //-----------------------------------------------------------------------------
 #include "conduit.hpp"
 
+#include <algorithm>
+
 //-----------------------------------------------------------------------------
 // -- begin conduit --
 //-----------------------------------------------------------------------------
@@ -38,7 +40,8 @@ namespace seq
 struct for_policy
 {
     template <typename Func>
-    inline void operator()(index_t begin, index_t end, Func &&func)
+    inline void operator()(index_t begin, index_t end, Func &&func,
+                           index_t /*grain*/ = 0)
     {
         for(index_t i = begin; i < end; i++)
             func(i);
@@ -61,6 +64,34 @@ struct sort_policy
     }
 };
 
+//---------------------------------------------------------------------------
+struct reduce_policy
+{
+    template <typename T, typename ChunkFunc, typename Combine>
+    inline T operator()(index_t begin, index_t end, const T &init,
+                        ChunkFunc &&chunk_func, Combine &&combine,
+                        index_t /*grain*/ = 0)
+    {
+        if(begin >= end)
+            return init;
+        return combine(init, chunk_func(begin, end));
+    }
+};
+
+//---------------------------------------------------------------------------
+struct scan_policy
+{
+    template <typename T, typename ChunkReduce, typename ChunkScan, typename Combine>
+    inline T operator()(index_t begin, index_t end, const T &init,
+                        ChunkReduce &&/*chunk_reduce*/, ChunkScan &&chunk_scan,
+                        Combine &&/*combine*/, index_t /*grain*/ = 0)
+    {
+        if(begin >= end)
+            return init;
+        return chunk_scan(begin, end, init);
+    }
+};
+
 }
 //-----------------------------------------------------------------------------
 // -- end conduit::execution::seq --
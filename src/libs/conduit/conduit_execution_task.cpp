@@ -0,0 +1,417 @@
+// Copyright (c) Lawrence Livermore National Security, LLC and other Conduit
+// Project developers. See top-level LICENSE AND COPYRIGHT files for dates and
+// other details. No copyright assignment is required to contribute to Conduit.
+
+//-----------------------------------------------------------------------------
+///
+/// file: conduit_execution_task.cpp
+///
+//-----------------------------------------------------------------------------
+#include "conduit_execution_task.hpp"
+
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+//-----------------------------------------------------------------------------
+// -- begin conduit --
+//-----------------------------------------------------------------------------
+namespace conduit
+{
+
+//-----------------------------------------------------------------------------
+// -- begin conduit::execution --
+//-----------------------------------------------------------------------------
+namespace execution
+{
+
+//-----------------------------------------------------------------------------
+// -- begin conduit::execution::task --
+//-----------------------------------------------------------------------------
+namespace task
+{
+
+//-----------------------------------------------------------------------------
+// -- begin conduit::execution::task::detail --
+//-----------------------------------------------------------------------------
+namespace detail
+{
+
+// true while the current thread is running a task, nested calls to
+// run_tasks() run serially
+thread_local bool in_task = false;
+
+//---------------------------------------------------------------------------//
+// state for one run_tasks() call, shared with the worker threads
+//---------------------------------------------------------------------------//
+struct Job
+{
+    const std::function<void(index_t)> *task;
+    index_t                             num_tasks;
+    std::atomic<index_t>                next_task;
+    std::atomic<index_t>                num_done;
+    std::mutex                          error_mutex;
+    std::exception_ptr                  error;
+};
+
+//---------------------------------------------------------------------------//
+// runs unclaimed tasks of the given job until there are none left
+//---------------------------------------------------------------------------//
+static bool
+execute_tasks(Job &job)
+{
+    bool finished = false;
+    in_task = true;
+    for(;;)
+    {
+        const index_t idx = job.next_task.fetch_add(1);
+        if(idx >= job.num_tasks)
+        {
+            break;
+        }
+
+        try
+        {
+            (*job.task)(idx);
+        }
+        catch(...)
+        {
+            std::lock_guard<std::mutex> lock(job.error_mutex);
+            if(!job.error)
+            {
+                job.error = std::current_exception();
+            }
+        }
+
+        if(job.num_done.fetch_add(1) + 1 == job.num_tasks)
+        {
+            finished = true;
+        }
+    }
+    in_task = false;
+    return finished;
+}
+
+//-----------------------------------------------------------------------------
+// -- begin conduit::execution::task::detail::ThreadPool --
+//-----------------------------------------------------------------------------
+//
+// Simple thread pool: run() publishes a job, the calling thread and all
+// workers claim task indices from the job's shared counter until none are
+// left, so threads that finish early pick up the remaining work.
+//
+//-----------------------------------------------------------------------------
+class ThreadPool
+{
+public:
+    ThreadPool(index_t num_threads);
+    ~ThreadPool();
+
+    // includes the calling thread
+    index_t number_of_threads() const
+    { return (index_t) m_workers.size() + 1;}
+
+    void run(index_t num_tasks,
+             const std::function<void(index_t)> &task);
+
+private:
+    void worker_loop();
+
+    std::vector<std::thread>    m_workers;
+    // serializes run() calls
+    std::mutex                  m_run_mutex;
+    // guards m_job, m_job_id and m_shutdown
+    std::mutex                  m_mutex;
+    std::condition_variable     m_work_cv;
+    std::condition_variable     m_done_cv;
+    std::shared_ptr<Job>        m_job;
+    uint64                      m_job_id;
+    bool                        m_shutdown;
+};
+
+//---------------------------------------------------------------------------//
+ThreadPool::ThreadPool(index_t num_threads)
+: m_workers(),
+  m_job(),
+  m_job_id(0),
+  m_shutdown(false)
+{
+    for(index_t i = 1; i < num_threads; i++)
+    {
+        m_workers.push_back(std::thread(&ThreadPool::worker_loop, this));
+    }
+}
+
+//---------------------------------------------------------------------------//
+ThreadPool::~ThreadPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_shutdown = true;
+    }
+    m_work_cv.notify_all();
+    for(size_t i = 0; i < m_workers.size(); i++)
+    {
+        m_workers[i].join();
+    }
+}
+
+//---------------------------------------------------------------------------//
+void
+ThreadPool::run(index_t num_tasks,
+                const std::function<void(index_t)> &task)
+{
+    std::unique_lock<std::mutex> run_lock(m_run_mutex, std::try_to_lock);
+    // if another thread is using the pool, run on this thread
+    if(!run_lock.owns_lock() || m_workers.empty())
+    {
+        Job job;
+        job.task      = &task;
+        job.num_tasks = num_tasks;
+        job.next_task = 0;
+        job.num_done  = 0;
+        execute_tasks(job);
+        if(job.error)
+        {
+            std::rethrow_exception(job.error);
+        }
+        return;
+    }
+
+    std::shared_ptr<Job> job = std::make_shared<Job>();
+    job->task      = &task;
+    job->num_tasks = num_tasks;
+    job->next_task = 0;
+    job->num_done  = 0;
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_job = job;
+        m_job_id++;
+    }
+    m_work_cv.notify_all();
+
+    // the calling thread works too
+    execute_tasks(*job);
+
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_done_cv.wait(lock, [&]{ return job->num_done == job->num_tasks;});
+        m_job.reset();
+    }
+
+    if(job->error)
+    {
+        std::rethrow_exception(job->error);
+    }
+}
+
+//---------------------------------------------------------------------------//
+void
+ThreadPool::worker_loop()
+{
+    uint64 seen_job_id = 0;
+    for(;;)
+    {
+        std::shared_ptr<Job> job;
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_work_cv.wait(lock, [&]{ return m_shutdown ||
+                                             m_job_id != seen_job_id;});
+            if(m_shutdown)
+            {
+                return;
+            }
+            seen_job_id = m_job_id;
+            job = m_job;
+        }
+
+        // (the job may already be complete)
+        if(job && execute_tasks(*job))
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_done_cv.notify_all();
+        }
+    }
+}
+//-----------------------------------------------------------------------------
+// -- end conduit::execution::task::detail::ThreadPool --
+//-----------------------------------------------------------------------------
+
+//---------------------------------------------------------------------------//
+// executor state
+//---------------------------------------------------------------------------//
+struct ExecutorState
+{
+    std::mutex                  mutex;
+    std::shared_ptr<ThreadPool> pool;
+    index_t                     num_threads = 1;
+    TaskExecutor                executor;
+    index_t                     num_workers = 1;
+};
+
+//---------------------------------------------------------------------------//
+static ExecutorState &
+executor_state()
+{
+    static ExecutorState state;
+    return state;
+}
+
+}
+//-----------------------------------------------------------------------------
+// -- end conduit::execution::task::detail --
+//-----------------------------------------------------------------------------
+
+//---------------------------------------------------------------------------//
+void
+set_task_executor(const TaskExecutor &executor,
+                  index_t num_workers)
+{
+    detail::ExecutorState &state = detail::executor_state();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    state.executor    = executor;
+    state.num_workers = num_workers > 0 ? num_workers : 1;
+}
+
+//---------------------------------------------------------------------------//
+void
+reset_task_executor()
+{
+    detail::ExecutorState &state = detail::executor_state();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    state.executor    = TaskExecutor();
+    state.num_workers = 1;
+}
+
+//---------------------------------------------------------------------------//
+bool
+has_task_executor()
+{
+    detail::ExecutorState &state = detail::executor_state();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    return (bool) state.executor;
+}
+
+//---------------------------------------------------------------------------//
+void
+set_number_of_threads(index_t num_threads)
+{
+    if(num_threads < 1)
+    {
+        CONDUIT_ERROR("set_number_of_threads: number of threads must be "
+                      "at least 1 (passed " << num_threads << ")");
+    }
+
+    detail::ExecutorState &state = detail::executor_state();
+    std::shared_ptr<detail::ThreadPool> old_pool;
+    {
+        std::lock_guard<std::mutex> lock(state.mutex);
+        state.num_threads = num_threads;
+        // the pool is (re)created on first use
+        old_pool.swap(state.pool);
+    }
+    // (old workers are joined once any in-flight run() completes)
+}
+
+//---------------------------------------------------------------------------//
+index_t
+number_of_workers()
+{
+    detail::ExecutorState &state = detail::executor_state();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    if(state.executor)
+    {
+        return state.num_workers;
+    }
+    return state.num_threads;
+}
+
+//---------------------------------------------------------------------------//
+void
+run_tasks(index_t num_tasks,
+          const std::function<void(index_t)> &task)
+{
+    if(num_tasks <= 0)
+    {
+        return;
+    }
+
+    // nested calls and single tasks run serially on this thread
+    if(detail::in_task || num_tasks == 1)
+    {
+        for(index_t i = 0; i < num_tasks; i++)
+        {
+            task(i);
+        }
+        return;
+    }
+
+    detail::ExecutorState &state = detail::executor_state();
+    TaskExecutor executor;
+    std::shared_ptr<detail::ThreadPool> pool;
+    {
+        std::lock_guard<std::mutex> lock(state.mutex);
+        if(state.executor)
+        {
+            executor = state.executor;
+        }
+        else
+        {
+            if(!state.pool && state.num_threads > 1)
+            {
+                state.pool = std::make_shared<detail::ThreadPool>(state.num_threads);
+            }
+            pool = state.pool;
+        }
+    }
+
+    if(executor)
+    {
+        // mark tasks so nested calls run serially on the executor's threads
+        executor(num_tasks, [&task](index_t idx)
+        {
+            bool prev_in_task = detail::in_task;
+            detail::in_task = true;
+            try
+            {
+                task(idx);
+            }
+            catch(...)
+            {
+                detail::in_task = prev_in_task;
+                throw;
+            }
+            detail::in_task = prev_in_task;
+        });
+    }
+    else if(pool)
+    {
+        pool->run(num_tasks, task);
+    }
+    else
+    {
+        for(index_t i = 0; i < num_tasks; i++)
+        {
+            task(i);
+        }
+    }
+}
+
+}
+//-----------------------------------------------------------------------------
+// -- end conduit::execution::task --
+//-----------------------------------------------------------------------------
+
+}
+//-----------------------------------------------------------------------------
+// -- end conduit::execution --
+//-----------------------------------------------------------------------------
+
+}
+//-----------------------------------------------------------------------------
+// -- end conduit:: --
+//-----------------------------------------------------------------------------
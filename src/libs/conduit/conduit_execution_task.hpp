@@ -0,0 +1,272 @@
+// Copyright (c) Lawrence Livermore National Security, LLC and other Conduit
+// Project developers. See top-level LICENSE AND COPYRIGHT files for dates and
+// other details. No copyright assignment is required to contribute to Conduit.
+
+//-----------------------------------------------------------------------------
+///
+/// file: conduit_execution_task.hpp
+///
+//-----------------------------------------------------------------------------
+
+#ifndef CONDUIT_EXECUTION_TASK_HPP
+#define CONDUIT_EXECUTION_TASK_HPP
+
+//-----------------------------------------------------------------------------
+// conduit lib includes
+//-----------------------------------------------------------------------------
+#include "conduit.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <vector>
+
+//-----------------------------------------------------------------------------
+// -- begin conduit --
+//-----------------------------------------------------------------------------
+namespace conduit
+{
+
+//-----------------------------------------------------------------------------
+// -- begin conduit::execution --
+//-----------------------------------------------------------------------------
+namespace execution
+{
+
+//-----------------------------------------------------------------------------
+// -- begin conduit::execution::task --
+//-----------------------------------------------------------------------------
+///
+/// Task based execution: work is split into chunks that are run by a task
+/// executor. By default this is a built-in thread pool, where idle threads
+/// claim the next unclaimed chunk (so uneven chunks balance across threads).
+/// The built-in pool starts out with a single thread (everything runs on
+/// the calling thread), use set_number_of_threads() to enable threading.
+///
+/// Applications that manage their own threads can route conduit's tasks
+/// to their own scheduler with set_task_executor().
+///
+//-----------------------------------------------------------------------------
+namespace task
+{
+
+/// runs task(i) for i in [0, num_tasks), possibly concurrently,
+/// and returns once all tasks are complete
+typedef std::function<void(index_t num_tasks,
+                           const std::function<void(index_t)> &task)>
+        TaskExecutor;
+
+/// installs an executor used to run all tasks. `num_workers` is the
+/// number of tasks the executor can run concurrently, it is used to
+/// decide how work is split.
+void CONDUIT_API set_task_executor(const TaskExecutor &executor,
+                                   index_t num_workers);
+
+/// switches back to the built-in thread pool
+void CONDUIT_API reset_task_executor();
+
+/// returns true if a custom task executor is installed
+bool CONDUIT_API has_task_executor();
+
+/// sets the number of threads used by the built-in thread pool
+/// (including the calling thread)
+void CONDUIT_API set_number_of_threads(index_t num_threads);
+
+/// number of tasks that can run concurrently with the active executor
+index_t CONDUIT_API number_of_workers();
+
+/// runs task(i) for i in [0, num_tasks) using the active executor.
+/// Exceptions thrown by tasks are passed on to the caller (after all
+/// tasks complete). Calls made from inside a task run serially.
+void CONDUIT_API run_tasks(index_t num_tasks,
+                           const std::function<void(index_t)> &task);
+
+//---------------------------------------------------------------------------
+/// returns the number of chunks used to split n items, given a grain
+/// size hint (the minimum number of items per chunk, 0 for automatic)
+inline index_t
+number_of_chunks(index_t n, index_t grain)
+{
+    if(n <= 0)
+        return 0;
+    const index_t workers = number_of_workers();
+    if(workers <= 1)
+        return 1;
+    // by default, use a few chunks per worker so uneven work balances
+    if(grain <= 0)
+        grain = std::max<index_t>(1, n / (4 * workers));
+    return std::max<index_t>(1, (n + grain - 1) / grain);
+}
+
+//---------------------------------------------------------------------------
+struct for_policy
+{
+    template <typename Func>
+    inline void operator()(index_t begin, index_t end, Func &&func,
+                           index_t grain = 0)
+    {
+        const index_t n = end - begin;
+        const index_t nchunks = number_of_chunks(n, grain);
+        if(nchunks <= 1)
+        {
+            for(index_t i = begin; i < end; i++)
+                func(i);
+            return;
+        }
+        run_tasks(nchunks, [&](index_t c)
+        {
+            const index_t chunk_begin = begin + (n * c) / nchunks;
+            const index_t chunk_end   = begin + (n * (c + 1)) / nchunks;
+            for(index_t i = chunk_begin; i < chunk_end; i++)
+                func(i);
+        });
+    }
+};
+
+//---------------------------------------------------------------------------
+struct reduce_policy
+{
+    template <typename T, typename ChunkFunc, typename Combine>
+    inline T operator()(index_t begin, index_t end, const T &init,
+                        ChunkFunc &&chunk_func, Combine &&combine,
+                        index_t grain = 0)
+    {
+        const index_t n = end - begin;
+        const index_t nchunks = number_of_chunks(n, grain);
+        if(nchunks == 0)
+            return init;
+        if(nchunks == 1)
+            return combine(init, chunk_func(begin, end));
+
+        // partial results are combined in chunk order
+        std::vector<T> partials(static_cast<size_t>(nchunks), init);
+        run_tasks(nchunks, [&](index_t c)
+        {
+            const index_t chunk_begin = begin + (n * c) / nchunks;
+            const index_t chunk_end   = begin + (n * (c + 1)) / nchunks;
+            partials[static_cast<size_t>(c)] = chunk_func(chunk_begin, chunk_end);
+        });
+        T res = init;
+        for(size_t c = 0; c < partials.size(); c++)
+            res = combine(res, partials[c]);
+        return res;
+    }
+};
+
+//---------------------------------------------------------------------------
+struct scan_policy
+{
+    template <typename T, typename ChunkReduce, typename ChunkScan, typename Combine>
+    inline T operator()(index_t begin, index_t end, const T &init,
+                        ChunkReduce &&chunk_reduce, ChunkScan &&chunk_scan,
+                        Combine &&combine, index_t grain = 0)
+    {
+        const index_t n = end - begin;
+        const index_t nchunks = number_of_chunks(n, grain);
+        if(nchunks == 0)
+            return init;
+        if(nchunks == 1)
+            return chunk_scan(begin, end, init);
+
+        // pass 1: reduce each chunk
+        std::vector<T> partials(static_cast<size_t>(nchunks), init);
+        run_tasks(nchunks, [&](index_t c)
+        {
+            const index_t chunk_begin = begin + (n * c) / nchunks;
+            const index_t chunk_end   = begin + (n * (c + 1)) / nchunks;
+            partials[static_cast<size_t>(c)] = chunk_reduce(chunk_begin, chunk_end);
+        });
+        // exclusive scan of the chunk results gives each chunk's start value
+        T total = init;
+        for(size_t c = 0; c < partials.size(); c++)
+        {
+            T chunk_total = partials[c];
+            partials[c] = total;
+            total = combine(total, chunk_total);
+        }
+        // pass 2: scan each chunk from its start value
+        run_tasks(nchunks, [&](index_t c)
+        {
+            const index_t chunk_begin = begin + (n * c) / nchunks;
+            const index_t chunk_end   = begin + (n * (c + 1)) / nchunks;
+            chunk_scan(chunk_begin, chunk_end, partials[static_cast<size_t>(c)]);
+        });
+        return total;
+    }
+};
+
+//---------------------------------------------------------------------------
+struct sort_policy
+{
+    template <typename Iterator>
+    inline void operator()(Iterator begin, Iterator end)
+    {
+        this->operator()(begin, end, [](const typename std::iterator_traits<Iterator>::value_type &lhs,
+                                        const typename std::iterator_traits<Iterator>::value_type &rhs)
+                                     { return lhs < rhs; });
+    }
+
+    /// sorts chunks in parallel, then merges pairs of sorted runs
+    /// (in parallel) until one run remains
+    template <typename Iterator, typename Predicate>
+    inline void operator()(Iterator begin, Iterator end, Predicate &&predicate)
+    {
+        const index_t n = static_cast<index_t>(end - begin);
+        // sorting small ranges is not worth splitting up
+        const index_t min_chunk = 4096;
+        index_t nchunks = std::min(number_of_workers(), n / min_chunk);
+        if(nchunks <= 1)
+        {
+            std::sort(begin, end, predicate);
+            return;
+        }
+
+        std::vector<index_t> bounds(static_cast<size_t>(nchunks + 1));
+        for(index_t c = 0; c <= nchunks; c++)
+            bounds[static_cast<size_t>(c)] = (n * c) / nchunks;
+
+        run_tasks(nchunks, [&](index_t c)
+        {
+            std::sort(begin + bounds[static_cast<size_t>(c)],
+                      begin + bounds[static_cast<size_t>(c + 1)],
+                      predicate);
+        });
+
+        // merge neighboring runs, each pass halves the number of runs
+        while(bounds.size() > 2)
+        {
+            const index_t nruns = static_cast<index_t>(bounds.size()) - 1;
+            const index_t nmerges = nruns / 2;
+            run_tasks(nmerges, [&](index_t m)
+            {
+                std::inplace_merge(begin + bounds[static_cast<size_t>(2 * m)],
+                                   begin + bounds[static_cast<size_t>(2 * m + 1)],
+                                   begin + bounds[static_cast<size_t>(2 * m + 2)],
+                                   predicate);
+            });
+            std::vector<index_t> merged_bounds;
+            for(size_t b = 0; b < bounds.size(); b += 2)
+                merged_bounds.push_back(bounds[b]);
+            if(merged_bounds.back() != bounds.back())
+                merged_bounds.push_back(bounds.back());
+            bounds.swap(merged_bounds);
+        }
+    }
+};
+
+}
+//-----------------------------------------------------------------------------
+// -- end conduit::execution::task --
+//-----------------------------------------------------------------------------
+
+}
+//-----------------------------------------------------------------------------
+// -- end conduit::execution --
+//-----------------------------------------------------------------------------
+
+}
+//-----------------------------------------------------------------------------
+// -- end conduit:: --
+//-----------------------------------------------------------------------------
+
+#endif
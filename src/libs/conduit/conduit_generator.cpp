@@ -15,6 +15,10 @@
 //-----------------------------------------------------------------------------
 #include <stdio.h>
 #include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <map>
+#include <chrono>
 
 //-----------------------------------------------------------------------------
 // -- json includes and namespace --
@@ -41,6 +45,7 @@
 //-----------------------------------------------------------------------------
 #include "conduit_error.hpp"
 #include "conduit_utils.hpp"
+#include "conduit_instrumentation.hpp"
 
 
 //-----------------------------------------------------------------------------
@@ -122,6 +127,17 @@ public:
 
     static index_t parse_leaf_dtype_name(const std::string &dtype_name);
 
+//-----------------------------------------------------------------------------
+// Shared streaming helpers
+//-----------------------------------------------------------------------------
+    // appends a new child to a list node and returns it
+    static Node *append_list_child(Node *node, Schema *schema);
+
+    // holds the leaves of a sequence while they form a homogenous
+    // numeric array, so the streaming parsers can create the final
+    // leaf without a document tree
+    class NumericSequenceBuffer;
+
 //-----------------------------------------------------------------------------
 // Generator::Parser::JSON handles parsing via rapidjson.
 // We want to isolate the conduit API from the rapidjson headers
@@ -209,6 +225,9 @@ public:
     static void    parse_error_details(const std::string &json,
                                        const conduit_json::Document &document,
                                        std::ostream &os);
+
+    // parses pure json directly into a node (see Generator::set_streaming)
+    class StreamParser;
   };
 //-----------------------------------------------------------------------------
 // Generator::Parser::YAML handles parsing via libyaml.
@@ -369,6 +388,10 @@ public:
     static void    parse_error_details(yaml_parser_t *yaml_parser,
                                        std::ostream &os);
 
+    // parses pure yaml from libyaml events directly into a node
+    // (see Generator::set_streaming)
+    class StreamParser;
+
   };
 
 };
@@ -468,6 +491,219 @@ Generator::Parser::parse_leaf_dtype_name(const std::string &dtype_name)
 }
 
 
+//---------------------------------------------------------------------------//
+Node *
+Generator::Parser::append_list_child(Node *node,
+                                     Schema *schema)
+{
+    Schema *curr_schema = &schema->append();
+    Node *curr_node = node->create_child_node(curr_schema);
+    node->append_node_ptr(curr_node);
+    return curr_node;
+}
+
+//-----------------------------------------------------------------------------
+// -- begin conduit::Generator::Parser::NumericSequenceBuffer --
+//-----------------------------------------------------------------------------
+//
+// Values are kept as raw 64-bit patterns. While all values are int64s we
+// don't track per value kinds, so the common case is a single memcpy into
+// the final leaf.
+//
+//-----------------------------------------------------------------------------
+class Generator::Parser::NumericSequenceBuffer
+{
+public:
+    enum Kind
+    {
+        INT64_KIND = 0,
+        UINT64_KIND,
+        FLOAT64_KIND,
+        // a string that holds a number (nan, inf, etc)
+        STRING_KIND
+    };
+
+    NumericSequenceBuffer();
+
+    void    clear();
+    index_t size() const
+    { return (index_t)m_vals.size(); }
+
+    void    append_int64(int64 value);
+    void    append_uint64(uint64 value);
+    void    append_float64(float64 value);
+    void    append_string(const std::string &value,
+                          float64 fvalue);
+
+    // sets node to an int64 array, or a float64 array if any
+    // of the values are floating point
+    void    to_leaf(Node &node) const;
+
+    // appends the values as list children of node, used when a sequence
+    // turns out not to be a homogenous numeric array
+    void    to_list(Node &node,
+                    Schema &schema) const;
+
+private:
+    void    append(uint64 bits,
+                   Kind kind);
+
+    std::vector<uint64>      m_vals;
+    // empty while all values are int64s
+    std::vector<uint8>       m_kinds;
+    std::vector<std::string> m_strings;
+    bool                     m_has_float;
+};
+
+//---------------------------------------------------------------------------//
+Generator::Parser::NumericSequenceBuffer::NumericSequenceBuffer()
+: m_vals(),
+  m_kinds(),
+  m_strings(),
+  m_has_float(false)
+{}
+
+//---------------------------------------------------------------------------//
+void
+Generator::Parser::NumericSequenceBuffer::clear()
+{
+    // keep capacity, the buffer is reused for every sequence
+    m_vals.clear();
+    m_kinds.clear();
+    m_strings.clear();
+    m_has_float = false;
+}
+
+//---------------------------------------------------------------------------//
+void
+Generator::Parser::NumericSequenceBuffer::append(uint64 bits,
+                                                 Kind kind)
+{
+    if(kind != INT64_KIND && m_kinds.empty())
+    {
+        m_kinds.resize(m_vals.size(),(uint8)INT64_KIND);
+    }
+
+    m_vals.push_back(bits);
+
+    if(kind != INT64_KIND || !m_kinds.empty())
+    {
+        m_kinds.push_back((uint8)kind);
+    }
+}
+
+//---------------------------------------------------------------------------//
+void
+Generator::Parser::NumericSequenceBuffer::append_int64(int64 value)
+{
+    append((uint64)value,INT64_KIND);
+}
+
+//---------------------------------------------------------------------------//
+void
+Generator::Parser::NumericSequenceBuffer::append_uint64(uint64 value)
+{
+    append(value,UINT64_KIND);
+}
+
+//---------------------------------------------------------------------------//
+void
+Generator::Parser::NumericSequenceBuffer::append_float64(float64 value)
+{
+    uint64 bits;
+    memcpy(&bits,&value,sizeof(uint64));
+    append(bits,FLOAT64_KIND);
+    m_has_float = true;
+}
+
+//---------------------------------------------------------------------------//
+void
+Generator::Parser::NumericSequenceBuffer::append_string(const std::string &value,
+                                                        float64 fvalue)
+{
+    uint64 bits;
+    memcpy(&bits,&fvalue,sizeof(uint64));
+    append(bits,STRING_KIND);
+    m_strings.push_back(value);
+    m_has_float = true;
+}
+
+//---------------------------------------------------------------------------//
+void
+Generator::Parser::NumericSequenceBuffer::to_leaf(Node &node) const
+{
+    index_t num_vals = size();
+
+    if(!m_has_float)
+    {
+        // int64 and uint64 values share the same bits
+        node.set(DataType::int64(num_vals));
+        if(num_vals > 0)
+        {
+            memcpy(node.data_ptr(),m_vals.data(),sizeof(int64) * num_vals);
+        }
+        return;
+    }
+
+    node.set(DataType::float64(num_vals));
+    float64 *res = (float64*)node.data_ptr();
+    for(index_t i = 0; i < num_vals; i++)
+    {
+        const uint64 bits = m_vals[i];
+        switch(m_kinds[i])
+        {
+            case INT64_KIND:
+                res[i] = (float64)(int64)bits;
+                break;
+            case UINT64_KIND:
+                res[i] = (float64)bits;
+                break;
+            default: // FLOAT64_KIND, STRING_KIND
+                memcpy(&res[i],&bits,sizeof(float64));
+                break;
+        }
+    }
+}
+
+//---------------------------------------------------------------------------//
+void
+Generator::Parser::NumericSequenceBuffer::to_list(Node &node,
+                                                  Schema &schema) const
+{
+    index_t num_vals = size();
+    size_t  str_idx  = 0;
+    for(index_t i = 0; i < num_vals; i++)
+    {
+        Node *curr_node = append_list_child(&node,&schema);
+        const uint64 bits = m_vals[i];
+        const uint8  kind = m_kinds.empty() ? (uint8)INT64_KIND : m_kinds[i];
+        if(kind == INT64_KIND)
+        {
+            curr_node->set((int64)bits);
+        }
+        else if(kind == UINT64_KIND)
+        {
+            curr_node->set(bits);
+        }
+        else if(kind == FLOAT64_KIND)
+        {
+            float64 fval;
+            memcpy(&fval,&bits,sizeof(float64));
+            curr_node->set(fval);
+        }
+        else // STRING_KIND
+        {
+            curr_node->set(m_strings[str_idx]);
+            str_idx++;
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+// -- end conduit::Generator::Parser::NumericSequenceBuffer --
+//-----------------------------------------------------------------------------
+
+
 //-----------------------------------------------------------------------------
 // -- begin conduit::Generator::Parser::JSON --
 //-----------------------------------------------------------------------------
@@ -1258,9 +1494,7 @@ Generator::Parser::JSON::walk_pure_json_schema(Node *node,
 
             Schema *curr_schema = &schema->add_child(entry_name);
 
-            Node *curr_node = new Node();
-            curr_node->set_schema_ptr(curr_schema);
-            curr_node->set_parent(node);
+            Node *curr_node = node->create_child_node(curr_schema);
             node->append_node_ptr(curr_node);
 
             walk_pure_json_schema(curr_node,
@@ -1295,9 +1529,7 @@ Generator::Parser::JSON::walk_pure_json_schema(Node *node,
             {
                 schema->append();
                 Schema *curr_schema = schema->child_ptr(i);
-                Node * curr_node = new Node();
-                curr_node->set_schema_ptr(curr_schema);
-                curr_node->set_parent(node);
+                Node *curr_node = node->create_child_node(curr_schema);
                 node->append_node_ptr(curr_node);
                 walk_pure_json_schema(curr_node,curr_schema,jvalue[i]);
             }
@@ -1399,9 +1631,7 @@ Generator::Parser::JSON::walk_json_schema(Node   *node,
                 {
                     schema->append();
                     Schema *curr_schema = schema->child_ptr(i);
-                    Node *curr_node = new Node();
-                    curr_node->set_schema_ptr(curr_schema);
-                    curr_node->set_parent(node);
+                    Node *curr_node = node->create_child_node(curr_schema);
                     node->append_node_ptr(curr_node);
                     walk_json_schema(curr_node,
                                      curr_schema,
@@ -1487,9 +1717,7 @@ Generator::Parser::JSON::walk_json_schema(Node   *node,
                 }
 
                 Schema *curr_schema = &schema->add_child(entry_name);
-                Node *curr_node = new Node();
-                curr_node->set_schema_ptr(curr_schema);
-                curr_node->set_parent(node);
+                Node *curr_node = node->create_child_node(curr_schema);
                 node->append_node_ptr(curr_node);
                 walk_json_schema(curr_node,
                                  curr_schema,
@@ -1513,9 +1741,7 @@ Generator::Parser::JSON::walk_json_schema(Node   *node,
         {
             schema->append();
             Schema *curr_schema = schema->child_ptr(i);
-            Node *curr_node = new Node();
-            curr_node->set_schema_ptr(curr_schema);
-            curr_node->set_parent(node);
+            Node *curr_node = node->create_child_node(curr_schema);
             node->append_node_ptr(curr_node);
             walk_json_schema(curr_node,
                              curr_schema,
@@ -1604,9 +1830,7 @@ Generator::Parser::JSON::walk_json_schema_external(Node   *node,
                 {
                     schema->append();
                     Schema *curr_schema = schema->child_ptr(i);
-                    Node *curr_node = new Node();
-                    curr_node->set_schema_ptr(curr_schema);
-                    curr_node->set_parent(node);
+                    Node *curr_node = node->create_child_node(curr_schema);
                     node->append_node_ptr(curr_node);
                     walk_json_schema_external(curr_node,
                                               curr_schema,
@@ -1684,9 +1908,7 @@ Generator::Parser::JSON::walk_json_schema_external(Node   *node,
 
                 Schema *curr_schema = &schema->add_child(entry_name);
                 
-                Node *curr_node = new Node();
-                curr_node->set_schema_ptr(curr_schema);
-                curr_node->set_parent(node);
+                Node *curr_node = node->create_child_node(curr_schema);
                 node->append_node_ptr(curr_node);
                 walk_json_schema_external(curr_node,
                                           curr_schema,
@@ -1710,9 +1932,7 @@ Generator::Parser::JSON::walk_json_schema_external(Node   *node,
         {
             schema->append();
             Schema *curr_schema = schema->child_ptr(i);
-            Node *curr_node = new Node();
-            curr_node->set_schema_ptr(curr_schema);
-            curr_node->set_parent(node);
+            Node *curr_node = node->create_child_node(curr_schema);
             node->append_node_ptr(curr_node);
             walk_json_schema_external(curr_node,
                                       curr_schema,
@@ -1844,149 +2064,862 @@ Generator::Parser::JSON::parse_error_details(const std::string &json,
 
 
 //-----------------------------------------------------------------------------
-// -- end conduit::Generator::Parser::JSON --
-//-----------------------------------------------------------------------------
-
+// -- begin conduit::Generator::Parser::JSON::StreamParser --
 //-----------------------------------------------------------------------------
-// -- begin conduit::Generator::YAML --
+//
+// Recursive descent parser that creates nodes as it reads the json text.
+// It follows the same rules as walk_pure_json_schema, and also accepts
+// what utils::json_sanitize() handles for the DOM path: '//' comments and
+// unquoted words (nan, inf, etc), which are read as strings.
+//
 //-----------------------------------------------------------------------------
+class Generator::Parser::JSON::StreamParser
+{
+public:
+    StreamParser(const std::string &json);
 
+    void parse(Node &node);
 
-//-----------------------------------------------------------------------------
-// -- begin conduit::Generator::YAML::YAMLParserWrapper --
-//-----------------------------------------------------------------------------
+private:
+    enum NumberKind
+    {
+        INT64_NUMBER,
+        UINT64_NUMBER,
+        FLOAT64_NUMBER
+    };
 
+    void        parse_value(Node *node,
+                            Schema *schema);
+    void        parse_object(Node *node,
+                             Schema *schema);
+    void        parse_array(Node *node,
+                            Schema *schema);
+
+    void        parse_string(std::string &res);
+    // reads an unquoted word
+    void        parse_word(std::string &res);
+    // true, false, and null are literals, other words are strings
+    static void set_word(Node *node,
+                         const std::string &word);
+    static bool is_literal(const std::string &word)
+    { return word == "true" || word == "false" || word == "null"; }
+    NumberKind  parse_number(int64 &ival,
+                             uint64 &uval,
+                             float64 &fval);
+
+    // skips whitespace and '//' comments
+    void        skip_whitespace();
+
+    static bool is_word_start(char c)
+    { return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || c == '_'; }
+    static bool is_digit(char c)
+    { return c >= '0' && c <= '9'; }
+
+    void        error(const std::string &msg) const;
+
+    const std::string     &m_json;
+    const char            *m_ptr;
+    // std::string data is null terminated, m_end points to the null
+    const char            *m_end;
+    std::string            m_str;
+    NumericSequenceBuffer  m_seq;
+};
 
 //---------------------------------------------------------------------------//
-Generator::Parser::YAML::YAMLParserWrapper::YAMLParserWrapper()
-: m_yaml_parser_is_valid(false),
-  m_yaml_doc_is_valid(false)
-{
-
-}
+Generator::Parser::JSON::StreamParser::StreamParser(const std::string &json)
+: m_json(json),
+  m_ptr(json.c_str()),
+  m_end(json.c_str() + json.size()),
+  m_str(),
+  m_seq()
+{}
 
 //---------------------------------------------------------------------------//
-Generator::Parser::YAML::YAMLParserWrapper::~YAMLParserWrapper()
+void
+Generator::Parser::JSON::StreamParser::parse(Node &node)
 {
-    // cleanup!
-    if(m_yaml_parser_is_valid)
+    skip_whitespace();
+    if(m_ptr == m_end)
     {
-        yaml_parser_delete(&m_yaml_parser);
+        error("The document is empty.");
     }
 
-    if(m_yaml_doc_is_valid)
+    parse_value(&node,node.schema_ptr());
+
+    skip_whitespace();
+    if(m_ptr != m_end)
     {
-        yaml_document_delete(&m_yaml_doc);
+        error("The document root must not be followed by other values.");
     }
 }
 
 //---------------------------------------------------------------------------//
 void
-Generator::Parser::YAML::YAMLParserWrapper::parse(const char *yaml_txt)
+Generator::Parser::JSON::StreamParser::parse_value(Node *node,
+                                                   Schema *schema)
 {
-    // Initialize parser
-    if(yaml_parser_initialize(&m_yaml_parser) == 0)
+    const char c = *m_ptr;
+    if(c == '{')
     {
-        // error!
-        CONDUIT_ERROR("yaml_parser_initialize failed");
+        parse_object(node,schema);
     }
-    else
+    else if(c == '[')
     {
-        m_yaml_parser_is_valid = true;
+        parse_array(node,schema);
     }
-
-    // set input
-    yaml_parser_set_input_string(&m_yaml_parser,
-                                 (const unsigned char*)yaml_txt,
-                                 strlen(yaml_txt));
-
-    // use parser to construct document
-    if( yaml_parser_load(&m_yaml_parser, &m_yaml_doc) == 0 )
+    else if(c == '"')
     {
-        CONDUIT_YAML_PARSE_ERROR(&m_yaml_doc,
-                                 &m_yaml_parser);
+        parse_string(m_str);
+        node->set(m_str);
+    }
+    else if(c == '-' || is_digit(c))
+    {
+        int64   ival = 0;
+        uint64  uval = 0;
+        float64 fval = 0.0;
+        // use 64bit types by default ...
+        switch(parse_number(ival,uval,fval))
+        {
+            case INT64_NUMBER:
+                node->set(ival);
+                break;
+            case UINT64_NUMBER:
+                node->set(uval);
+                break;
+            default:
+                node->set(fval);
+                break;
+        }
+    }
+    else if(is_word_start(c))
+    {
+        parse_word(m_str);
+        set_word(node,m_str);
     }
     else
     {
-        m_yaml_doc_is_valid = true;
+        error("Invalid value.");
     }
 }
 
 //---------------------------------------------------------------------------//
-yaml_document_t *
-Generator::Parser::YAML::YAMLParserWrapper::yaml_doc_ptr()
+void
+Generator::Parser::JSON::StreamParser::parse_object(Node *node,
+                                                    Schema *schema)
 {
-    yaml_document_t *res = NULL;
-
-    if(m_yaml_doc_is_valid)
+    // skip '{'
+    m_ptr++;
+    // if we make it here and have an empty json object
+    // we still want the conduit node to take on the
+    // object role
+    schema->set(DataType::object());
+
+    skip_whitespace();
+    if(*m_ptr == '}')
     {
-        res = &m_yaml_doc;
+        m_ptr++;
+        return;
     }
 
-    return res;
-}
+    for(;;)
+    {
+        if(*m_ptr == '"')
+        {
+            parse_string(m_str);
+        }
+        else if(is_word_start(*m_ptr))
+        {
+            parse_word(m_str);
+        }
+        else
+        {
+            error("Missing a name for object member.");
+        }
 
-//---------------------------------------------------------------------------//
-yaml_node_t *
-Generator::Parser::YAML::YAMLParserWrapper::yaml_doc_root_ptr()
-{
-    yaml_node_t *res = NULL;
+        skip_whitespace();
+        if(*m_ptr != ':')
+        {
+            error("Missing a colon after a name of object member.");
+        }
+        m_ptr++;
+        skip_whitespace();
 
-    if(m_yaml_doc_is_valid)
-    {
-        res = yaml_document_get_root_node(&m_yaml_doc);
-    }
+        // duplicate object names are most likely a typo,
+        // so it's best to throw an error
+        if(schema->has_child(m_str))
+        {
+            CONDUIT_ERROR("JSON Generator error:\n"
+                          << "Duplicate JSON object name: "
+                          << utils::join_path(node->path(),m_str));
+        }
 
-    return res;
-}
+        Schema *curr_schema = &schema->add_child(m_str);
+        Node *curr_node = node->create_child_node(curr_schema);
+        node->append_node_ptr(curr_node);
 
-//-----------------------------------------------------------------------------
-// -- end conduit::Generator::YAML::YAMLParserWrapper --
-//-----------------------------------------------------------------------------
+        parse_value(curr_node,curr_schema);
 
-//---------------------------------------------------------------------------//
-index_t 
-Generator::Parser::YAML::yaml_leaf_to_numeric_dtype(const char *txt_value)
-{
-    index_t res = DataType::EMPTY_ID;
-    if(string_is_integer(txt_value))
-    {
-        res = DataType::INT64_ID;
-    }
-    else if(string_is_double(txt_value))
-    {
-        res = DataType::FLOAT64_ID;
+        skip_whitespace();
+        if(*m_ptr == ',')
+        {
+            m_ptr++;
+            skip_whitespace();
+        }
+        else if(*m_ptr == '}')
+        {
+            m_ptr++;
+            return;
+        }
+        else
+        {
+            error("Missing a comma or '}' after an object member.");
+        }
     }
-    //else, already inited to DataType::EMPTY_ID
-
-    return res;
 }
 
 //---------------------------------------------------------------------------//
-bool
-Generator::Parser::YAML::check_yaml_is_number(const yaml_node_t *yaml_node)
+void
+Generator::Parser::JSON::StreamParser::parse_array(Node *node,
+                                                   Schema *schema)
 {
-    if (check_yaml_is_scalar_node(yaml_node))
+    // skip '['
+    m_ptr++;
+
+    skip_whitespace();
+    if(*m_ptr == ']')
     {
-        const char *yaml_value_str = get_yaml_string(yaml_node);
-        return string_is_integer(yaml_value_str) || string_is_double(yaml_value_str);
+        m_ptr++;
+        // if we make it here and have an empty json list
+        // we still want the conduit node to take on the
+        // list role
+        schema->set(DataType::list());
+        return;
     }
 
-    return false;
-}
+    // numbers (and strings that hold numbers) are buffered until we
+    // either reach the end of the array or find a value that means this
+    // is not a homogenous numeric array. Only one array buffers at a
+    // time: nested values are only parsed after the buffer is flushed.
+    m_seq.clear();
+    bool numeric = true;
 
-//---------------------------------------------------------------------------//
-bool 
-Generator::Parser::YAML::check_yaml_is_int(const yaml_node_t *yaml_node)
-{
-    if (check_yaml_is_scalar_node(yaml_node))
+    for(;;)
     {
-        return string_is_integer(get_yaml_string(yaml_node));
-    }
-    return false;
-}
+        const char c = *m_ptr;
+        if(numeric && (c == '-' || is_digit(c)))
+        {
+            int64   ival = 0;
+            uint64  uval = 0;
+            float64 fval = 0.0;
+            switch(parse_number(ival,uval,fval))
+            {
+                case INT64_NUMBER:
+                    m_seq.append_int64(ival);
+                    break;
+                case UINT64_NUMBER:
+                    m_seq.append_uint64(uval);
+                    break;
+                default:
+                    m_seq.append_float64(fval);
+                    break;
+            }
+        }
+        else if(numeric && (c == '"' || is_word_start(c)))
+        {
+            bool is_word = (c != '"');
+            if(is_word)
+            {
+                parse_word(m_str);
+            }
+            else
+            {
+                parse_string(m_str);
+            }
 
-//---------------------------------------------------------------------------//
+            // we could have string reps of nan, infinity, etc.
+            if(!(is_word && is_literal(m_str)) &&
+               string_is_double(m_str.c_str()))
+            {
+                m_seq.append_string(m_str,string_to_double(m_str.c_str()));
+            }
+            else
+            {
+                numeric = false;
+                schema->set(DataType::list());
+                m_seq.to_list(*node,*schema);
+                m_seq.clear();
+                Node *curr_node = append_list_child(node,schema);
+                if(is_word)
+                {
+                    set_word(curr_node,m_str);
+                }
+                else
+                {
+                    curr_node->set(m_str);
+                }
+            }
+        }
+        else
+        {
+            if(numeric)
+            {
+                numeric = false;
+                schema->set(DataType::list());
+                m_seq.to_list(*node,*schema);
+                m_seq.clear();
+            }
+            Node *curr_node = append_list_child(node,schema);
+            parse_value(curr_node,curr_node->schema_ptr());
+        }
+
+        skip_whitespace();
+        if(*m_ptr == ',')
+        {
+            m_ptr++;
+            skip_whitespace();
+        }
+        else if(*m_ptr == ']')
+        {
+            m_ptr++;
+            break;
+        }
+        else
+        {
+            error("Missing a comma or ']' after an array element.");
+        }
+    }
+
+    if(numeric)
+    {
+        m_seq.to_leaf(*node);
+        m_seq.clear();
+    }
+}
+
+//---------------------------------------------------------------------------//
+void
+Generator::Parser::JSON::StreamParser::parse_string(std::string &res)
+{
+    // skip opening quote
+    m_ptr++;
+    res.clear();
+
+    for(;;)
+    {
+        // copy runs of plain chars at once
+        const char *run_start = m_ptr;
+        while(*m_ptr != '"' && *m_ptr != '\\' &&
+              (unsigned char)(*m_ptr) >= 0x20)
+        {
+            m_ptr++;
+        }
+        res.append(run_start,m_ptr - run_start);
+
+        const char c = *m_ptr;
+        if(c == '"')
+        {
+            m_ptr++;
+            return;
+        }
+        else if(c == '\\')
+        {
+            m_ptr++;
+            switch(*m_ptr)
+            {
+                case '"':  res += '"';  break;
+                case '\\': res += '\\'; break;
+                case '/':  res += '/';  break;
+                case 'b':  res += '\b'; break;
+                case 'f':  res += '\f'; break;
+                case 'n':  res += '\n'; break;
+                case 'r':  res += '\r'; break;
+                case 't':  res += '\t'; break;
+                case 'u':
+                {
+                    // read one or two (surrogate pair) \uXXXX escapes
+                    // and encode the code point as utf-8
+                    uint32 code_point = 0;
+                    for(int pair_idx = 0; pair_idx < 2; pair_idx++)
+                    {
+                        uint32 code_unit = 0;
+                        for(int i = 0; i < 4; i++)
+                        {
+                            m_ptr++;
+                            const char h = *m_ptr;
+                            code_unit <<= 4;
+                            if(is_digit(h))
+                                code_unit += (uint32)(h - '0');
+                            else if(h >= 'a' && h <= 'f')
+                                code_unit += (uint32)(h - 'a' + 10);
+                            else if(h >= 'A' && h <= 'F')
+                                code_unit += (uint32)(h - 'A' + 10);
+                            else
+                                error("Incorrect hex digit after \\u escape in string.");
+                        }
+
+                        if(pair_idx == 0)
+                        {
+                            code_point = code_unit;
+                            if(code_unit < 0xD800 || code_unit > 0xDBFF)
+                            {
+                                break;
+                            }
+                            // high surrogate, must be followed by a low one
+                            if(m_ptr[1] != '\\' || m_ptr[2] != 'u')
+                            {
+                                error("The surrogate pair in string is invalid.");
+                            }
+                            m_ptr += 2;
+                        }
+                        else
+                        {
+                            if(code_unit < 0xDC00 || code_unit > 0xDFFF)
+                            {
+                                error("The surrogate pair in string is invalid.");
+                            }
+                            code_point = 0x10000 +
+                                         ((code_point - 0xD800) << 10) +
+                                         (code_unit - 0xDC00);
+                        }
+                    }
+
+                    if(code_point < 0x80)
+                    {
+                        res += (char)code_point;
+                    }
+                    else if(code_point < 0x800)
+                    {
+                        res += (char)(0xC0 | (code_point >> 6));
+                        res += (char)(0x80 | (code_point & 0x3F));
+                    }
+                    else if(code_point < 0x10000)
+                    {
+                        res += (char)(0xE0 | (code_point >> 12));
+                        res += (char)(0x80 | ((code_point >> 6) & 0x3F));
+                        res += (char)(0x80 | (code_point & 0x3F));
+                    }
+                    else
+                    {
+                        res += (char)(0xF0 | (code_point >> 18));
+                        res += (char)(0x80 | ((code_point >> 12) & 0x3F));
+                        res += (char)(0x80 | ((code_point >> 6) & 0x3F));
+                        res += (char)(0x80 | (code_point & 0x3F));
+                    }
+                    break;
+                }
+                default:
+                    error("Invalid escape character in string.");
+            }
+            m_ptr++;
+        }
+        else if(m_ptr == m_end)
+        {
+            error("Missing a closing quotation mark in string.");
+        }
+        else
+        {
+            error("Invalid encoding in string.");
+        }
+    }
+}
+
+//---------------------------------------------------------------------------//
+void
+Generator::Parser::JSON::StreamParser::parse_word(std::string &res)
+{
+    const char *word_start = m_ptr;
+    while(is_word_start(*m_ptr) || is_digit(*m_ptr))
+    {
+        m_ptr++;
+    }
+    res.assign(word_start,m_ptr - word_start);
+}
+
+//---------------------------------------------------------------------------//
+void
+Generator::Parser::JSON::StreamParser::set_word(Node *node,
+                                                const std::string &word)
+{
+    // we store bools as uint8s
+    if(word == "true")
+    {
+        node->set((uint8)1);
+    }
+    else if(word == "false")
+    {
+        node->set((uint8)0);
+    }
+    else if(word == "null")
+    {
+        node->reset();
+    }
+    else
+    {
+        node->set(word);
+    }
+}
+
+//---------------------------------------------------------------------------//
+Generator::Parser::JSON::StreamParser::NumberKind
+Generator::Parser::JSON::StreamParser::parse_number(int64 &ival,
+                                                    uint64 &uval,
+                                                    float64 &fval)
+{
+    // exact powers of ten that can be represented by a double
+    static const float64 pow10[] = { 1e0,  1e1,  1e2,  1e3,  1e4,  1e5,
+                                     1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+                                     1e12, 1e13, 1e14, 1e15, 1e16, 1e17,
+                                     1e18, 1e19, 1e20, 1e21, 1e22};
+
+    const char *num_start = m_ptr;
+    bool negative = false;
+    if(*m_ptr == '-')
+    {
+        negative = true;
+        m_ptr++;
+    }
+
+    if(!is_digit(*m_ptr))
+    {
+        error("Invalid value.");
+    }
+
+    // accumulate digits while they fit in a uint64, if there are more
+    // we fall back to strtod for the conversion
+    const uint64 max_mantissa = std::numeric_limits<uint64>::max();
+    uint64 mantissa   = 0;
+    int    exp10      = 0;
+    bool   truncated  = false;
+    bool   is_integer = true;
+
+    if(*m_ptr == '0')
+    {
+        m_ptr++;
+    }
+    else
+    {
+        while(is_digit(*m_ptr))
+        {
+            const uint64 digit = (uint64)(*m_ptr - '0');
+            if(!truncated && mantissa <= (max_mantissa - digit) / 10)
+            {
+                mantissa = mantissa * 10 + digit;
+            }
+            else
+            {
+                // integer digits past what we kept
+                exp10++;
+                truncated = true;
+            }
+            m_ptr++;
+        }
+    }
+
+    if(*m_ptr == '.')
+    {
+        is_integer = false;
+        m_ptr++;
+        if(!is_digit(*m_ptr))
+        {
+            error("Missing fraction part in number.");
+        }
+        while(is_digit(*m_ptr))
+        {
+            const uint64 digit = (uint64)(*m_ptr - '0');
+            if(!truncated && mantissa <= (max_mantissa - digit) / 10)
+            {
+                mantissa = mantissa * 10 + digit;
+                exp10--;
+            }
+            else
+            {
+                truncated = true;
+            }
+            m_ptr++;
+        }
+    }
+
+    if(*m_ptr == 'e' || *m_ptr == 'E')
+    {
+        is_integer = false;
+        m_ptr++;
+        bool exp_negative = false;
+        if(*m_ptr == '+' || *m_ptr == '-')
+        {
+            exp_negative = (*m_ptr == '-');
+            m_ptr++;
+        }
+        if(!is_digit(*m_ptr))
+        {
+            error("Missing exponent in number.");
+        }
+        int exp_val = 0;
+        while(is_digit(*m_ptr))
+        {
+            // large exponents are handled by strtod below
+            if(exp_val < 10000)
+            {
+                exp_val = exp_val * 10 + (*m_ptr - '0');
+            }
+            m_ptr++;
+        }
+        exp10 += exp_negative ? -exp_val : exp_val;
+    }
+
+    if(is_integer && !truncated)
+    {
+        if(!negative)
+        {
+            if(mantissa <= (uint64)std::numeric_limits<int64>::max())
+            {
+                ival = (int64)mantissa;
+                return INT64_NUMBER;
+            }
+            uval = mantissa;
+            return UINT64_NUMBER;
+        }
+        else if(mantissa <= (uint64)std::numeric_limits<int64>::max() + 1)
+        {
+            ival = (int64)(0 - mantissa);
+            return INT64_NUMBER;
+        }
+        // too small for an int64, read as a double
+    }
+
+    // fast path: the mantissa and the power of ten are both exact
+    // doubles, so a single multiply or divide is correctly rounded
+    if(!truncated &&
+       mantissa <= ((uint64)1 << 53) &&
+       exp10 >= -22 && exp10 <= 22)
+    {
+        fval = (float64)mantissa;
+        if(exp10 < 0)
+        {
+            fval /= pow10[-exp10];
+        }
+        else
+        {
+            fval *= pow10[exp10];
+        }
+        if(negative)
+        {
+            fval = -fval;
+        }
+    }
+    else
+    {
+        fval = strtod(num_start,NULL);
+    }
+
+    return FLOAT64_NUMBER;
+}
+
+//---------------------------------------------------------------------------//
+void
+Generator::Parser::JSON::StreamParser::skip_whitespace()
+{
+    for(;;)
+    {
+        const char c = *m_ptr;
+        if(c == ' ' || c == '\n' || c == '\r' || c == '\t')
+        {
+            m_ptr++;
+        }
+        else if(c == '/' && m_ptr[1] == '/')
+        {
+            while(m_ptr != m_end && *m_ptr != '\n')
+            {
+                m_ptr++;
+            }
+        }
+        else
+        {
+            return;
+        }
+    }
+}
+
+//---------------------------------------------------------------------------//
+void
+Generator::Parser::JSON::StreamParser::error(const std::string &msg) const
+{
+    // provide message with line + char from the parse offset,
+    // like parse_error_details
+    index_t doc_offset = (index_t)(m_ptr - m_json.c_str());
+    index_t doc_line   = 0;
+    index_t doc_char   = 0;
+    for(index_t i = 0; i < doc_offset; i++)
+    {
+        if(m_json[i] == '\n')
+        {
+            doc_line++;
+            doc_char = 0;
+        }
+        else
+        {
+            doc_char++;
+        }
+    }
+
+    CONDUIT_ERROR("JSON parse error: \n"
+                  << " parse error message:\n"
+                  << msg << "\n"
+                  << " offset: "    << doc_offset << "\n"
+                  << " line: "      << doc_line << "\n"
+                  << " character: " << doc_char << "\n"
+                  << " json:\n"     << m_json << "\n"
+                  << "\n");
+}
+
+//-----------------------------------------------------------------------------
+// -- end conduit::Generator::Parser::JSON::StreamParser --
+//-----------------------------------------------------------------------------
+
+
+//-----------------------------------------------------------------------------
+// -- end conduit::Generator::Parser::JSON --
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+// -- begin conduit::Generator::YAML --
+//-----------------------------------------------------------------------------
+
+
+//-----------------------------------------------------------------------------
+// -- begin conduit::Generator::YAML::YAMLParserWrapper --
+//-----------------------------------------------------------------------------
+
+
+//---------------------------------------------------------------------------//
+Generator::Parser::YAML::YAMLParserWrapper::YAMLParserWrapper()
+: m_yaml_parser_is_valid(false),
+  m_yaml_doc_is_valid(false)
+{
+
+}
+
+//---------------------------------------------------------------------------//
+Generator::Parser::YAML::YAMLParserWrapper::~YAMLParserWrapper()
+{
+    // cleanup!
+    if(m_yaml_parser_is_valid)
+    {
+        yaml_parser_delete(&m_yaml_parser);
+    }
+
+    if(m_yaml_doc_is_valid)
+    {
+        yaml_document_delete(&m_yaml_doc);
+    }
+}
+
+//---------------------------------------------------------------------------//
+void
+Generator::Parser::YAML::YAMLParserWrapper::parse(const char *yaml_txt)
+{
+    // Initialize parser
+    if(yaml_parser_initialize(&m_yaml_parser) == 0)
+    {
+        // error!
+        CONDUIT_ERROR("yaml_parser_initialize failed");
+    }
+    else
+    {
+        m_yaml_parser_is_valid = true;
+    }
+
+    // set input
+    yaml_parser_set_input_string(&m_yaml_parser,
+                                 (const unsigned char*)yaml_txt,
+                                 strlen(yaml_txt));
+
+    // use parser to construct document
+    if( yaml_parser_load(&m_yaml_parser, &m_yaml_doc) == 0 )
+    {
+        CONDUIT_YAML_PARSE_ERROR(&m_yaml_doc,
+                                 &m_yaml_parser);
+    }
+    else
+    {
+        m_yaml_doc_is_valid = true;
+    }
+}
+
+//---------------------------------------------------------------------------//
+yaml_document_t *
+Generator::Parser::YAML::YAMLParserWrapper::yaml_doc_ptr()
+{
+    yaml_document_t *res = NULL;
+
+    if(m_yaml_doc_is_valid)
+    {
+        res = &m_yaml_doc;
+    }
+
+    return res;
+}
+
+//---------------------------------------------------------------------------//
+yaml_node_t *
+Generator::Parser::YAML::YAMLParserWrapper::yaml_doc_root_ptr()
+{
+    yaml_node_t *res = NULL;
+
+    if(m_yaml_doc_is_valid)
+    {
+        res = yaml_document_get_root_node(&m_yaml_doc);
+    }
+
+    return res;
+}
+
+//-----------------------------------------------------------------------------
+// -- end conduit::Generator::YAML::YAMLParserWrapper --
+//-----------------------------------------------------------------------------
+
+//---------------------------------------------------------------------------//
+index_t 
+Generator::Parser::YAML::yaml_leaf_to_numeric_dtype(const char *txt_value)
+{
+    index_t res = DataType::EMPTY_ID;
+    if(string_is_integer(txt_value))
+    {
+        res = DataType::INT64_ID;
+    }
+    else if(string_is_double(txt_value))
+    {
+        res = DataType::FLOAT64_ID;
+    }
+    //else, already inited to DataType::EMPTY_ID
+
+    return res;
+}
+
+//---------------------------------------------------------------------------//
+bool
+Generator::Parser::YAML::check_yaml_is_number(const yaml_node_t *yaml_node)
+{
+    if (check_yaml_is_scalar_node(yaml_node))
+    {
+        const char *yaml_value_str = get_yaml_string(yaml_node);
+        return string_is_integer(yaml_value_str) || string_is_double(yaml_value_str);
+    }
+
+    return false;
+}
+
+//---------------------------------------------------------------------------//
+bool 
+Generator::Parser::YAML::check_yaml_is_int(const yaml_node_t *yaml_node)
+{
+    if (check_yaml_is_scalar_node(yaml_node))
+    {
+        return string_is_integer(get_yaml_string(yaml_node));
+    }
+    return false;
+}
+
+//---------------------------------------------------------------------------//
 long
 Generator::Parser::YAML::get_yaml_long(const yaml_node_t *yaml_node)
 {
@@ -2654,9 +3587,7 @@ Generator::Parser::YAML::walk_yaml_schema(Node *node,
                 {
                     schema->append();
                     Schema *curr_schema = schema->child_ptr(i);
-                    Node *curr_node = new Node();
-                    curr_node->set_schema_ptr(curr_schema);
-                    curr_node->set_parent(node);
+                    Node *curr_node = node->create_child_node(curr_schema);
                     node->append_node_ptr(curr_node);
                     walk_yaml_schema(curr_node,
                                      curr_schema,
@@ -2762,9 +3693,7 @@ Generator::Parser::YAML::walk_yaml_schema(Node *node,
                 CONDUIT_ASSERT(yaml_child, "YAML Generator error:\nInvalid mapping child.");
 
                 Schema *curr_schema = &schema->add_child(entry_name);
-                Node *curr_node = new Node();
-                curr_node->set_schema_ptr(curr_schema);
-                curr_node->set_parent(node);
+                Node *curr_node = node->create_child_node(curr_schema);
                 node->append_node_ptr(curr_node);
                 walk_yaml_schema(curr_node,
                                  curr_schema,
@@ -2794,9 +3723,7 @@ Generator::Parser::YAML::walk_yaml_schema(Node *node,
 
             schema->append();
             Schema *curr_schema = schema->child_ptr(cld_idx);
-            Node *curr_node = new Node();
-            curr_node->set_schema_ptr(curr_schema);
-            curr_node->set_parent(node);
+            Node *curr_node = node->create_child_node(curr_schema);
             node->append_node_ptr(curr_node);
             walk_yaml_schema(curr_node,
                              curr_schema,
@@ -3020,9 +3947,7 @@ Generator::Parser::YAML::walk_pure_yaml_schema(Node *node,
 
             Schema *curr_schema = &schema->add_child(entry_name);
 
-            Node *curr_node = new Node();
-            curr_node->set_schema_ptr(curr_schema);
-            curr_node->set_parent(node);
+            Node *curr_node = node->create_child_node(curr_schema);
             node->append_node_ptr(curr_node);
             
             walk_pure_yaml_schema(curr_node,
@@ -3071,9 +3996,7 @@ Generator::Parser::YAML::walk_pure_yaml_schema(Node *node,
 
                 schema->append();
                 Schema *curr_schema = schema->child_ptr(cld_idx);
-                Node * curr_node = new Node();
-                curr_node->set_schema_ptr(curr_schema);
-                curr_node->set_parent(node);
+                Node *curr_node = node->create_child_node(curr_schema);
                 node->append_node_ptr(curr_node);
                 walk_pure_yaml_schema(curr_node,
                                       curr_schema,
@@ -3225,6 +4148,365 @@ Generator::Parser::YAML::parse_error_details(yaml_parser_t *yaml_parser,
     os << std::endl;
 }
 
+//-----------------------------------------------------------------------------
+// -- begin conduit::Generator::Parser::YAML::StreamParser --
+//-----------------------------------------------------------------------------
+//
+// Builds nodes from libyaml parser events, following the same rules as
+// walk_pure_yaml_schema. Anchored scalars are kept as text and anchored
+// maps and sequences are kept as the nodes they created, so aliases can
+// be resolved without a document tree.
+//
+//-----------------------------------------------------------------------------
+class Generator::Parser::YAML::StreamParser
+{
+public:
+    StreamParser(const std::string &yaml);
+   ~StreamParser();
+
+    void parse(Node &node);
+
+private:
+    // advances to the next event, throws on parser errors
+    void        next_event();
+
+    // these expect the current event to be the start of the yaml node
+    void        parse_node(Node *node,
+                           Schema *schema);
+    void        parse_mapping(Node *node,
+                              Schema *schema);
+    void        parse_sequence(Node *node,
+                               Schema *schema);
+    void        parse_alias(Node *node);
+
+    // returns text of the anchored scalar the current alias event
+    // refers to, or NULL if it does not refer to a scalar
+    const char *alias_scalar() const;
+
+    void        add_anchor(const std::string &anchor,
+                           const char *scalar_txt,
+                           Node *node);
+
+    yaml_parser_t                      m_yaml_parser;
+    yaml_event_t                       m_yaml_event;
+    bool                               m_yaml_parser_is_valid;
+    bool                               m_yaml_event_is_valid;
+
+    std::map<std::string, std::string> m_scalar_anchors;
+    std::map<std::string, Node*>       m_node_anchors;
+
+    NumericSequenceBuffer              m_seq;
+};
+
+//---------------------------------------------------------------------------//
+Generator::Parser::YAML::StreamParser::StreamParser(const std::string &yaml)
+: m_yaml_parser_is_valid(false),
+  m_yaml_event_is_valid(false),
+  m_scalar_anchors(),
+  m_node_anchors(),
+  m_seq()
+{
+    if(yaml_parser_initialize(&m_yaml_parser) == 0)
+    {
+        CONDUIT_ERROR("yaml_parser_initialize failed");
+    }
+    m_yaml_parser_is_valid = true;
+
+    yaml_parser_set_input_string(&m_yaml_parser,
+                                 (const unsigned char*)yaml.c_str(),
+                                 yaml.size());
+}
+
+//---------------------------------------------------------------------------//
+Generator::Parser::YAML::StreamParser::~StreamParser()
+{
+    if(m_yaml_event_is_valid)
+    {
+        yaml_event_delete(&m_yaml_event);
+    }
+
+    if(m_yaml_parser_is_valid)
+    {
+        yaml_parser_delete(&m_yaml_parser);
+    }
+}
+
+//---------------------------------------------------------------------------//
+void
+Generator::Parser::YAML::StreamParser::next_event()
+{
+    if(m_yaml_event_is_valid)
+    {
+        yaml_event_delete(&m_yaml_event);
+        m_yaml_event_is_valid = false;
+    }
+
+    if(yaml_parser_parse(&m_yaml_parser,&m_yaml_event) == 0)
+    {
+        CONDUIT_YAML_PARSE_ERROR(NULL,&m_yaml_parser);
+    }
+    m_yaml_event_is_valid = true;
+}
+
+//---------------------------------------------------------------------------//
+void
+Generator::Parser::YAML::StreamParser::parse(Node &node)
+{
+    // stream start
+    next_event();
+    next_event();
+    CONDUIT_ASSERT(m_yaml_event.type == YAML_DOCUMENT_START_EVENT,
+                   "failed to fetch yaml document root");
+
+    next_event();
+    parse_node(&node,node.schema_ptr());
+
+    // like yaml_parser_load, read (and check) the rest of the first
+    // document, other documents are ignored
+    next_event();
+    CONDUIT_ASSERT(m_yaml_event.type == YAML_DOCUMENT_END_EVENT,
+                   "YAML Generator error:\n"
+                   << "Expected end of YAML document");
+}
+
+//---------------------------------------------------------------------------//
+void
+Generator::Parser::YAML::StreamParser::parse_node(Node *node,
+                                                  Schema *schema)
+{
+    switch(m_yaml_event.type)
+    {
+        case YAML_SCALAR_EVENT:
+        {
+            const char *yaml_txt = (const char*)m_yaml_event.data.scalar.value;
+            parse_yaml_inline_leaf(yaml_txt,*node);
+            if(m_yaml_event.data.scalar.anchor != NULL)
+            {
+                add_anchor((const char*)m_yaml_event.data.scalar.anchor,
+                           yaml_txt,
+                           NULL);
+            }
+            break;
+        }
+        case YAML_MAPPING_START_EVENT:
+        {
+            std::string anchor;
+            if(m_yaml_event.data.mapping_start.anchor != NULL)
+            {
+                anchor = (const char*)m_yaml_event.data.mapping_start.anchor;
+            }
+            parse_mapping(node,schema);
+            if(!anchor.empty())
+            {
+                add_anchor(anchor,NULL,node);
+            }
+            break;
+        }
+        case YAML_SEQUENCE_START_EVENT:
+        {
+            std::string anchor;
+            if(m_yaml_event.data.sequence_start.anchor != NULL)
+            {
+                anchor = (const char*)m_yaml_event.data.sequence_start.anchor;
+            }
+            parse_sequence(node,schema);
+            if(!anchor.empty())
+            {
+                add_anchor(anchor,NULL,node);
+            }
+            break;
+        }
+        case YAML_ALIAS_EVENT:
+        {
+            parse_alias(node);
+            break;
+        }
+        default:
+        {
+            CONDUIT_ERROR("YAML Generator error:\n"
+                          << "Invalid YAML type for parsing Node from pure YAML."
+                          << " Expected: YAML Map, Sequence, String, Null,"
+                          << " Boolean, or Number");
+        }
+    }
+}
+
+//---------------------------------------------------------------------------//
+void
+Generator::Parser::YAML::StreamParser::parse_mapping(Node *node,
+                                                     Schema *schema)
+{
+    // if we make it here and have an empty yaml object
+    // we still want the conduit node to take on the
+    // object role
+    schema->set(DataType::object());
+
+    for(;;)
+    {
+        next_event();
+        if(m_yaml_event.type == YAML_MAPPING_END_EVENT)
+        {
+            return;
+        }
+
+        CONDUIT_ASSERT(m_yaml_event.type == YAML_SCALAR_EVENT,
+                       "YAML Generator error:\nInvalid mapping key type.");
+        const std::string entry_name((const char*)m_yaml_event.data.scalar.value);
+
+        // duplicate object names are most likely a typo,
+        // so it's best to throw an error
+        CONDUIT_ASSERT(! schema->has_child(entry_name),
+                       "YAML Generator error:\n"
+                       << "Duplicate YAML object name: "
+                       << utils::join_path(node->path(),entry_name));
+
+        Schema *curr_schema = &schema->add_child(entry_name);
+        Node *curr_node = node->create_child_node(curr_schema);
+        node->append_node_ptr(curr_node);
+
+        next_event();
+        parse_node(curr_node,curr_schema);
+    }
+}
+
+//---------------------------------------------------------------------------//
+void
+Generator::Parser::YAML::StreamParser::parse_sequence(Node *node,
+                                                      Schema *schema)
+{
+    // numeric scalars are buffered until we reach the end of the sequence
+    // or find a value that means this is not a homogenous numeric array.
+    // Only one sequence buffers at a time: nested values are only parsed
+    // after the buffer is flushed.
+    m_seq.clear();
+    bool numeric = true;
+
+    for(;;)
+    {
+        next_event();
+        if(m_yaml_event.type == YAML_SEQUENCE_END_EVENT)
+        {
+            break;
+        }
+
+        if(numeric)
+        {
+            const char *yaml_txt = NULL;
+            if(m_yaml_event.type == YAML_SCALAR_EVENT)
+            {
+                yaml_txt = (const char*)m_yaml_event.data.scalar.value;
+            }
+            else if(m_yaml_event.type == YAML_ALIAS_EVENT)
+            {
+                yaml_txt = alias_scalar();
+            }
+
+            if(yaml_txt != NULL)
+            {
+                // check for integers, then widen to floats
+                index_t dtype_id = yaml_leaf_to_numeric_dtype(yaml_txt);
+                if(dtype_id == DataType::INT64_ID)
+                {
+                    m_seq.append_int64((int64)string_to_long(yaml_txt));
+                }
+                else if(dtype_id == DataType::FLOAT64_ID)
+                {
+                    m_seq.append_float64((float64)string_to_double(yaml_txt));
+                }
+
+                if(dtype_id != DataType::EMPTY_ID)
+                {
+                    if(m_yaml_event.type == YAML_SCALAR_EVENT &&
+                       m_yaml_event.data.scalar.anchor != NULL)
+                    {
+                        add_anchor((const char*)m_yaml_event.data.scalar.anchor,
+                                   yaml_txt,
+                                   NULL);
+                    }
+                    continue;
+                }
+            }
+
+            // not a numeric array, the general case uses list children
+            numeric = false;
+            m_seq.to_list(*node,*schema);
+            m_seq.clear();
+        }
+
+        Node *curr_node = append_list_child(node,schema);
+        parse_node(curr_node,curr_node->schema_ptr());
+    }
+
+    if(numeric && m_seq.size() > 0)
+    {
+        m_seq.to_leaf(*node);
+        m_seq.clear();
+    }
+}
+
+//---------------------------------------------------------------------------//
+void
+Generator::Parser::YAML::StreamParser::parse_alias(Node *node)
+{
+    const std::string anchor((const char*)m_yaml_event.data.alias.anchor);
+
+    std::map<std::string, std::string>::const_iterator sitr;
+    sitr = m_scalar_anchors.find(anchor);
+    if(sitr != m_scalar_anchors.end())
+    {
+        parse_yaml_inline_leaf(sitr->second.c_str(),*node);
+        return;
+    }
+
+    std::map<std::string, Node*>::const_iterator nitr;
+    nitr = m_node_anchors.find(anchor);
+    CONDUIT_ASSERT(nitr != m_node_anchors.end(),
+                   "YAML Generator error:\n"
+                   << "Unsupported YAML alias: \"" << anchor << "\""
+                   << " (the anchor is undefined or refers to an"
+                   << " enclosing map or sequence)");
+
+    node->set(*nitr->second);
+}
+
+//---------------------------------------------------------------------------//
+const char *
+Generator::Parser::YAML::StreamParser::alias_scalar() const
+{
+    std::map<std::string, std::string>::const_iterator itr;
+    itr = m_scalar_anchors.find((const char*)m_yaml_event.data.alias.anchor);
+    if(itr != m_scalar_anchors.end())
+    {
+        return itr->second.c_str();
+    }
+    return NULL;
+}
+
+//---------------------------------------------------------------------------//
+void
+Generator::Parser::YAML::StreamParser::add_anchor(const std::string &anchor,
+                                                  const char *scalar_txt,
+                                                  Node *node)
+{
+    // anchors can be redefined, the latest one wins
+    m_scalar_anchors.erase(anchor);
+    m_node_anchors.erase(anchor);
+
+    if(node != NULL)
+    {
+        m_node_anchors[anchor] = node;
+    }
+    else
+    {
+        m_scalar_anchors[anchor] = std::string(scalar_txt);
+    }
+}
+
+//-----------------------------------------------------------------------------
+// -- end conduit::Generator::Parser::YAML::StreamParser --
+//-----------------------------------------------------------------------------
+
+
 //-----------------------------------------------------------------------------
 // -- end conduit::Generator::Parser::YAML --
 //-----------------------------------------------------------------------------
@@ -3237,7 +4519,8 @@ Generator::Parser::YAML::parse_error_details(yaml_parser_t *yaml_parser,
 Generator::Generator()
 :m_schema(""),
  m_protocol("conduit_json"),
- m_data(NULL)
+ m_data(NULL),
+ m_streaming(true)
 {}
 
 
@@ -3247,7 +4530,8 @@ Generator::Generator(const std::string &schema,
                      void *data)
 :m_schema(schema),
  m_protocol(protocol),
- m_data(data)
+ m_data(data),
+ m_streaming(true)
 {}
 
 //---------------------------------------------------------------------------//
@@ -3271,6 +4555,13 @@ Generator::set_data_ptr(void *data_ptr)
     m_data = data_ptr;
 }
 
+//---------------------------------------------------------------------------//
+void
+Generator::set_streaming(bool value)
+{
+    m_streaming = value;
+}
+
 //---------------------------------------------------------------------------//
 const std::string &
 Generator::schema() const
@@ -3292,19 +4583,75 @@ Generator::data_ptr() const
     return m_data;
 }
 
+//---------------------------------------------------------------------------//
+bool
+Generator::streaming() const
+{
+    return m_streaming;
+}
+
 
 //-----------------------------------------------------------------------------
 // JSON Parsing interface
 //-----------------------------------------------------------------------------s
 
 
+//-----------------------------------------------------------------------------
+// -- begin conduit::detail --
+//-----------------------------------------------------------------------------
+namespace detail
+{
+
+//---------------------------------------------------------------------------//
+// Times a Generator walk for conduit::instrumentation, the clock is only
+// read when instrumentation is enabled.
+//---------------------------------------------------------------------------//
+class ParseTimer
+{
+public:
+    ParseTimer(size_t num_bytes)
+    : m_num_bytes(num_bytes),
+      m_enabled(instrumentation::enabled())
+    {
+        if(m_enabled)
+        {
+            m_start = std::chrono::steady_clock::now();
+        }
+    }
+
+    void finish()
+    {
+        if(m_enabled)
+        {
+            std::chrono::duration<double> elapsed =
+                std::chrono::steady_clock::now() - m_start;
+            instrumentation::record_parse(m_num_bytes, elapsed.count());
+        }
+    }
+
+private:
+    size_t                                m_num_bytes;
+    bool                                  m_enabled;
+    std::chrono::steady_clock::time_point m_start;
+};
+
+}
+//-----------------------------------------------------------------------------
+// -- end conduit::detail --
+//-----------------------------------------------------------------------------
+
 //---------------------------------------------------------------------------//
 void 
 Generator::walk(Schema &schema) const
 {
+    detail::ParseTimer timer(m_schema.size());
     schema.reset();
     index_t curr_offset = 0;
-    if (m_protocol.find("json") != std::string::npos)
+    if (m_protocol == "conduit_bin_schema")
+    {
+        schema.from_binary(m_schema.data(),(index_t)m_schema.size());
+    }
+    else if (m_protocol.find("json") != std::string::npos)
     {
         conduit_json::Document document;
         std::string res = utils::json_sanitize(m_schema);
@@ -3337,12 +4684,14 @@ Generator::walk(Schema &schema) const
     {
         CONDUIT_ERROR("Unknown protocol in " << m_protocol);
     }
+    timer.finish();
 }
 
 //---------------------------------------------------------------------------//
 void 
 Generator::walk(Node &node) const
 {
+    detail::ParseTimer timer(m_schema.size());
     // try catch b/c:
     // if something goes wrong we will clear the node and re-throw
     // if exception is caught downstream
@@ -3351,7 +4700,26 @@ Generator::walk(Node &node) const
     {
         node.reset();
         // json, yaml, and conduit_base64_json don't leverage "data"
-        if(m_protocol == "json")
+        if(m_protocol == "conduit_bin_schema")
+        {
+            Schema schema;
+            schema.from_binary(m_schema.data(),(index_t)m_schema.size());
+            // like conduit_json, the node points to the passed data
+            if(m_data != NULL)
+            {
+                node.set_external(schema,m_data);
+            }
+            else
+            {
+                node.set(schema);
+            }
+        }
+        else if(m_protocol == "json" && m_streaming)
+        {
+            Parser::JSON::StreamParser parser(m_schema);
+            parser.parse(node);
+        }
+        else if(m_protocol == "json")
         {
             conduit_json::Document document;
             std::string res = utils::json_sanitize(m_schema);
@@ -3365,6 +4733,11 @@ Generator::walk(Node &node) const
                                                 node.schema_ptr(),
                                                 document);
         }
+        else if(m_protocol == "yaml" && m_streaming)
+        {
+            Parser::YAML::StreamParser parser(m_schema);
+            parser.parse(node);
+        }
         else if(m_protocol == "yaml")
         {
             Parser::YAML::YAMLParserWrapper parser;
@@ -3462,12 +4835,14 @@ Generator::walk(Node &node) const
         node.reset();
         throw e;
     }
+    timer.finish();
 }
 
 //---------------------------------------------------------------------------//
 void 
 Generator::walk_external(Node &node) const
 {
+    detail::ParseTimer timer(m_schema.size());
     // try catch b/c:
     // if something goes wrong we will clear the node and re-throw
     // if exception is caught downstream
@@ -3476,7 +4851,25 @@ Generator::walk_external(Node &node) const
     {
         node.reset();
         // if data is null, we can parse the schema via other 'walk' methods
-        if(m_protocol == "json")
+        if(m_protocol == "conduit_bin_schema")
+        {
+            Schema schema;
+            schema.from_binary(m_schema.data(),(index_t)m_schema.size());
+            if(m_data != NULL)
+            {
+                node.set_external(schema,m_data);
+            }
+            else
+            {
+                node.set(schema);
+            }
+        }
+        else if(m_protocol == "json" && m_streaming)
+        {
+            Parser::JSON::StreamParser parser(m_schema);
+            parser.parse(node);
+        }
+        else if(m_protocol == "json")
         {
             conduit_json::Document document;
             std::string res = utils::json_sanitize(m_schema);
@@ -3490,6 +4883,11 @@ Generator::walk_external(Node &node) const
                                                 node.schema_ptr(),
                                                 document);
         }
+        else if(m_protocol == "yaml" && m_streaming)
+        {
+            Parser::YAML::StreamParser parser(m_schema);
+            parser.parse(node);
+        }
         else if(m_protocol == "yaml")
         {
             Parser::YAML::YAMLParserWrapper parser;
@@ -3588,6 +4986,7 @@ Generator::walk_external(Node &node) const
         node.reset();
         throw e;
     }
+    timer.finish();
 }
 
 
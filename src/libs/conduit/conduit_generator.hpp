@@ -62,6 +62,8 @@ public:
     ///   "conduit_json"
     ///   "conduit_base64_json"
     ///   "yaml"
+    ///   "conduit_bin_schema" (binary schema from Schema::to_binary(),
+    ///                         the string holds the raw bytes)
     ///
     Generator(const std::string &schema,
               const std::string &protocol = std::string("conduit_json"),
@@ -72,9 +74,16 @@ public:
     void set_protocol(const std::string &protocol);
     void set_data_ptr(void *);
 
+    /// controls how the "json" and "yaml" protocols build a Node.
+    /// when streaming (the default), parser events go straight into the
+    /// Node and numeric arrays are accumulated directly into typed
+    /// buffers, no intermediate document tree is created.
+    void set_streaming(bool value);
+
     const std::string &schema() const;
     const std::string &protocol()   const;
     void *data_ptr() const;
+    bool  streaming() const;
 
 
 //-----------------------------------------------------------------------------
@@ -105,6 +114,8 @@ private:
     std::string  m_protocol;
     /// optional external data pointer
     void        *m_data;
+    /// use streaming parsers for pure json and yaml
+    bool         m_streaming;
 
 };
 //-----------------------------------------------------------------------------
@@ -0,0 +1,382 @@
+// Copyright (c) Lawrence Livermore National Security, LLC and other Conduit
+// Project developers. See top-level LICENSE AND COPYRIGHT files for dates and
+// other details. No copyright assignment is required to contribute to Conduit.
+
+//-----------------------------------------------------------------------------
+///
+/// file: conduit_instrumentation.cpp
+///
+//-----------------------------------------------------------------------------
+#include "conduit_instrumentation.hpp"
+
+//-----------------------------------------------------------------------------
+// -- standard lib includes --
+//-----------------------------------------------------------------------------
+#include <atomic>
+#include <cstdlib>
+#include <sstream>
+
+//-----------------------------------------------------------------------------
+// -- conduit includes --
+//-----------------------------------------------------------------------------
+#include "conduit_node.hpp"
+
+//-----------------------------------------------------------------------------
+// -- begin conduit:: --
+//-----------------------------------------------------------------------------
+namespace conduit
+{
+
+//-----------------------------------------------------------------------------
+// -- begin conduit::instrumentation --
+//-----------------------------------------------------------------------------
+namespace instrumentation
+{
+
+//-----------------------------------------------------------------------------
+// -- begin conduit::instrumentation::detail --
+//-----------------------------------------------------------------------------
+namespace detail
+{
+
+typedef std::atomic<uint64> counter_t;
+
+// number of allocator ids tracked individually, ids past this are
+// combined into the last slot
+static const index_t NUM_ALLOCATOR_SLOTS = 64;
+
+//-----------------------------------------------------------------------------
+struct AllocatorCounters
+{
+    counter_t allocations;
+    counter_t bytes_allocated;
+    counter_t frees;
+    counter_t bytes_freed;
+};
+
+//-----------------------------------------------------------------------------
+struct Counters
+{
+    AllocatorCounters allocators[NUM_ALLOCATOR_SLOTS];
+
+    counter_t memcpy_calls;
+    counter_t memcpy_bytes;
+
+    counter_t compact_calls;
+    counter_t compact_bytes;
+
+    counter_t conversion_calls;
+    counter_t conversion_elements;
+
+    counter_t parse_calls;
+    counter_t parse_bytes;
+    // parse time in nanoseconds
+    counter_t parse_nanoseconds;
+
+    counter_t io_reads;
+    counter_t io_bytes_read;
+    counter_t io_writes;
+    counter_t io_bytes_written;
+};
+
+//-----------------------------------------------------------------------------
+static bool
+enabled_from_env()
+{
+    const char *val = std::getenv("CONDUIT_INSTRUMENTATION");
+    return val != NULL && val[0] != '\0' && std::atoi(val) != 0;
+}
+
+// static storage is zero initialized before any dynamic initialization,
+// so recording from other static initializers is safe
+static Counters         counters;
+static std::atomic<bool> is_enabled(enabled_from_env());
+
+//-----------------------------------------------------------------------------
+static inline bool
+on()
+{
+    return is_enabled.load(std::memory_order_relaxed);
+}
+
+//-----------------------------------------------------------------------------
+static inline void
+add(counter_t &c, uint64 v)
+{
+    c.fetch_add(v, std::memory_order_relaxed);
+}
+
+//-----------------------------------------------------------------------------
+static inline uint64
+get(const counter_t &c)
+{
+    return c.load(std::memory_order_relaxed);
+}
+
+//-----------------------------------------------------------------------------
+static inline void
+clear(counter_t &c)
+{
+    c.store(0, std::memory_order_relaxed);
+}
+
+//-----------------------------------------------------------------------------
+static inline AllocatorCounters &
+allocator_counters(index_t allocator_id)
+{
+    if(allocator_id < 0 || allocator_id >= NUM_ALLOCATOR_SLOTS)
+    {
+        allocator_id = NUM_ALLOCATOR_SLOTS - 1;
+    }
+    return counters.allocators[allocator_id];
+}
+
+}
+//-----------------------------------------------------------------------------
+// -- end conduit::instrumentation::detail --
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+void
+enable()
+{
+    detail::is_enabled.store(true, std::memory_order_relaxed);
+}
+
+//-----------------------------------------------------------------------------
+void
+disable()
+{
+    detail::is_enabled.store(false, std::memory_order_relaxed);
+}
+
+//-----------------------------------------------------------------------------
+bool
+enabled()
+{
+    return detail::on();
+}
+
+//-----------------------------------------------------------------------------
+void
+reset()
+{
+    detail::Counters &c = detail::counters;
+
+    for(index_t i = 0; i < detail::NUM_ALLOCATOR_SLOTS; i++)
+    {
+        detail::clear(c.allocators[i].allocations);
+        detail::clear(c.allocators[i].bytes_allocated);
+        detail::clear(c.allocators[i].frees);
+        detail::clear(c.allocators[i].bytes_freed);
+    }
+
+    detail::clear(c.memcpy_calls);
+    detail::clear(c.memcpy_bytes);
+    detail::clear(c.compact_calls);
+    detail::clear(c.compact_bytes);
+    detail::clear(c.conversion_calls);
+    detail::clear(c.conversion_elements);
+    detail::clear(c.parse_calls);
+    detail::clear(c.parse_bytes);
+    detail::clear(c.parse_nanoseconds);
+    detail::clear(c.io_reads);
+    detail::clear(c.io_bytes_read);
+    detail::clear(c.io_writes);
+    detail::clear(c.io_bytes_written);
+}
+
+//-----------------------------------------------------------------------------
+void
+snapshot(Node &res)
+{
+    const detail::Counters &c = detail::counters;
+
+    // read all counters before touching res, building the result
+    // allocates and copies, which would otherwise show up in the counts
+    uint64 allocs[detail::NUM_ALLOCATOR_SLOTS][4];
+    for(index_t i = 0; i < detail::NUM_ALLOCATOR_SLOTS; i++)
+    {
+        const detail::AllocatorCounters &a = c.allocators[i];
+        allocs[i][0] = detail::get(a.allocations);
+        allocs[i][1] = detail::get(a.bytes_allocated);
+        allocs[i][2] = detail::get(a.frees);
+        allocs[i][3] = detail::get(a.bytes_freed);
+    }
+
+    uint64 memcpy_calls        = detail::get(c.memcpy_calls);
+    uint64 memcpy_bytes        = detail::get(c.memcpy_bytes);
+    uint64 compact_calls       = detail::get(c.compact_calls);
+    uint64 compact_bytes       = detail::get(c.compact_bytes);
+    uint64 conversion_calls    = detail::get(c.conversion_calls);
+    uint64 conversion_elements = detail::get(c.conversion_elements);
+    uint64 parse_calls         = detail::get(c.parse_calls);
+    uint64 parse_bytes         = detail::get(c.parse_bytes);
+    uint64 parse_nanoseconds   = detail::get(c.parse_nanoseconds);
+    uint64 io_reads            = detail::get(c.io_reads);
+    uint64 io_bytes_read       = detail::get(c.io_bytes_read);
+    uint64 io_writes           = detail::get(c.io_writes);
+    uint64 io_bytes_written    = detail::get(c.io_bytes_written);
+
+    res.reset();
+    res["enabled"] = enabled() ? "true" : "false";
+
+    Node &allocators = res["allocators"];
+    allocators.set(DataType::object());
+    for(index_t i = 0; i < detail::NUM_ALLOCATOR_SLOTS; i++)
+    {
+        if(allocs[i][0] == 0 && allocs[i][2] == 0)
+        {
+            continue;
+        }
+
+        std::ostringstream oss;
+        oss << i;
+        Node &alloc = allocators[oss.str()];
+        alloc["allocations"]     = allocs[i][0];
+        alloc["bytes_allocated"] = allocs[i][1];
+        alloc["frees"]           = allocs[i][2];
+        alloc["bytes_freed"]     = allocs[i][3];
+    }
+
+    res["memcpy/calls"] = memcpy_calls;
+    res["memcpy/bytes"] = memcpy_bytes;
+
+    res["compact_to/calls"] = compact_calls;
+    res["compact_to/bytes"] = compact_bytes;
+
+    res["conversions/calls"]    = conversion_calls;
+    res["conversions/elements"] = conversion_elements;
+
+    res["parse/calls"]   = parse_calls;
+    res["parse/bytes"]   = parse_bytes;
+    res["parse/seconds"] = parse_nanoseconds * 1.0e-9;
+
+    res["relay_io/reads"]         = io_reads;
+    res["relay_io/bytes_read"]    = io_bytes_read;
+    res["relay_io/writes"]        = io_writes;
+    res["relay_io/bytes_written"] = io_bytes_written;
+}
+
+//-----------------------------------------------------------------------------
+void
+record_allocate(index_t allocator_id,
+                size_t num_bytes)
+{
+    if(!detail::on())
+    {
+        return;
+    }
+    detail::AllocatorCounters &a = detail::allocator_counters(allocator_id);
+    detail::add(a.allocations, 1);
+    detail::add(a.bytes_allocated, (uint64)num_bytes);
+}
+
+//-----------------------------------------------------------------------------
+void
+record_free(index_t allocator_id)
+{
+    if(!detail::on())
+    {
+        return;
+    }
+    detail::add(detail::allocator_counters(allocator_id).frees, 1);
+}
+
+//-----------------------------------------------------------------------------
+void
+record_free_bytes(index_t allocator_id,
+                  size_t num_bytes)
+{
+    if(!detail::on())
+    {
+        return;
+    }
+    detail::add(detail::allocator_counters(allocator_id).bytes_freed,
+                (uint64)num_bytes);
+}
+
+//-----------------------------------------------------------------------------
+void
+record_memcpy(size_t num_bytes)
+{
+    if(!detail::on())
+    {
+        return;
+    }
+    detail::add(detail::counters.memcpy_calls, 1);
+    detail::add(detail::counters.memcpy_bytes, (uint64)num_bytes);
+}
+
+//-----------------------------------------------------------------------------
+void
+record_compact(size_t num_bytes)
+{
+    if(!detail::on())
+    {
+        return;
+    }
+    detail::add(detail::counters.compact_calls, 1);
+    detail::add(detail::counters.compact_bytes, (uint64)num_bytes);
+}
+
+//-----------------------------------------------------------------------------
+void
+record_conversion(size_t num_elements)
+{
+    if(!detail::on())
+    {
+        return;
+    }
+    detail::add(detail::counters.conversion_calls, 1);
+    detail::add(detail::counters.conversion_elements, (uint64)num_elements);
+}
+
+//-----------------------------------------------------------------------------
+void
+record_parse(size_t num_bytes,
+             double seconds)
+{
+    if(!detail::on())
+    {
+        return;
+    }
+    detail::add(detail::counters.parse_calls, 1);
+    detail::add(detail::counters.parse_bytes, (uint64)num_bytes);
+    detail::add(detail::counters.parse_nanoseconds,
+                (uint64)(seconds * 1.0e9));
+}
+
+//-----------------------------------------------------------------------------
+void
+record_io_read(size_t num_bytes)
+{
+    if(!detail::on())
+    {
+        return;
+    }
+    detail::add(detail::counters.io_reads, 1);
+    detail::add(detail::counters.io_bytes_read, (uint64)num_bytes);
+}
+
+//-----------------------------------------------------------------------------
+void
+record_io_write(size_t num_bytes)
+{
+    if(!detail::on())
+    {
+        return;
+    }
+    detail::add(detail::counters.io_writes, 1);
+    detail::add(detail::counters.io_bytes_written, (uint64)num_bytes);
+}
+
+}
+//-----------------------------------------------------------------------------
+// -- end conduit::instrumentation --
+//-----------------------------------------------------------------------------
+
+}
+//-----------------------------------------------------------------------------
+// -- end conduit:: --
+//-----------------------------------------------------------------------------
@@ -0,0 +1,112 @@
+// Copyright (c) Lawrence Livermore National Security, LLC and other Conduit
+// Project developers. See top-level LICENSE AND COPYRIGHT files for dates and
+// other details. No copyright assignment is required to contribute to Conduit.
+
+//-----------------------------------------------------------------------------
+///
+/// file: conduit_instrumentation.hpp
+///
+//-----------------------------------------------------------------------------
+
+#ifndef CONDUIT_INSTRUMENTATION_HPP
+#define CONDUIT_INSTRUMENTATION_HPP
+
+//-----------------------------------------------------------------------------
+// -- standard lib includes --
+//-----------------------------------------------------------------------------
+#include <cstddef>
+
+//-----------------------------------------------------------------------------
+// -- conduit includes --
+//-----------------------------------------------------------------------------
+#include "conduit_core.hpp"
+
+//-----------------------------------------------------------------------------
+// -- begin conduit:: --
+//-----------------------------------------------------------------------------
+namespace conduit
+{
+
+// fwd declare Node
+class Node;
+
+//-----------------------------------------------------------------------------
+// -- begin conduit::instrumentation --
+//-----------------------------------------------------------------------------
+///
+/// Counters for conduit's hot paths: bytes allocated and freed per
+/// allocator, conduit_memcpy bytes, compact_to calls, numeric dtype
+/// conversions, Generator parse time and relay io bytes.
+///
+/// The counters are always compiled in and are updated with relaxed
+/// atomics, but they are disabled by default. When disabled, recording
+/// only checks a flag. Enable them at runtime with enable(), or by setting
+/// the CONDUIT_INSTRUMENTATION environment variable to a non zero value.
+///
+/// Unlike conduit_annotations.hpp (Caliper regions), the counters don't
+/// need any third party libraries.
+///
+//-----------------------------------------------------------------------------
+namespace instrumentation
+{
+
+  //---------------------------------------------------------------------------
+  /// Runtime control
+  //---------------------------------------------------------------------------
+  void CONDUIT_API enable();
+  void CONDUIT_API disable();
+  bool CONDUIT_API enabled();
+
+  //---------------------------------------------------------------------------
+  /// Sets all counters to zero
+  //---------------------------------------------------------------------------
+  void CONDUIT_API reset();
+
+  //---------------------------------------------------------------------------
+  /// Returns the current counters, in the style of conduit::about():
+  ///
+  ///  enabled: "true" | "false"
+  ///  allocators:
+  ///    <allocator id>: (only allocators that were used)
+  ///      allocations, bytes_allocated, frees, bytes_freed
+  ///  memcpy: calls, bytes
+  ///  compact_to: calls, bytes
+  ///  conversions: calls, elements
+  ///  parse: calls, bytes, seconds
+  ///  relay_io: reads, bytes_read, writes, bytes_written
+  ///
+  /// bytes_freed counts leaf buffers released by Nodes (free handlers
+  /// aren't passed sizes). Allocator ids past the first 64 are combined
+  /// into the last entry.
+  //---------------------------------------------------------------------------
+  void CONDUIT_API snapshot(Node &res);
+
+  //---------------------------------------------------------------------------
+  /// Recording methods, used by conduit and relay.
+  /// These are no-ops when the counters are disabled.
+  //---------------------------------------------------------------------------
+  void CONDUIT_API record_allocate(index_t allocator_id,
+                                   size_t num_bytes);
+  void CONDUIT_API record_free(index_t allocator_id);
+  void CONDUIT_API record_free_bytes(index_t allocator_id,
+                                     size_t num_bytes);
+  void CONDUIT_API record_memcpy(size_t num_bytes);
+  void CONDUIT_API record_compact(size_t num_bytes);
+  void CONDUIT_API record_conversion(size_t num_elements);
+  void CONDUIT_API record_parse(size_t num_bytes,
+                                double seconds);
+  void CONDUIT_API record_io_read(size_t num_bytes);
+  void CONDUIT_API record_io_write(size_t num_bytes);
+
+}
+//-----------------------------------------------------------------------------
+// -- end conduit::instrumentation --
+//-----------------------------------------------------------------------------
+
+}
+//-----------------------------------------------------------------------------
+// -- end conduit:: --
+//-----------------------------------------------------------------------------
+
+
+#endif
@@ -27,6 +27,7 @@
 // -- standard cpp lib includes --
 //-----------------------------------------------------------------------------
 #include <algorithm>
+#include <atomic>
 #include <iostream>
 #include <map>
 
@@ -36,6 +37,7 @@
 #include <cstdio>
 #include <cstdlib>
 #include <cstring>
+#include <new>
 
 #include <sys/types.h>
 #include <sys/stat.h>
@@ -78,6 +80,8 @@ using namespace conduit::utils;
 namespace conduit
 {
 
+std::string Node::m_conduit_bin_schema_protocol = "json";
+
 //=============================================================================
 //-----------------------------------------------------------------------------
 //
@@ -112,12 +116,52 @@ Node::Node(const Node &node)
     set(node);
 }
 
+//---------------------------------------------------------------------------//
+Node::Node(Node &&node) noexcept
+{
+    // the passed node keeps the new empty schema from init_defaults(),
+    // if that allocation fails we terminate (as for any noexcept)
+    init_defaults();
+    swap(node);
+}
+
 //---------------------------------------------------------------------------//
 Node::~Node()
 {
     cleanup();
 }
 
+//---------------------------------------------------------------------------//
+Node::Node(Schema *schema_ptr,
+           Node *parent,
+           index_t allocator_id)
+{
+    m_data = NULL;
+    m_data_size = 0;
+    m_alloced = false;
+
+    m_mmaped    = false;
+    m_mmap      = NULL;
+
+    m_shared    = NULL;
+    // children inherit the parent's copy-on-write mode
+    m_copy_on_write = parent->m_copy_on_write;
+
+    m_schema = schema_ptr;
+    m_owns_schema = false;
+
+    m_parent = parent;
+    m_allocator_id = allocator_id;
+
+    // children share the parent's arena
+    m_arena = parent->m_arena;
+    m_arena_alloced = false;
+    if(m_arena != NULL)
+    {
+        m_arena->add_ref();
+    }
+}
+
 //---------------------------------------------------------------------------//
 void
 Node::reset()
@@ -394,7 +438,9 @@ Node::save(const std::string &obase,
         compact_to(res);
         std::string ofschema = obase + "_json";
 
-        res.schema().save(ofschema);
+        // json unless the binary schema encoding was requested,
+        // Schema::load() detects and reads both binary and json schemas
+        res.schema().save(ofschema,m_conduit_bin_schema_protocol);
         res.serialize(obase);
     }
     else if( proto == "yaml" ||
@@ -409,6 +455,27 @@ Node::save(const std::string &obase,
     }
 }
 
+//---------------------------------------------------------------------------//
+void
+Node::set_conduit_bin_schema_protocol(const std::string &protocol)
+{
+    if(protocol != "json" && protocol != "conduit_bin_schema")
+    {
+        CONDUIT_ERROR("<Node::set_conduit_bin_schema_protocol> "
+                      "unsupported schema protocol: "
+                      << "\"" << protocol << "\""
+                      << " (expected \"json\" or \"conduit_bin_schema\")");
+    }
+    m_conduit_bin_schema_protocol = protocol;
+}
+
+//---------------------------------------------------------------------------//
+std::string
+Node::conduit_bin_schema_protocol()
+{
+    return m_conduit_bin_schema_protocol;
+}
+
 //---------------------------------------------------------------------------//
 void
 Node::mmap(const std::string &stream_path)
@@ -482,10 +549,7 @@ Node::set_node(const Node &node)
         {
             Schema *curr_schema = &this->m_schema->add_child(*itr);
             size_t idx = (size_t) this->m_schema->child_index(*itr);
-            Node *curr_node = new Node();
-            curr_node->set_allocator(m_allocator_id);
-            curr_node->set_schema_ptr(curr_schema);
-            curr_node->set_parent(this);
+            Node *curr_node = create_child_node(curr_schema,m_allocator_id);
             curr_node->set(*node.m_children[idx]);
             this->append_node_ptr(curr_node);
         }
@@ -498,17 +562,18 @@ Node::set_node(const Node &node)
         {
             this->m_schema->append();
             Schema *curr_schema = this->m_schema->child_ptr(i);
-            Node *curr_node = new Node();
-            curr_node->set_allocator(m_allocator_id);
-            curr_node->set_schema_ptr(curr_schema);
-            curr_node->set_parent(this);
+            Node *curr_node = create_child_node(curr_schema,m_allocator_id);
             curr_node->set(*node.m_children[i]);
             this->append_node_ptr(curr_node);
         }
     }
     else if (node.dtype().id() != DataType::EMPTY_ID)
     {
-        node.compact_to(*this);
+        // in copy-on-write mode, share the source's buffer if we can
+        if(!m_copy_on_write || !share_data(node))
+        {
+            node.compact_to(*this);
+        }
     }
     else
     {
@@ -524,11 +589,28 @@ Node::set(const Node &node)
     set_node(node);
 }
 
+//---------------------------------------------------------------------------//
+void
+Node::set(Node &&node)
+{
+    if(this != &node)
+    {
+        move(node);
+    }
+}
+
 //---------------------------------------------------------------------------//
 void
 Node::set_dtype(const DataType &dtype)
 {
+    bool compatible = this->dtype().compatible(dtype);
+    void *prev_data = m_data;
     init(dtype);
+    // a reused buffer holds old values, zero it like a new allocation
+    if(!compatible && m_data != NULL && m_data == prev_data)
+    {
+        utils::conduit_memset(m_data,0,(size_t)dtype.spanned_bytes());
+    }
 }
 
 //---------------------------------------------------------------------------//
@@ -1671,6 +1753,146 @@ Node::set(const std::vector<float64> &data)
     set_float64_vector(data);
 }
 
+//---------------------------------------------------------------------------//
+void
+Node::set(std::vector<int8> &&data)
+{
+    if(can_adopt(DataType::int8((index_t)data.size())))
+    {
+        adopt(std::move(data));
+    }
+    else
+    {
+        set_int8_vector(data);
+    }
+}
+
+//---------------------------------------------------------------------------//
+void
+Node::set(std::vector<int16> &&data)
+{
+    if(can_adopt(DataType::int16((index_t)data.size())))
+    {
+        adopt(std::move(data));
+    }
+    else
+    {
+        set_int16_vector(data);
+    }
+}
+
+//---------------------------------------------------------------------------//
+void
+Node::set(std::vector<int32> &&data)
+{
+    if(can_adopt(DataType::int32((index_t)data.size())))
+    {
+        adopt(std::move(data));
+    }
+    else
+    {
+        set_int32_vector(data);
+    }
+}
+
+//---------------------------------------------------------------------------//
+void
+Node::set(std::vector<int64> &&data)
+{
+    if(can_adopt(DataType::int64((index_t)data.size())))
+    {
+        adopt(std::move(data));
+    }
+    else
+    {
+        set_int64_vector(data);
+    }
+}
+
+//---------------------------------------------------------------------------//
+void
+Node::set(std::vector<uint8> &&data)
+{
+    if(can_adopt(DataType::uint8((index_t)data.size())))
+    {
+        adopt(std::move(data));
+    }
+    else
+    {
+        set_uint8_vector(data);
+    }
+}
+
+//---------------------------------------------------------------------------//
+void
+Node::set(std::vector<uint16> &&data)
+{
+    if(can_adopt(DataType::uint16((index_t)data.size())))
+    {
+        adopt(std::move(data));
+    }
+    else
+    {
+        set_uint16_vector(data);
+    }
+}
+
+//---------------------------------------------------------------------------//
+void
+Node::set(std::vector<uint32> &&data)
+{
+    if(can_adopt(DataType::uint32((index_t)data.size())))
+    {
+        adopt(std::move(data));
+    }
+    else
+    {
+        set_uint32_vector(data);
+    }
+}
+
+//---------------------------------------------------------------------------//
+void
+Node::set(std::vector<uint64> &&data)
+{
+    if(can_adopt(DataType::uint64((index_t)data.size())))
+    {
+        adopt(std::move(data));
+    }
+    else
+    {
+        set_uint64_vector(data);
+    }
+}
+
+//---------------------------------------------------------------------------//
+void
+Node::set(std::vector<float32> &&data)
+{
+    if(can_adopt(DataType::float32((index_t)data.size())))
+    {
+        adopt(std::move(data));
+    }
+    else
+    {
+        set_float32_vector(data);
+    }
+}
+
+//---------------------------------------------------------------------------//
+void
+Node::set(std::vector<float64> &&data)
+{
+    if(can_adopt(DataType::float64((index_t)data.size())))
+    {
+        adopt(std::move(data));
+    }
+    else
+    {
+        set_float64_vector(data);
+    }
+}
+
 
 //-----------------------------------------------------------------------------
 // set vector gap methods for c-native types
@@ -4545,6 +4767,9 @@ Node::set_path(const std::string &path,
 void
 Node::set_external_node(const Node &node)
 {
+    // writes through external pointers must not reach other nodes that
+    // share the source's buffers, so the source gets its own copies
+    const_cast<Node&>(node).unshare_all_data();
     reset();
     m_schema->set(node.schema());
     mirror_node(this,m_schema,&node);
@@ -7384,6 +7609,17 @@ Node::set_path_external(const std::string &path,
 // -- assignment operators for generic types --
 //-----------------------------------------------------------------------------
 
+//---------------------------------------------------------------------------//
+Node &
+Node::operator=(Node &&node)
+{
+    if(this != &node)
+    {
+        move(node);
+    }
+    return *this;
+}
+
 //---------------------------------------------------------------------------//
 Node &
 Node::operator=(const Node &node)
@@ -8007,6 +8243,86 @@ Node::operator=(const std::vector<float64> &data)
     return *this;
 }
 
+//---------------------------------------------------------------------------//
+Node &
+Node::operator=(std::vector<int8> &&data)
+{
+    set(std::move(data));
+    return *this;
+}
+
+//---------------------------------------------------------------------------//
+Node &
+Node::operator=(std::vector<int16> &&data)
+{
+    set(std::move(data));
+    return *this;
+}
+
+//---------------------------------------------------------------------------//
+Node &
+Node::operator=(std::vector<int32> &&data)
+{
+    set(std::move(data));
+    return *this;
+}
+
+//---------------------------------------------------------------------------//
+Node &
+Node::operator=(std::vector<int64> &&data)
+{
+    set(std::move(data));
+    return *this;
+}
+
+//---------------------------------------------------------------------------//
+Node &
+Node::operator=(std::vector<uint8> &&data)
+{
+    set(std::move(data));
+    return *this;
+}
+
+//---------------------------------------------------------------------------//
+Node &
+Node::operator=(std::vector<uint16> &&data)
+{
+    set(std::move(data));
+    return *this;
+}
+
+//---------------------------------------------------------------------------//
+Node &
+Node::operator=(std::vector<uint32> &&data)
+{
+    set(std::move(data));
+    return *this;
+}
+
+//---------------------------------------------------------------------------//
+Node &
+Node::operator=(std::vector<uint64> &&data)
+{
+    set(std::move(data));
+    return *this;
+}
+
+//---------------------------------------------------------------------------//
+Node &
+Node::operator=(std::vector<float32> &&data)
+{
+    set(std::move(data));
+    return *this;
+}
+
+//---------------------------------------------------------------------------//
+Node &
+Node::operator=(std::vector<float64> &&data)
+{
+    set(std::move(data));
+    return *this;
+}
+
 //-----------------------------------------------------------------------------
 // assignment operator gap methods for vector c-native types
 //-----------------------------------------------------------------------------
@@ -8447,36 +8763,27 @@ Node::serialize(const std::string &stream_path) const
 void
 Node::serialize(std::ofstream &ofs) const
 {
-    index_t dtype_id = dtype().id();
-    if( dtype_id == DataType::OBJECT_ID ||
-        dtype_id == DataType::LIST_ID)
-    {
-        std::vector<Node*>::const_iterator itr;
-        for(itr = m_children.begin(); itr < m_children.end(); ++itr)
-        {
-            (*itr)->serialize(ofs);
-        }
-    }
-    else if( dtype_id != DataType::EMPTY_ID)
+    std::vector<uint8> staging;
+    serialize(ofs,staging);
+}
+
+//---------------------------------------------------------------------------//
+void
+Node::serialize_iov(std::vector<std::pair<const void*,index_t> > &iov,
+                    std::vector<uint8> &staging) const
+{
+    iov.clear();
+    // size staging for all non compact leaves up front, so pointers
+    // into it stay valid
+    size_t staging_bytes = (size_t) serialize_iov_staging_bytes();
+    if(staging.size() < staging_bytes)
     {
-        if(is_compact())
-        {
-            // ser as is. This copies stride * num_ele bytes
-            {
-                ofs.write((const char*)element_ptr(0),
-                          total_strided_bytes());
-            }
-        }
-        else
-        {
-            // copy all elements
-            size_t c_num_bytes = (size_t) total_bytes_compact();
-            uint8 *buffer = new uint8[c_num_bytes];
-            compact_elements_to(buffer);
-            ofs.write((const char*)buffer,c_num_bytes);
-            delete [] buffer;
-        }
+        staging.resize(staging_bytes);
     }
+    index_t staging_offset = 0;
+    serialize_iov(iov,
+                  staging_bytes > 0 ? &staging[0] : NULL,
+                  staging_offset);
 }
 
 //-----------------------------------------------------------------------------
@@ -8489,6 +8796,7 @@ Node::compact_to(Node &n_dest) const
 {
     n_dest.reset();
     index_t c_size = total_bytes_compact();
+    instrumentation::record_compact((size_t)c_size);
 
     // avoid allocation for zero-bytes cases
     if(c_size > 0)
@@ -8503,19 +8811,75 @@ Node::compact_to(Node &n_dest) const
     walk_schema(&n_dest,n_dest.m_schema,n_dest_data,m_allocator_id);
 }
 
-//-----------------------------------------------------------------------------
-// -- update methods ---
-//-----------------------------------------------------------------------------
-
 //---------------------------------------------------------------------------//
 void
-Node::update(const Node &n_src)
+Node::compact_to_arena(Node &n_dest) const
 {
-    // walk src and add it contents to this node
-    /// TODO:
-    /// arrays and non empty leaves will simply overwrite the current
-    /// node, these semantics seem sensible, but we could revisit this
-    index_t dtype_id = n_src.dtype().id();
+    if(n_dest.m_parent != NULL)
+    {
+        CONDUIT_ERROR("Cannot compact_to_arena into Node(" << n_dest.path()
+                      << "), the arena mode is only supported for root Nodes.");
+    }
+
+    if(n_dest.is_arena_enabled())
+    {
+        // reuse the existing arena, resetting returns the old skeleton
+        n_dest.reset();
+    }
+    else
+    {
+        n_dest.enable_arena();
+    }
+
+    // one slab for the whole skeleton
+    n_dest.m_arena->reserve(arena_skeleton_bytes(*m_schema));
+
+    index_t c_size = total_bytes_compact();
+    instrumentation::record_compact((size_t)c_size);
+
+    // avoid allocation for zero-bytes cases
+    if(c_size > 0)
+    {
+        n_dest.allocate(c_size);
+    }
+
+    m_schema->compact_to(*n_dest.schema_ptr());
+    uint8 *n_dest_data = (uint8*)n_dest.m_data;
+
+    // if our leaves are already compact and back to back,
+    // we can copy all of the data at once
+    const void *src_data = NULL;
+    if(c_size > 0 && is_compact())
+    {
+        src_data = contiguous_data_ptr();
+    }
+
+    if(src_data != NULL)
+    {
+        utils::conduit_memcpy(n_dest_data,src_data,(size_t)c_size);
+    }
+    else
+    {
+        compact_to(n_dest_data,0);
+    }
+
+    // need node structure
+    walk_schema(&n_dest,n_dest.m_schema,n_dest_data,m_allocator_id);
+}
+
+//-----------------------------------------------------------------------------
+// -- update methods ---
+//-----------------------------------------------------------------------------
+
+//---------------------------------------------------------------------------//
+void
+Node::update(const Node &n_src)
+{
+    // walk src and add it contents to this node
+    /// TODO:
+    /// arrays and non empty leaves will simply overwrite the current
+    /// node, these semantics seem sensible, but we could revisit this
+    index_t dtype_id = n_src.dtype().id();
     if( dtype_id == DataType::OBJECT_ID)
     {
         const std::vector<std::string> &scld_names = n_src.child_names();
@@ -8561,9 +8925,24 @@ Node::update(const Node &n_src)
 
         // if you have the same type dtype, but less elements in the
         // src, it will copy them
-        if( (this->dtype().id() == n_src.dtype().id()) &&
-                 (this->dtype().number_of_elements() >=
-                   n_src.dtype().number_of_elements()))
+        bool in_place = (this->dtype().id() == n_src.dtype().id()) &&
+                        (this->dtype().number_of_elements() >=
+                          n_src.dtype().number_of_elements());
+
+        // in copy-on-write mode, share the source's buffer when it
+        // replaces all of our data and we are not a view of external
+        // or parent owned memory
+        bool share = m_copy_on_write &&
+                     ( !in_place ||
+                       ( (m_alloced || m_shared != NULL) &&
+                         this->dtype().number_of_elements() ==
+                           n_src.dtype().number_of_elements()));
+
+        if(share && share_data(n_src))
+        {
+            // nothing more to do
+        }
+        else if(in_place)
         {
             size_t ele_bytes  = (size_t) dtype().element_bytes();
             size_t stride     = (size_t) dtype().stride();
@@ -8592,6 +8971,27 @@ Node::update_compatible(const Node &n_src)
 {
     // walk src and copy contents to this node if their entries match
     index_t dtype_id = n_src.dtype().id();
+
+    // fast path: identical compact + contiguous trees can be copied
+    // with a single memcpy
+    if( (dtype_id == DataType::OBJECT_ID || dtype_id == DataType::LIST_ID) &&
+        is_compact() &&
+        schema().equals(n_src.schema()))
+    {
+        void       *dest_ptr = contiguous_data_ptr();
+        const void *src_ptr  = n_src.contiguous_data_ptr();
+        if(dest_ptr != NULL && src_ptr != NULL)
+        {
+            if(dest_ptr != src_ptr)
+            {
+                utils::conduit_memcpy(dest_ptr,
+                                      src_ptr,
+                                      (size_t)total_bytes_compact());
+            }
+            return;
+        }
+    }
+
     if( dtype_id == DataType::OBJECT_ID)
     {
         const std::vector<std::string> &scld_names = n_src.child_names();
@@ -8733,6 +9133,7 @@ Node::swap(Node &n_b)
                          "failed to find schema child index in this Node's parent.");
         }
 
+        a_parent_schema->invalidate_fingerprint();
         a_parent_schema->children()[idx] = schema_b;
     }
 
@@ -8752,6 +9153,7 @@ Node::swap(Node &n_b)
 
         }
 
+        b_parent_schema->invalidate_fingerprint();
         b_parent_schema->children()[idx] = schema_a;
     }
 
@@ -8764,6 +9166,7 @@ Node::swap(Node &n_b)
     // if data is allocated or not
     // if data is memory mapped or not
     // memory map
+    // shared data
     // the allocator id
     // any children
     std::swap(m_data,n_b.m_data);
@@ -8773,10 +9176,21 @@ Node::swap(Node &n_b)
     std::swap(m_alloced,n_b.m_alloced);
     std::swap(m_mmaped,n_b.m_mmaped);
     std::swap(m_mmap,n_b.m_mmap);
+    std::swap(m_shared,n_b.m_shared);
     std::swap(m_allocator_id,n_b.m_allocator_id);
     // this should be an efficient O(1)
     std::swap(m_children,n_b.m_children);
 
+    // the children now belong to their new owners
+    for(size_t i=0; i < m_children.size(); i++)
+    {
+        m_children[i]->m_parent = this;
+    }
+
+    for(size_t i=0; i < n_b.m_children.size(); i++)
+    {
+        n_b.m_children[i]->m_parent = &n_b;
+    }
 }
 
 
@@ -14338,9 +14752,9 @@ Node::to_base64(Node &n,
 
     // since we use compact_to(n) above, the data will always compact
     // and on the host, so we can use it directly in utils::base64_encode
+    // (base64_encode writes the entire buffer, no need to zero it first)
     const char *src_ptr = (const char*)n.data_ptr();
     char *dest_ptr       = (char*)bb64_data.data_ptr();
-    utils::conduit_memset(dest_ptr,0,(size_t)enc_buff_size);
 
     utils::base64_encode(src_ptr,nbytes,dest_ptr);
 }
@@ -14581,10 +14995,7 @@ Node::add_child(const std::string &name)
 
     Schema &child_schema = m_schema->add_child(name);
     Schema *child_ptr = &child_schema;
-    Node *child_node = new Node();
-    child_node->set_allocator(m_allocator_id);
-    child_node->set_schema_ptr(child_ptr);
-    child_node->m_parent = this;
+    Node *child_node = create_child_node(child_ptr,m_allocator_id);
     m_children.push_back(child_node);
     return  *m_children[m_children.size() - 1];
 }
@@ -14768,12 +15179,8 @@ Node::fetch(const std::string &path)
     if(!m_schema->has_child(p_curr))
     {
         Schema *schema_ptr = m_schema->fetch_ptr(p_curr);
-        Node *curr_node = new Node();
-        curr_node->set_allocator(m_allocator_id);
-        curr_node->set_schema_ptr(schema_ptr);
-        curr_node->m_parent = this;
         // current allocator is inherited
-        curr_node->set_allocator(m_allocator_id);
+        Node *curr_node = create_child_node(schema_ptr,m_allocator_id);
         m_children.push_back(curr_node);
         idx = m_children.size() - 1;
     }
@@ -14891,6 +15298,62 @@ Node::operator[](index_t idx) const
     return child(idx);
 }
 
+//---------------------------------------------------------------------------//
+Node&
+Node::fetch(const Path &path)
+{
+    return path.fetch(*this);
+}
+
+//---------------------------------------------------------------------------//
+const Node&
+Node::fetch(const Path &path) const
+{
+    return path.fetch_existing(*this);
+}
+
+//---------------------------------------------------------------------------//
+Node&
+Node::fetch_existing(const Path &path)
+{
+    return path.fetch_existing(*this);
+}
+
+//---------------------------------------------------------------------------//
+const Node&
+Node::fetch_existing(const Path &path) const
+{
+    return path.fetch_existing(*this);
+}
+
+//---------------------------------------------------------------------------//
+Node *
+Node::fetch_ptr(const Path &path)
+{
+    return &path.fetch(*this);
+}
+
+//---------------------------------------------------------------------------//
+const Node *
+Node::fetch_ptr(const Path &path) const
+{
+    return path.fetch_ptr(*this);
+}
+
+//---------------------------------------------------------------------------//
+Node&
+Node::operator[](const Path &path)
+{
+    return path.fetch(*this);
+}
+
+//---------------------------------------------------------------------------//
+const Node&
+Node::operator[](const Path &path) const
+{
+    return path.fetch_existing(*this);
+}
+
 //---------------------------------------------------------------------------//
 index_t
 Node::number_of_children() const
@@ -14926,6 +15389,13 @@ Node::has_path(const std::string &path) const
     return m_schema->has_path(path);
 }
 
+//---------------------------------------------------------------------------//
+bool
+Node::has_path(const Path &path) const
+{
+    return path.fetch_ptr(*this) != NULL;
+}
+
 //---------------------------------------------------------------------------//
 const std::vector<std::string>&
 Node::child_names() const
@@ -14945,10 +15415,7 @@ Node::append()
     m_schema->append();
     Schema *schema_ptr = m_schema->child_ptr(idx);
 
-    Node *res_node = new Node();
-    res_node->set_allocator(m_allocator_id);
-    res_node->set_schema_ptr(schema_ptr);
-    res_node->m_parent=this;
+    Node *res_node = create_child_node(schema_ptr,m_allocator_id);
     m_children.push_back(res_node);
     return *res_node;
 }
@@ -14962,7 +15429,7 @@ Node::remove(index_t idx)
     // to cleanup
 
     // remove the proper list entry
-    delete m_children[(size_t)idx];
+    destroy_child_node(m_children[(size_t)idx]);
     m_schema->remove(idx);
     m_children.erase(m_children.begin() + (size_t)idx);
 }
@@ -14994,7 +15461,7 @@ Node::remove_child(const std::string &name)
    // note: we must remove the child pointer before the
    // schema. b/c the child pointer uses the schema
    // to cleanup
-   delete m_children[idx];
+   destroy_child_node(m_children[idx]);
    m_schema->remove_child(name);
    m_children.erase(m_children.begin() + idx);
 }
@@ -15490,7 +15957,7 @@ Node::as_int8_array()
                         DataType::INT8_ID,
                         "as_int8_array()",
                         int8_array());
-    return int8_array(m_data,dtype());
+    return int8_array(data_ptr(),dtype());
 }
 
 //---------------------------------------------------------------------------//
@@ -15501,7 +15968,7 @@ Node::as_int16_array()
                         DataType::INT16_ID,
                         "as_int16_array()",
                         int16_array());
-    return int16_array(m_data,dtype());
+    return int16_array(data_ptr(),dtype());
 }
 
 //---------------------------------------------------------------------------//
@@ -15512,7 +15979,7 @@ Node::as_int32_array()
                         DataType::INT32_ID,
                         "as_int32_array()",
                         int32_array());
-    return int32_array(m_data,dtype());
+    return int32_array(data_ptr(),dtype());
 }
 
 //---------------------------------------------------------------------------//
@@ -15523,7 +15990,7 @@ Node::as_int64_array()
                         DataType::INT64_ID,
                         "as_int64_array()",
                         int64_array());
-    return int64_array(m_data,dtype());
+    return int64_array(data_ptr(),dtype());
 }
 
 //---------------------------------------------------------------------------//
@@ -15538,7 +16005,7 @@ Node::as_uint8_array()
                         DataType::UINT8_ID,
                         "as_uint8_array()",
                         uint8_array());
-    return uint8_array(m_data,dtype());
+    return uint8_array(data_ptr(),dtype());
 }
 
 //---------------------------------------------------------------------------//
@@ -15549,7 +16016,7 @@ Node::as_uint16_array()
                         DataType::UINT16_ID,
                         "as_uint16_array()",
                         uint16_array());
-    return uint16_array(m_data,dtype());
+    return uint16_array(data_ptr(),dtype());
 }
 
 //---------------------------------------------------------------------------//
@@ -15560,7 +16027,7 @@ Node::as_uint32_array()
                         DataType::UINT32_ID,
                         "as_uint32_array()",
                         uint32_array());
-    return uint32_array(m_data,dtype());
+    return uint32_array(data_ptr(),dtype());
 }
 
 //---------------------------------------------------------------------------//
@@ -15571,7 +16038,7 @@ Node::as_uint64_array()
                         DataType::UINT64_ID,
                         "as_uint64_array()",
                         uint64_array());
-    return uint64_array(m_data,dtype());
+    return uint64_array(data_ptr(),dtype());
 }
 
 //---------------------------------------------------------------------------//
@@ -15586,7 +16053,7 @@ Node::as_float32_array()
                         DataType::FLOAT32_ID,
                         "as_float32_array()",
                         float32_array());
-    return float32_array(m_data,dtype());
+    return float32_array(data_ptr(),dtype());
 }
 
 //---------------------------------------------------------------------------//
@@ -15597,7 +16064,7 @@ Node::as_float64_array()
                         DataType::FLOAT64_ID,
                         "as_float64_array()",
                         float64_array());
-    return float64_array(m_data,dtype());
+    return float64_array(data_ptr(),dtype());
 }
 
 //---------------------------------------------------------------------------//
@@ -15869,6 +16336,7 @@ Node::as_index_t_accessor() const
 void *
 Node::data_ptr()
 {
+    unshare_data();
     return m_data;
 }
 
@@ -16625,7 +17093,7 @@ Node::as_char_array()
                         CONDUIT_NATIVE_CHAR_ID,
                         "as_char_array()",
                         char_array());
-    return char_array(m_data,dtype());
+    return char_array(data_ptr(),dtype());
 }
 
 //---------------------------------------------------------------------------//
@@ -16636,7 +17104,7 @@ Node::as_short_array()
                         CONDUIT_NATIVE_SHORT_ID,
                         "as_short_array()",
                         short_array());
-    return short_array(m_data,dtype());
+    return short_array(data_ptr(),dtype());
 }
 
 //---------------------------------------------------------------------------//
@@ -16647,7 +17115,7 @@ Node::as_int_array()
                         CONDUIT_NATIVE_INT_ID,
                         "as_int_array()",
                         int_array());
-    return int_array(m_data,dtype());
+    return int_array(data_ptr(),dtype());
 }
 
 //---------------------------------------------------------------------------//
@@ -16658,7 +17126,7 @@ Node::as_long_array()
                         CONDUIT_NATIVE_LONG_ID,
                         "as_long_array()",
                         long_array());
-    return long_array(m_data,dtype());
+    return long_array(data_ptr(),dtype());
 }
 
 //---------------------------------------------------------------------------//
@@ -16672,7 +17140,7 @@ Node::as_long_long_array()
                         CONDUIT_NATIVE_LONG_LONG_ID,
                         "as_long_long_array()",
                         long_long_array());
-    return long_long_array(m_data,dtype());
+    return long_long_array(data_ptr(),dtype());
 }
 //---------------------------------------------------------------------------//
 #endif
@@ -16691,7 +17159,7 @@ Node::as_signed_char_array()
                         CONDUIT_NATIVE_SIGNED_CHAR_ID,
                         "as_signed_char_array()",
                         signed_char_array());
-    return signed_char_array(m_data,dtype());
+    return signed_char_array(data_ptr(),dtype());
 }
 
 //---------------------------------------------------------------------------//
@@ -16702,7 +17170,7 @@ Node::as_signed_short_array()
                         CONDUIT_NATIVE_SIGNED_SHORT_ID,
                         "as_signed_short_array()",
                         signed_short_array());
-    return signed_short_array(m_data,dtype());
+    return signed_short_array(data_ptr(),dtype());
 }
 
 //---------------------------------------------------------------------------//
@@ -16713,7 +17181,7 @@ Node::as_signed_int_array()
                         CONDUIT_NATIVE_SIGNED_INT_ID,
                         "as_signed_int_array()",
                         int_array());
-    return signed_int_array(m_data,dtype());
+    return signed_int_array(data_ptr(),dtype());
 }
 
 //---------------------------------------------------------------------------//
@@ -16724,7 +17192,7 @@ Node::as_signed_long_array()
                         CONDUIT_NATIVE_SIGNED_LONG_ID,
                         "as_signed_long_array()",
                         signed_long_array());
-    return signed_long_array(m_data,dtype());
+    return signed_long_array(data_ptr(),dtype());
 }
 
 //---------------------------------------------------------------------------//
@@ -16738,7 +17206,7 @@ Node::as_signed_long_long_array()
                         CONDUIT_NATIVE_SIGNED_LONG_LONG_ID,
                         "as_signed_long_long_array()",
                         signed_long_long_array());
-    return signed_long_long_array(m_data,dtype());
+    return signed_long_long_array(data_ptr(),dtype());
 }
 //---------------------------------------------------------------------------//
 #endif
@@ -16757,7 +17225,7 @@ Node::as_unsigned_char_array()
                         CONDUIT_NATIVE_UNSIGNED_CHAR_ID,
                         "as_unsigned_char_array()",
                         unsigned_char_array());
-    return unsigned_char_array(m_data,dtype());
+    return unsigned_char_array(data_ptr(),dtype());
 }
 
 //---------------------------------------------------------------------------//
@@ -16768,7 +17236,7 @@ Node::as_unsigned_short_array()
                         CONDUIT_NATIVE_UNSIGNED_SHORT_ID,
                         "as_unsigned_short_array()",
                         unsigned_short_array());
-    return unsigned_short_array(m_data,dtype());
+    return unsigned_short_array(data_ptr(),dtype());
 }
 
 //---------------------------------------------------------------------------//
@@ -16779,7 +17247,7 @@ Node::as_unsigned_int_array()
                         CONDUIT_NATIVE_UNSIGNED_INT_ID,
                         "as_unsigned_int_array()",
                         unsigned_int_array());
-    return unsigned_int_array(m_data,dtype());
+    return unsigned_int_array(data_ptr(),dtype());
 }
 
 //---------------------------------------------------------------------------//
@@ -16790,7 +17258,7 @@ Node::as_unsigned_long_array()
                         CONDUIT_NATIVE_UNSIGNED_LONG_ID,
                         "as_unsigned_long_array()",
                         unsigned_long_array());
-    return unsigned_long_array(m_data,dtype());
+    return unsigned_long_array(data_ptr(),dtype());
 }
 
 //---------------------------------------------------------------------------//
@@ -16804,7 +17272,7 @@ Node::as_unsigned_long_long_array()
                         CONDUIT_NATIVE_UNSIGNED_LONG_LONG_ID,
                         "as_unsigned_long_long_array()",
                         unsigned_long_long_array());
-    return unsigned_long_long_array(m_data,dtype());
+    return unsigned_long_long_array(data_ptr(),dtype());
 }
 
 //---------------------------------------------------------------------------//
@@ -16824,7 +17292,7 @@ Node::as_float_array()
                         CONDUIT_NATIVE_FLOAT_ID,
                         "as_float_array()",
                         float_array());
-    return float_array(m_data,dtype());
+    return float_array(data_ptr(),dtype());
 }
 
 //---------------------------------------------------------------------------//
@@ -16835,7 +17303,7 @@ Node::as_double_array()
                         CONDUIT_NATIVE_DOUBLE_ID,
                         "as_double_array()",
                         double_array());
-    return double_array(m_data,dtype());
+    return double_array(data_ptr(),dtype());
 }
 
 //---------------------------------------------------------------------------//
@@ -16848,7 +17316,7 @@ Node::as_long_double_array()
                         CONDUIT_NATIVE_LONG_DOUBLE_ID,
                         "as_long_double_array()",
                         long_double_array());
-    return long_double_array(m_data,dtype());
+    return long_double_array(data_ptr(),dtype());
 }
 //---------------------------------------------------------------------------//
 #endif
@@ -17140,6 +17608,108 @@ Node::allocator() const
 //
 //-----------------------------------------------------------------------------
 
+//-----------------------------------------------------------------------------
+//
+// -- begin definition of Node tree arena methods --
+//
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+void
+Node::enable_arena(index_t slab_size)
+{
+    if(m_parent != NULL)
+    {
+        CONDUIT_ERROR("Cannot enable arena for Node(" << path() << "), "
+                      "the arena mode is only supported for root Nodes.");
+    }
+
+    if(m_arena != NULL)
+    {
+        return;
+    }
+
+    reset();
+    m_arena = new Arena(slab_size > 0 ? (size_t)slab_size : 0);
+    m_arena->add_ref();
+    // child schemas are created by our schema, so it shares the arena
+    m_schema->set_arena(m_arena);
+}
+
+//-----------------------------------------------------------------------------
+void
+Node::disable_arena()
+{
+    if(m_arena == NULL)
+    {
+        return;
+    }
+
+    if(m_parent != NULL)
+    {
+        CONDUIT_ERROR("Cannot disable arena for Node(" << path() << "), "
+                      "the arena mode is only supported for root Nodes.");
+    }
+
+    reset();
+    m_schema->set_arena(NULL);
+    Arena::release(m_arena);
+    m_arena = NULL;
+}
+
+//-----------------------------------------------------------------------------
+void
+Node::arena_info(Node &res) const
+{
+    res.reset();
+    if(m_arena != NULL)
+    {
+        m_arena->info(res);
+    }
+}
+
+//-----------------------------------------------------------------------------
+//
+// -- end definition of Node tree arena methods --
+//
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+//
+// -- begin definition of Node copy-on-write methods --
+//
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+void
+Node::enable_copy_on_write()
+{
+    m_copy_on_write = true;
+    for(size_t i = 0; i < m_children.size(); i++)
+    {
+        m_children[i]->enable_copy_on_write();
+    }
+}
+
+//-----------------------------------------------------------------------------
+void
+Node::disable_copy_on_write()
+{
+    // leaves that already share data keep sharing it until they are
+    // modified, only future sets copy
+    m_copy_on_write = false;
+    for(size_t i = 0; i < m_children.size(); i++)
+    {
+        m_children[i]->disable_copy_on_write();
+    }
+}
+
+//-----------------------------------------------------------------------------
+//
+// -- end definition of Node copy-on-write methods --
+//
+//-----------------------------------------------------------------------------
+
 //-----------------------------------------------------------------------------
 //
 // -- begin definition of Node as accessor methods --
@@ -17343,6 +17913,44 @@ Node::set_schema_ptr(Schema *schema_ptr)
     m_schema = schema_ptr;
 }
 
+//---------------------------------------------------------------------------//
+Node *
+Node::create_child_node(Schema *schema_ptr,
+                        index_t allocator_id)
+{
+    Node *res = NULL;
+    if(m_arena != NULL)
+    {
+        res = new (m_arena->allocate(sizeof(Node))) Node(schema_ptr,
+                                                         this,
+                                                         allocator_id);
+        res->m_arena_alloced = true;
+    }
+    else
+    {
+        res = new Node(schema_ptr,this,allocator_id);
+    }
+    return res;
+}
+
+//---------------------------------------------------------------------------//
+void
+Node::destroy_child_node(Node *node)
+{
+    if(node->m_arena_alloced)
+    {
+        // the node's own reference is dropped by its destructor,
+        // the arena stays alive until the allocation is returned
+        Arena *arena = node->m_arena;
+        node->~Node();
+        Arena::deallocate(arena,node);
+    }
+    else
+    {
+        delete node;
+    }
+}
+
 //---------------------------------------------------------------------------//
 void
 Node::set_data_ptr(void *data)
@@ -17394,6 +18002,15 @@ class Node::MMap
       void  open(const std::string &path,
                  index_t data_size);
 
+      //----------------------------------------------------------------------
+      // opens the file read-only and maps it copy-on-write
+      void  open_read_only(const std::string &path,
+                           index_t data_size);
+
+      //----------------------------------------------------------------------
+      // passes an access pattern hint for the mapping to the os
+      void  advise(const std::string &advice);
+
       //----------------------------------------------------------------------
       void  close();
 
@@ -17403,7 +18020,7 @@ class Node::MMap
 
   private:
       void      *m_data;
-      int        m_data_size;
+      index_t    m_data_size;
 
 #if !defined(CONDUIT_PLATFORM_WINDOWS)
       // memory-map file descriptor
@@ -17463,7 +18080,7 @@ Node::MMap::open(const std::string &path,
     }
 
     m_data = ::mmap(0,
-                    m_data_size,
+                    (size_t)m_data_size,
                     (PROT_READ | PROT_WRITE),
                     MAP_SHARED,
                     m_mmap_fd, 0);
@@ -17499,7 +18116,7 @@ Node::MMap::open(const std::string &path,
                            FILE_MAP_ALL_ACCESS,
                            0, 0, 0);
 
-    m_data_size = (int)data_size;
+    m_data_size = data_size;
 
     if (m_data == NULL)
     {
@@ -17512,25 +18129,155 @@ Node::MMap::open(const std::string &path,
 
 //-----------------------------------------------------------------------------
 void
-Node::MMap::close()
+Node::MMap::open_read_only(const std::string &path,
+                           index_t data_size)
 {
-    // simple return if the mmap isn't active
-    if(m_data == NULL)
-        return;
+    if(m_data != NULL)
+    {
+        CONDUIT_ERROR("<Node::load_mmap> mmap already open");
+    }
 
 #if !defined(CONDUIT_PLATFORM_WINDOWS)
+    m_mmap_fd = ::open(path.c_str(), O_RDONLY);
 
-    if(munmap(m_data, m_data_size) == -1)
+    if (m_mmap_fd == -1)
     {
-        CONDUIT_ERROR("<Node::mmap> failed to unmap mmap.");
+        CONDUIT_ERROR("<Node::load_mmap> failed to open file: "
+                     << "\"" << path << "\"");
     }
 
-    if(::close(m_mmap_fd) == -1)
+    // the file is never extended, so make sure it holds all of the data
+    struct stat file_stat;
+    if(fstat(m_mmap_fd,&file_stat) == -1 ||
+       (index_t)file_stat.st_size < data_size)
     {
-        CONDUIT_ERROR("<Node::mmap> failed close mmap filed descriptor.");
+        ::close(m_mmap_fd);
+        m_mmap_fd = -1;
+        CONDUIT_ERROR("<Node::load_mmap> file: "
+                      << "\"" << path << "\""
+                      << " is smaller than its schema ("
+                      << data_size << " bytes)");
     }
 
-    m_mmap_fd   = -1;
+    // empty mappings are not allowed, map at least one byte
+    m_data_size = data_size > 0 ? data_size : 1;
+
+    // private + writable: pages are shared with the page cache until
+    // they are written to, writes are never carried to the file
+    m_data = ::mmap(0,
+                    (size_t)m_data_size,
+                    (PROT_READ | PROT_WRITE),
+                    MAP_PRIVATE,
+                    m_mmap_fd, 0);
+
+    if (m_data == MAP_FAILED)
+    {
+        m_data = NULL;
+        ::close(m_mmap_fd);
+        m_mmap_fd = -1;
+        CONDUIT_ERROR("<Node::load_mmap> mmap data = MAP_FAILED" << path);
+    }
+#else
+    m_file_hnd = CreateFile(path.c_str(),
+                            GENERIC_READ,
+                            FILE_SHARE_READ,
+                            NULL,
+                            OPEN_EXISTING,
+                            FILE_FLAG_RANDOM_ACCESS,
+                            NULL);
+
+    if (m_file_hnd == INVALID_HANDLE_VALUE)
+    {
+        CONDUIT_ERROR("<Node::load_mmap> CreateFile() Failed ");
+    }
+
+    m_map_hnd = CreateFileMapping(m_file_hnd,
+                                  NULL,
+                                  PAGE_WRITECOPY,
+                                  0, 0, 0);
+
+    if (m_map_hnd == NULL)
+    {
+        CloseHandle(m_file_hnd);
+        CONDUIT_ERROR("<Node::load_mmap> CreateFileMapping() failed with error" << GetLastError());
+    }
+
+    m_data = MapViewOfFile(m_map_hnd,
+                           FILE_MAP_COPY,
+                           0, 0, 0);
+
+    m_data_size = data_size;
+
+    if (m_data == NULL)
+    {
+        CloseHandle(m_map_hnd);
+        CloseHandle(m_file_hnd);
+        CONDUIT_ERROR("<Node::load_mmap> MapViewOfFile() failed with error" << GetLastError());
+    }
+#endif
+}
+
+//-----------------------------------------------------------------------------
+void
+Node::MMap::advise(const std::string &advice)
+{
+#if !defined(CONDUIT_PLATFORM_WINDOWS)
+    int posix_advice = POSIX_MADV_NORMAL;
+    if(advice == "normal")
+    {
+        posix_advice = POSIX_MADV_NORMAL;
+    }
+    else if(advice == "sequential")
+    {
+        posix_advice = POSIX_MADV_SEQUENTIAL;
+    }
+    else if(advice == "random")
+    {
+        posix_advice = POSIX_MADV_RANDOM;
+    }
+    else if(advice == "willneed")
+    {
+        posix_advice = POSIX_MADV_WILLNEED;
+    }
+    else
+    {
+        CONDUIT_ERROR("<Node::load_mmap> unknown advice: \"" << advice << "\""
+                      << " (expected: \"normal\", \"sequential\","
+                      << " \"random\", or \"willneed\")");
+    }
+
+    if(m_data != NULL)
+    {
+        // advice is only a hint, failures are not fatal
+        posix_madvise(m_data,(size_t)m_data_size,posix_advice);
+    }
+#else
+    // no equivalent for file mappings
+    (void)advice;
+#endif
+}
+
+//-----------------------------------------------------------------------------
+void
+Node::MMap::close()
+{
+    // simple return if the mmap isn't active
+    if(m_data == NULL)
+        return;
+
+#if !defined(CONDUIT_PLATFORM_WINDOWS)
+
+    if(munmap(m_data, (size_t)m_data_size) == -1)
+    {
+        CONDUIT_ERROR("<Node::mmap> failed to unmap mmap.");
+    }
+
+    if(::close(m_mmap_fd) == -1)
+    {
+        CONDUIT_ERROR("<Node::mmap> failed close mmap filed descriptor.");
+    }
+
+    m_mmap_fd   = -1;
 
 #else
     UnmapViewOfFile(m_data);
@@ -17546,8 +18293,236 @@ Node::MMap::close()
 
 }
 
+//---------------------------------------------------------------------------//
+void
+Node::load_mmap(const std::string &stream_path)
+{
+    Node opts;
+    load_mmap(stream_path,opts);
+}
+
+//---------------------------------------------------------------------------//
+void
+Node::load_mmap(const std::string &stream_path,
+                const Node &opts)
+{
+    std::string ifschema = stream_path + "_json";
+
+    Schema schema;
+    schema.load(ifschema);
+
+    reset();
+    index_t dsize = schema.spanned_bytes();
+    Node::mmap(stream_path,dsize,true);
+
+    if(opts.has_child("advice"))
+    {
+        m_mmap->advise(opts["advice"].as_string());
+    }
+
+    //
+    // See Node::mmap(stream_path,schema)
+    //
+    m_mmaped = false;
+
+    m_schema->set(schema);
+
+    walk_schema(this,m_schema,m_data, m_allocator_id);
+
+    m_mmaped = true;
+}
+
+
+
+
+//-----------------------------------------------------------------------------
+// Node::SharedData helper class
+//-----------------------------------------------------------------------------
+// This private class holds a leaf buffer shared by several nodes in
+// copy-on-write mode. Each node using the buffer holds a reference,
+// the buffer is freed with the last reference.
+//-----------------------------------------------------------------------------
+class Node::SharedData
+{
+  public:
+      //----------------------------------------------------------------------
+      // takes ownership of data, starts with a single reference
+      SharedData(void *data,
+                 index_t allocator_id)
+      : m_data(data),
+        m_allocator_id(allocator_id),
+        m_owner(NULL),
+        m_free_owner(NULL),
+        m_num_refs(1)
+      {}
+
+      //----------------------------------------------------------------------
+      // takes ownership of an adopted buffer, data is freed by passing
+      // owner to free_owner
+      SharedData(void *data,
+                 void *owner,
+                 void (*free_owner)(void*))
+      : m_data(data),
+        m_allocator_id(0),
+        m_owner(owner),
+        m_free_owner(free_owner),
+        m_num_refs(1)
+      {}
+
+      //----------------------------------------------------------------------
+      // true if the buffer was adopted, adopted buffers can't be
+      // detached since they weren't created with an allocator
+      bool     adopted() const
+                  { return m_free_owner != NULL; }
 
+      //----------------------------------------------------------------------
+      void     add_ref()
+                  { m_num_refs.fetch_add(1); }
+
+      //----------------------------------------------------------------------
+      index_t  number_of_references() const
+                  { return m_num_refs.load(); }
+
+      //----------------------------------------------------------------------
+      // removes a reference, frees the buffer with the last one
+      static void release(SharedData *shared,
+                          index_t data_size)
+      {
+          if(shared->m_num_refs.fetch_sub(1) == 1)
+          {
+              if(shared->adopted())
+              {
+                  shared->m_free_owner(shared->m_owner);
+              }
+              else
+              {
+                  instrumentation::record_free_bytes(shared->m_allocator_id,
+                                                     (size_t)data_size);
+                  utils::conduit_free(shared->m_data, shared->m_allocator_id);
+              }
+              delete shared;
+          }
+      }
+
+      //----------------------------------------------------------------------
+      // returns the buffer to a caller that holds the only reference
+      static void *detach(SharedData *shared)
+      {
+          void *res = shared->m_data;
+          delete shared;
+          return res;
+      }
+
+  private:
+      void                  *m_data;
+      index_t                m_allocator_id;
+      void                  *m_owner;
+      void                 (*m_free_owner)(void*);
+      std::atomic<index_t>   m_num_refs;
+};
+
+//---------------------------------------------------------------------------//
+bool
+Node::share_data(const Node &node)
+{
+    if(&node == this)
+    {
+        return true;
+    }
+
+    // we can only share compact buffers that the source leaf owns
+    // (or already shares) and that come from our allocator
+    if( node.m_data == NULL ||
+        !node.dtype().is_compact() ||
+        (!node.m_alloced && node.m_shared == NULL) ||
+        node.m_allocator_id != m_allocator_id)
+    {
+        return false;
+    }
+
+    // turning the source's buffer into a shared buffer only changes
+    // bookkeeping, its data is the same
+    Node &src = const_cast<Node&>(node);
+    if(src.m_shared == NULL)
+    {
+        src.m_shared  = new SharedData(src.m_data,src.m_allocator_id);
+        src.m_alloced = false;
+    }
+
+    // add our reference before we release, we may already hold one
+    SharedData *shared = src.m_shared;
+    shared->add_ref();
+    reset();
+
+    m_schema->set(src.dtype());
+    m_data      = src.m_data;
+    m_data_size = src.m_data_size;
+    m_shared    = shared;
+    return true;
+}
+
+//---------------------------------------------------------------------------//
+void
+Node::adopt_data(const DataType &dtype,
+                 void *data,
+                 void *owner,
+                 void (*free_owner)(void*))
+{
+    SharedData *shared = new SharedData(data,owner,free_owner);
+    reset();
+    m_schema->set(dtype);
+    m_data      = data;
+    m_data_size = dtype.spanned_bytes();
+    m_shared    = shared;
+}
+
+//---------------------------------------------------------------------------//
+bool
+Node::can_adopt(const DataType &dtype) const
+{
+    // compatible data we don't own is written in place,
+    // and we can't adopt into other allocators
+    return m_allocator_id == 0 &&
+           (m_alloced || m_shared != NULL || !this->dtype().compatible(dtype));
+}
+
+//---------------------------------------------------------------------------//
+void
+Node::copy_shared_data()
+{
+    if(m_shared->number_of_references() == 1)
+    {
+        if(m_shared->adopted())
+        {
+            // no one else is using the buffer, we can write to it
+            return;
+        }
+        // no one else is using the buffer, we can take it back
+        m_data = SharedData::detach(m_shared);
+    }
+    else
+    {
+        void *data = utils::conduit_allocate((size_t)m_data_size,
+                                             (size_t)1,
+                                             m_allocator_id);
+        utils::conduit_memcpy(data,m_data,(size_t)m_data_size);
+        SharedData::release(m_shared,m_data_size);
+        m_data = data;
+    }
+    m_shared  = NULL;
+    m_alloced = true;
+}
 
+//---------------------------------------------------------------------------//
+void
+Node::unshare_all_data()
+{
+    unshare_data();
+    for(size_t i = 0; i < m_children.size(); i++)
+    {
+        m_children[i]->unshare_all_data();
+    }
+}
 
 //-----------------------------------------------------------------------------
 //
@@ -17560,7 +18535,31 @@ void
 Node::init(const DataType& dtype)
 {
     if(this->dtype().compatible(dtype))
+    {
+        // callers write into compatible data
+        unshare_data();
         return;
+    }
+
+    index_t dt_id = dtype.id();
+    bool dt_leaf = dt_id != DataType::OBJECT_ID &&
+                   dt_id != DataType::LIST_ID &&
+                   dt_id != DataType::EMPTY_ID;
+
+    // reuse an owned leaf buffer when the new leaf data fits (and uses at
+    // least half of it), so repeated sets with the same size but a
+    // different type or layout don't free and allocate
+    if(dt_leaf && m_alloced && m_data != NULL && m_children.empty())
+    {
+        index_t nbytes = dtype.spanned_bytes();
+        if(nbytes > 0 &&
+           nbytes <= m_data_size &&
+           2 * nbytes >= m_data_size)
+        {
+            m_schema->set(dtype);
+            return;
+        }
+    }
 
     if(m_data != NULL ||
        this->dtype().id() == DataType::OBJECT_ID ||
@@ -17569,10 +18568,7 @@ Node::init(const DataType& dtype)
         release();
     }
 
-    index_t dt_id = dtype.id();
-    if(dt_id != DataType::OBJECT_ID &&
-       dt_id != DataType::LIST_ID &&
-       dt_id != DataType::EMPTY_ID)
+    if(dt_leaf)
     {
         allocate(dtype);
     }
@@ -17602,10 +18598,28 @@ Node::allocate(index_t dsize)
 
 //---------------------------------------------------------------------------//
 void
-Node::mmap(const std::string &stream_path, index_t data_size)
+Node::mmap(const std::string &stream_path,
+           index_t data_size,
+           bool read_only)
 {
-    m_mmap = new MMap();
-    m_mmap->open(stream_path,data_size);
+    MMap *mmap_hnd = new MMap();
+    try
+    {
+        if(read_only)
+        {
+            mmap_hnd->open_read_only(stream_path,data_size);
+        }
+        else
+        {
+            mmap_hnd->open(stream_path,data_size);
+        }
+    }
+    catch(...)
+    {
+        delete mmap_hnd;
+        throw;
+    }
+    m_mmap = mmap_hnd;
     m_data = m_mmap->data_ptr();
     m_data_size = data_size;
     m_alloced = false;
@@ -17621,12 +18635,19 @@ Node::release()
     for (size_t i = 0; i < m_children.size(); i++)
     {
         Node* node = m_children[i];
-        delete node;
+        destroy_child_node(node);
     }
     m_children.clear();
 
-    // clean up any allocated or mmaped buffers
-    if(m_alloced && m_data)
+    // clean up any shared, allocated, or mmaped buffers
+    if(m_shared != NULL)
+    {
+        SharedData::release(m_shared,m_data_size);
+        m_shared = NULL;
+        m_data = NULL;
+        m_data_size = 0;
+    }
+    else if(m_alloced && m_data)
     {
         ///
         /// TODO: why do we need to check for empty here?
@@ -17634,6 +18655,8 @@ Node::release()
         if(dtype().id() != DataType::EMPTY_ID)
         {
             // clean up our storage
+            instrumentation::record_free_bytes(m_allocator_id,
+                                               (size_t)m_data_size);
             utils::conduit_free(m_data, m_allocator_id);
             m_data = NULL;
             m_data_size = 0;
@@ -17658,12 +18681,15 @@ Node::cleanup()
     // if(m_schema->is_root())
     if(m_owns_schema && m_schema != NULL)
     {
-        delete m_schema;
+        // our schema may have come from an arena tree via swap or move
+        Schema::destroy_child_schema(m_schema);
     }
 
     m_schema = NULL;
     m_owns_schema = false;
 
+    Arena::release(m_arena);
+    m_arena = NULL;
 }
 
 
@@ -17695,11 +18721,17 @@ Node::init_defaults()
     m_mmaped    = false;
     m_mmap      = NULL;
 
+    m_shared    = NULL;
+    m_copy_on_write = false;
+
     m_schema = new Schema(DataType::EMPTY_ID);
     m_owns_schema = true;
 
     m_parent = NULL;
     m_allocator_id = 0;
+
+    m_arena = NULL;
+    m_arena_alloced = false;
 }
 
 //-----------------------------------------------------------------------------
@@ -17785,15 +18817,14 @@ Node::walk_schema(Node    *node,
     node->set_data_ptr(data);
     if(schema->dtype().id() == DataType::OBJECT_ID)
     {
+        node->m_children.reserve(schema->children().size());
         for(size_t i=0;i< schema->children().size(); i++)
         {
 
-            std::string curr_name = schema->object_order()[i];
-            Schema *curr_schema   = &schema->add_child(curr_name);
-            Node *curr_node = new Node();
-            curr_node->set_allocator(allocator_id);
-            curr_node->set_schema_ptr(curr_schema);
-            curr_node->set_parent(node);
+            // child order matches object order
+            Schema *curr_schema = schema->children()[i];
+            Node *curr_node = node->create_child_node(curr_schema,
+                                                      allocator_id);
             walk_schema(curr_node,curr_schema,data,allocator_id);
             node->append_node_ptr(curr_node);
         }
@@ -17801,13 +18832,12 @@ Node::walk_schema(Node    *node,
     else if(schema->dtype().id() == DataType::LIST_ID)
     {
         index_t num_entries = schema->number_of_children();
+        node->m_children.reserve((size_t)num_entries);
         for(index_t i=0;i<num_entries;i++)
         {
             Schema *curr_schema = schema->child_ptr(i);
-            Node *curr_node = new Node();
-            curr_node->set_allocator(allocator_id);
-            curr_node->set_schema_ptr(curr_schema);
-            curr_node->set_parent(node);
+            Node *curr_node = node->create_child_node(curr_schema,
+                                                      allocator_id);
             walk_schema(curr_node,curr_schema,data,allocator_id);
             node->append_node_ptr(curr_node);
         }
@@ -17816,6 +18846,35 @@ Node::walk_schema(Node    *node,
 
 }
 
+//---------------------------------------------------------------------------//
+size_t
+Node::arena_skeleton_bytes(const Schema &schema)
+{
+    size_t res = 0;
+    index_t dtype_id = schema.dtype().id();
+    if(dtype_id == DataType::OBJECT_ID ||
+       dtype_id == DataType::LIST_ID)
+    {
+        size_t child_bytes = Arena::aligned_bytes(sizeof(Node)) +
+                             Arena::aligned_bytes(sizeof(Schema));
+        if(dtype_id == DataType::OBJECT_ID)
+        {
+            res += Arena::aligned_bytes(sizeof(Schema::Schema_Object_Hierarchy));
+        }
+        else
+        {
+            res += Arena::aligned_bytes(sizeof(Schema::Schema_List_Hierarchy));
+        }
+
+        const std::vector<Schema*> &children = schema.children();
+        for(size_t i=0; i < children.size(); i++)
+        {
+            res += child_bytes + arena_skeleton_bytes(*children[i]);
+        }
+    }
+    return res;
+}
+
 //---------------------------------------------------------------------------//
 void
 Node::mirror_node(Node   *node,
@@ -17830,13 +18889,11 @@ Node::mirror_node(Node   *node,
         for(size_t i=0;i< schema->children().size(); i++)
         {
 
-            std::string curr_name = schema->object_order()[i];
-            Schema *curr_schema   = &schema->add_child(curr_name);
-            Node *curr_node = new Node();
+            // child order matches object order
+            Schema *curr_schema = schema->children()[i];
+            Node *curr_node = node->create_child_node(curr_schema,
+                                                      node->allocator());
             const Node *curr_src = src->child_ptr(i);
-            curr_node->set_allocator(node->allocator());
-            curr_node->set_schema_ptr(curr_schema);
-            curr_node->set_parent(node);
             mirror_node(curr_node,curr_schema,curr_src);
             node->append_node_ptr(curr_node);
         }
@@ -17847,11 +18904,9 @@ Node::mirror_node(Node   *node,
         for(index_t i=0;i<num_entries;i++)
         {
             Schema *curr_schema = schema->child_ptr(i);
-            Node *curr_node = new Node();
+            Node *curr_node = node->create_child_node(curr_schema,
+                                                      node->allocator());
             const Node *curr_src = src->child_ptr(i);
-            curr_node->set_allocator(node->allocator());
-            curr_node->set_schema_ptr(curr_schema);
-            curr_node->set_parent(node);
             mirror_node(curr_node,curr_schema,curr_src);
             node->append_node_ptr(curr_node);
         }
@@ -17867,7 +18922,7 @@ Node::mirror_node(Node   *node,
 //-----------------------------------------------------------------------------
 
 //---------------------------------------------------------------------------//
-void
+index_t
 Node::compact_to(uint8 *data, index_t curr_offset) const
 {
     CONDUIT_ASSERT( (m_schema != NULL) , "Corrupt schema found in compact_to call");
@@ -17879,14 +18934,16 @@ Node::compact_to(uint8 *data, index_t curr_offset) const
             std::vector<Node*>::const_iterator itr;
             for(itr = m_children.begin(); itr < m_children.end(); ++itr)
             {
-                (*itr)->compact_to(data,curr_offset);
-                curr_offset +=  (*itr)->total_bytes_compact();
+                curr_offset = (*itr)->compact_to(data,curr_offset);
             }
     }
-    else
+    else if(dtype_id != DataType::EMPTY_ID)
     {
         compact_elements_to(&data[curr_offset]);
+        curr_offset += dtype().bytes_compact();
     }
+
+    return curr_offset;
 }
 
 
@@ -17936,7 +18993,7 @@ Node::serialize(uint8 *data,index_t curr_offset) const
         for(itr = m_children.begin(); itr < m_children.end(); ++itr)
         {
             (*itr)->serialize(&data[0],curr_offset);
-            curr_offset+=(*itr)->total_strided_bytes();
+            curr_offset+=(*itr)->total_bytes_compact();
         }
     }
     else
@@ -17957,6 +19014,121 @@ Node::serialize(uint8 *data,index_t curr_offset) const
 }
 
 
+//---------------------------------------------------------------------------//
+void
+Node::serialize(std::ofstream &ofs,
+                std::vector<uint8> &staging) const
+{
+    index_t dtype_id = dtype().id();
+    if( dtype_id == DataType::OBJECT_ID ||
+        dtype_id == DataType::LIST_ID)
+    {
+        std::vector<Node*>::const_iterator itr;
+        for(itr = m_children.begin(); itr < m_children.end(); ++itr)
+        {
+            (*itr)->serialize(ofs,staging);
+        }
+    }
+    else if( dtype_id != DataType::EMPTY_ID)
+    {
+        if(is_compact())
+        {
+            // ser as is. This copies stride * num_ele bytes
+            {
+                ofs.write((const char*)element_ptr(0),
+                          total_strided_bytes());
+            }
+        }
+        else
+        {
+            // compact into the (reused) staging buffer
+            size_t c_num_bytes = (size_t) total_bytes_compact();
+            if(staging.size() < c_num_bytes)
+            {
+                staging.resize(c_num_bytes);
+            }
+            compact_elements_to(&staging[0]);
+            ofs.write((const char*)&staging[0],c_num_bytes);
+        }
+    }
+}
+
+//---------------------------------------------------------------------------//
+index_t
+Node::serialize_iov_staging_bytes() const
+{
+    index_t dtype_id = dtype().id();
+    if( dtype_id == DataType::OBJECT_ID ||
+        dtype_id == DataType::LIST_ID)
+    {
+        index_t res = 0;
+        std::vector<Node*>::const_iterator itr;
+        for(itr = m_children.begin(); itr < m_children.end(); ++itr)
+        {
+            res += (*itr)->serialize_iov_staging_bytes();
+        }
+        return res;
+    }
+    else if( dtype_id != DataType::EMPTY_ID && !is_compact())
+    {
+        return dtype().bytes_compact();
+    }
+    return 0;
+}
+
+//---------------------------------------------------------------------------//
+void
+Node::serialize_iov(std::vector<std::pair<const void*,index_t> > &iov,
+                    uint8 *staging,
+                    index_t &staging_offset) const
+{
+    index_t dtype_id = dtype().id();
+    if( dtype_id == DataType::OBJECT_ID ||
+        dtype_id == DataType::LIST_ID)
+    {
+        std::vector<Node*>::const_iterator itr;
+        for(itr = m_children.begin(); itr < m_children.end(); ++itr)
+        {
+            (*itr)->serialize_iov(iov,staging,staging_offset);
+        }
+        return;
+    }
+
+    if( dtype_id == DataType::EMPTY_ID)
+    {
+        return;
+    }
+
+    index_t num_bytes = dtype().bytes_compact();
+    if(num_bytes == 0)
+    {
+        return;
+    }
+
+    const uint8 *ptr = NULL;
+    if(is_compact())
+    {
+        ptr = (const uint8*) element_ptr(0);
+    }
+    else
+    {
+        ptr = staging + staging_offset;
+        compact_elements_to(staging + staging_offset);
+        staging_offset += num_bytes;
+    }
+
+    // merge with the previous piece if they are adjacent in memory
+    if(!iov.empty() &&
+       (const uint8*)iov.back().first + iov.back().second == ptr)
+    {
+        iov.back().second += num_bytes;
+    }
+    else
+    {
+        iov.push_back(std::make_pair((const void*)ptr,num_bytes));
+    }
+}
+
 //---------------------------------------------------------------------------//
 index_t
 Node::total_bytes_allocated() const
@@ -18105,6 +19277,8 @@ Node::contiguous_data_ptr()
         return NULL;
     }
 
+    // the result may be used to modify any of our leaves
+    unshare_all_data();
     // if contiguous, we simply need the first non null pointer.
     // Note: use const_cast so we can share the same helper func
     return const_cast<void*>(find_first_data_ptr());
@@ -18388,13 +19562,30 @@ Node::diff_compatible(const Node &n, Node &info, const float64 epsilon,
     {
         Node &info_children = info["children"];
 
-        NodeConstIterator child_itr = children();
-        while(child_itr.has_next())
+        // schemas with different fingerprints rarely share child order,
+        // so only try n's child at the same index (checking its name)
+        // before a lookup when the fingerprints match
+        const Schema &n_schema = n.schema();
+        const std::vector<std::string> &t_names = child_names();
+        const std::vector<std::string> &n_names = n_schema.child_names();
+        bool same_order = schema().fingerprint() == n_schema.fingerprint();
+
+        for(size_t i = 0; i < t_names.size(); i++)
         {
-            const conduit::Node &t_child = child_itr.next();
-            const std::string child_path = child_itr.name();
+            const conduit::Node &t_child = *m_children[i];
+            const std::string &child_path = t_names[i];
 
-            if(!n.has_child(child_path))
+            index_t n_idx = -1;
+            if(same_order && i < n_names.size() && n_names[i] == child_path)
+            {
+                n_idx = (index_t)i;
+            }
+            else
+            {
+                n_idx = n_schema.find_child_index(child_path);
+            }
+
+            if(n_idx < 0)
             {
                 info_children["extra"].append().set(child_path);
                 res = true;
@@ -18402,7 +19593,7 @@ Node::diff_compatible(const Node &n, Node &info, const float64 epsilon,
             else
             {
                 Node &info_child = info_children["diff"].add_child(child_path);
-                res |= t_child.diff_compatible(n.child(child_path), info_child, epsilon, relaxint);
+                res |= t_child.diff_compatible(n.child(n_idx), info_child, epsilon, relaxint);
             }
         }
     }
@@ -18530,6 +19721,13 @@ Node::info(Node &res, const std::string &curr_path) const
                 ptr_ref["bytes"] = m_data_size;
                 ptr_ref["allocator_id"] = m_allocator_id;
             }
+            else if(m_shared != NULL)
+            {
+                ptr_ref["type"]  = "shared";
+                ptr_ref["bytes"] = m_data_size;
+                ptr_ref["allocator_id"] = m_allocator_id;
+                ptr_ref["references"] = m_shared->number_of_references();
+            }
             else if(m_mmaped)
             {
                 ptr_ref["type"]  = "mmaped";
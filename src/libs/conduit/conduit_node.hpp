@@ -21,12 +21,14 @@
 #include <fstream>
 #include <sstream>
 #include <initializer_list>
+#include <memory>
 
 
 //-----------------------------------------------------------------------------
 // -- conduit includes --
 //-----------------------------------------------------------------------------
 #include "conduit_core.hpp"
+#include "conduit_arena.hpp"
 #include "conduit_endianness.hpp"
 #include "conduit_data_type.hpp"
 #include "conduit_data_array.hpp"
@@ -34,6 +36,7 @@
 #include "conduit_schema.hpp"
 #include "conduit_generator.hpp"
 #include "conduit_node_iterator.hpp"
+#include "conduit_path.hpp"
 #include "conduit_utils.hpp"
 
 #if defined(CONDUIT_USE_TOTALVIEW)
@@ -112,6 +115,11 @@ public:
 //-----------------------------------------------------------------------------
     Node();
     Node(const Node &node);
+    /// move constructor, takes over the passed node's data and tree
+    /// structure (see move()), the passed node is empty afterward.
+    /// noexcept so containers move nodes instead of copying them, the
+    /// empty schema given to the passed node is its only allocation
+    Node(Node &&node) noexcept;
     ~Node();
 
     // returns any node to the empty state
@@ -228,11 +236,33 @@ public:
     void save(const std::string &stream_path,
               const std::string &protocol="") const;
 
+    /// protocol of the schema file (stream_path + "_json") written by
+    /// save() with the "conduit_bin" protocol: "json" (default) or
+    /// "conduit_bin_schema" to opt into the smaller binary schema
+    /// encoding, which is faster to read. load() and mmap() read either.
+    static void        set_conduit_bin_schema_protocol(const std::string &protocol);
+    static std::string conduit_bin_schema_protocol();
+
     void mmap(const std::string &stream_path);
 
     void mmap(const std::string &stream_path,
               const Schema &schema);
 
+    /// memory maps a conduit_bin file using the schema from
+    /// stream_path + "_json", without reading the data up front.
+    /// Unlike mmap(), the file is opened read-only and mapped
+    /// copy-on-write: pages are read from the file when leaves are
+    /// accessed, and changes to leaves are never written to the file.
+    ///
+    /// opts:
+    ///   advice: "normal", "sequential", "random", or "willneed"
+    ///           (access pattern hint passed to posix_madvise,
+    ///            ignored on windows)
+    void load_mmap(const std::string &stream_path);
+
+    void load_mmap(const std::string &stream_path,
+                   const Node &opts);
+
 
 //-----------------------------------------------------------------------------
 ///@}
@@ -264,6 +294,86 @@ public:
 //
 //-----------------------------------------------------------------------------
 
+//-----------------------------------------------------------------------------
+//
+// -- begin declaration of Node tree arena methods --
+//
+//-----------------------------------------------------------------------------
+///@name Tree Arena
+///@{
+//-----------------------------------------------------------------------------
+/// description:
+///  Opt-in mode where the Node and Schema objects that make up a tree's
+///  skeleton are allocated from an Arena owned by the root node instead of
+///  individually from the heap. Removing or resetting the tree returns the
+///  objects to the arena, which reuses its slabs when the tree is rebuilt.
+///
+///  The arena mode only applies to root nodes and (like set_allocator)
+///  changing it resets the node. Children created in the tree share the
+///  root's arena. Leaf data is still allocated with the node's allocator.
+///
+///  Arenas are not thread safe, build each arena enabled tree from a
+///  single thread.
+//-----------------------------------------------------------------------------
+    void    enable_arena(index_t slab_size = Arena::DEFAULT_SLAB_SIZE);
+    void    disable_arena();
+    /// true if new children in this tree are created from an arena
+    bool    is_arena_enabled() const
+                { return m_arena != NULL;}
+    /// summary of the arena state (empty if the arena mode is not enabled)
+    void    arena_info(Node &res) const;
+//-----------------------------------------------------------------------------
+///@}
+//-----------------------------------------------------------------------------
+//
+// -- end declaration of Node tree arena methods --
+//
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+//
+// -- begin declaration of Node copy-on-write methods --
+//
+//-----------------------------------------------------------------------------
+///@name Copy-on-write Leaf Data
+///@{
+//-----------------------------------------------------------------------------
+/// description:
+///  Opt-in mode where set(const Node &) shares leaf buffers with the source
+///  instead of copying them. Shared buffers are reference counted, a node
+///  copies its data only when a mutating accessor (data_ptr(),
+///  element_ptr(), as_{type}_ptr(), as_{type}_array(), value() casts to
+///  pointers or arrays, or a set of a compatible type) is used on it or on
+///  any other node sharing the buffer.
+///
+///  The mode applies to this node and its descendants (including children
+///  created later) and only changes how data is copied *into* the tree.
+///  Source leaves are shared if they own a compact buffer from the same
+///  allocator, other leaves (external, mmaped, or part of a compacted
+///  parent buffer) are still copied.
+///
+///  Pointers and arrays obtained from a source node before it was shared
+///  still reference the shared buffer, writing through them is visible to
+///  all nodes that share it. Sharing from a source node modifies its
+///  bookkeeping, do not share from the same source concurrently.
+//-----------------------------------------------------------------------------
+    void    enable_copy_on_write();
+    void    disable_copy_on_write();
+    /// true if set(const Node &) shares leaf buffers with this node
+    bool    is_copy_on_write_enabled() const
+                { return m_copy_on_write;}
+    /// true if this node's data is a reference counted buffer (shared
+    /// copy-on-write data or an adopted buffer, see adopt())
+    bool    is_data_shared() const
+                { return m_shared != NULL;}
+//-----------------------------------------------------------------------------
+///@}
+//-----------------------------------------------------------------------------
+//
+// -- end declaration of Node copy-on-write methods --
+//
+//-----------------------------------------------------------------------------
+
 //-----------------------------------------------------------------------------
 //
 // -- begin declaration of Node set methods --
@@ -274,6 +384,12 @@ public:
 //-----------------------------------------------------------------------------
 /// description:
 ///   set(...) methods follow copy semantics.
+///
+///   Leaf sets write in place when the node already holds compatible data.
+///   Otherwise, a buffer the node owns is reused when the new data fits in
+///   it and uses at least half of it, so repeated sets of the same size
+///   don't free and allocate. To also recycle buffers when a tree is reset
+///   and rebuilt, use the pool allocator (utils::pool_allocator_id()).
 //-----------------------------------------------------------------------------
 
 //-----------------------------------------------------------------------------
@@ -281,6 +397,9 @@ public:
 //-----------------------------------------------------------------------------
     void set_node(const Node &data);
     void set(const Node &data);
+    /// takes over the passed node's data and tree structure without
+    /// copying (see move()), the passed node is empty afterward
+    void set(Node &&data);
 
     void set_dtype(const DataType &dtype);
     void set(const DataType &dtype);
@@ -516,6 +635,57 @@ public:
     void set_float64_vector(const std::vector<float64> &data);
     void set(const std::vector<float64> &data);
 
+//-----------------------------------------------------------------------------
+// -- set for bitwidth style std::vector types (move semantics) ---
+//-----------------------------------------------------------------------------
+    /// these adopt the vector's buffer (see adopt()) instead of copying it,
+    /// unless this node already has compatible data that it does not own
+    /// (external data, or part of a compact parent), which is written to
+    /// in place as with copy semantics, or uses a non default allocator
+    void set(std::vector<int8>    &&data);
+    void set(std::vector<int16>   &&data);
+    void set(std::vector<int32>   &&data);
+    void set(std::vector<int64>   &&data);
+    void set(std::vector<uint8>   &&data);
+    void set(std::vector<uint16>  &&data);
+    void set(std::vector<uint32>  &&data);
+    void set(std::vector<uint64>  &&data);
+    void set(std::vector<float32> &&data);
+    void set(std::vector<float64> &&data);
+
+//-----------------------------------------------------------------------------
+// -- adopt buffers ---
+//-----------------------------------------------------------------------------
+    /// adopt() takes ownership of a buffer without copying it, the buffer
+    /// becomes this node's (compact array) data. It is freed (by the
+    /// std::vector, or with delete []) when the last node using it releases
+    /// it. Adopted buffers are reference counted, so copy-on-write nodes
+    /// can share them (see enable_copy_on_write()).
+    /// The node's allocator is not used for adopted buffers.
+    /// Supports the bitwidth style numeric types.
+    template <typename T>
+    void adopt(std::vector<T> &&data)
+    {
+        DataType dtype = adopt_dtype((const T*)NULL,(index_t)data.size());
+        std::vector<T> *owner = new std::vector<T>(std::move(data));
+        adopt_data(dtype,
+                   owner->data(),
+                   owner,
+                   [](void *obj){ delete static_cast<std::vector<T>*>(obj);});
+    }
+
+    template <typename T>
+    void adopt(std::unique_ptr<T[]> &&data,
+               index_t num_elements)
+    {
+        DataType dtype = adopt_dtype((const T*)NULL,num_elements);
+        T *ptr = data.release();
+        adopt_data(dtype,
+                   ptr,
+                   ptr,
+                   [](void *obj){ delete [] static_cast<T*>(obj);});
+    }
+
 //-----------------------------------------------------------------------------
 //  set vector gap methods for c-native types
 //-----------------------------------------------------------------------------
@@ -2800,6 +2970,8 @@ public:
 // -- assignment operators for generic types --
 //-----------------------------------------------------------------------------
     Node &operator=(const Node &node);
+    /// move assignment (see move())
+    Node &operator=(Node &&node);
     Node &operator=(const DataType &dtype);
     Node &operator=(const Schema &schema);
 
@@ -2939,6 +3111,18 @@ public:
     Node &operator=(const std::vector<float32> &data);
     Node &operator=(const std::vector<float64> &data);
 
+    // std::vector types (move semantics, see set(std::vector<T> &&))
+    Node &operator=(std::vector<int8>    &&data);
+    Node &operator=(std::vector<int16>   &&data);
+    Node &operator=(std::vector<int32>   &&data);
+    Node &operator=(std::vector<int64>   &&data);
+    Node &operator=(std::vector<uint8>   &&data);
+    Node &operator=(std::vector<uint16>  &&data);
+    Node &operator=(std::vector<uint32>  &&data);
+    Node &operator=(std::vector<uint64>  &&data);
+    Node &operator=(std::vector<float32> &&data);
+    Node &operator=(std::vector<float64> &&data);
+
 
 //-----------------------------------------------------------------------------
 // --  assignment c-native gap operators for vector types ---
@@ -3085,12 +3269,23 @@ public:
     void        serialize(const std::string &stream_path) const;
     /// serialize to an output stream
     void        serialize(std::ofstream &ofs) const;
+    /// describes the byte stream serialize() creates as a list of
+    /// (pointer, number of bytes) pairs, without copying compact leaves.
+    /// Non compact leaves are compacted into `staging` (which can be
+    /// reused across calls), adjacent pieces are merged.
+    /// The pointers are valid until this node or `staging` change.
+    void        serialize_iov(std::vector<std::pair<const void*,index_t> > &iov,
+                              std::vector<uint8> &staging) const;
 
 //-----------------------------------------------------------------------------
 // -- compaction methods ---
 //-----------------------------------------------------------------------------
     /// compact into a new node
     void        compact_to(Node &n_dest) const;
+    /// compact into a new (root) node in arena mode (see enable_arena),
+    /// the compacted data is held in a single allocation and the node's
+    /// skeleton is created from a single arena slab
+    void        compact_to_arena(Node &n_dest) const;
 
 //-----------------------------------------------------------------------------
 // -- update methods ---
@@ -3772,7 +3967,7 @@ public:
                         { return *m_schema;}
 
     const DataType   &dtype() const
-                        { return m_schema->dtype();}
+                        { return static_cast<const Schema*>(m_schema)->dtype();}
 
     // TODO we'd like to have this function be const
     // just like the reference version of it is.
@@ -3971,6 +4166,21 @@ public:
     Node             &operator[](index_t idx);
     const Node       &operator[](index_t idx) const;
 
+    /// fetch variants that use a compiled path (see conduit::Path)
+    /// these follow the same semantics as the string path variants,
+    /// but avoid re-parsing the path for repeated lookups
+    Node             &fetch(const Path &path);
+    const Node       &fetch(const Path &path) const;
+
+    Node             &fetch_existing(const Path &path);
+    const Node       &fetch_existing(const Path &path) const;
+
+    Node             *fetch_ptr(const Path &path);
+    const Node       *fetch_ptr(const Path &path) const;
+
+    Node             &operator[](const Path &path);
+    const Node       &operator[](const Path &path) const;
+
     /// returns the number of children (list and object interfaces)
     index_t number_of_children() const;
 
@@ -3985,6 +4195,8 @@ public:
     bool        has_child(const std::string &name) const;
     /// checks if given path exists in the Node hierarchy
     bool        has_path(const std::string &path) const;
+    /// checks if given compiled path exists in the Node hierarchy
+    bool        has_path(const Path &path) const;
     /// returns the direct child names for this node
     const std::vector<std::string> &child_names() const;
 
@@ -4171,7 +4383,8 @@ public:
                         {return m_mmaped ? m_data_size : 0;}
 
     void  *element_ptr(index_t idx)
-        {return static_cast<char*>(m_data) + dtype().element_index(idx);};
+        {unshare_data();
+         return static_cast<char*>(m_data) + dtype().element_index(idx);};
     const void  *element_ptr(index_t idx) const
         {return static_cast<char*>(m_data) + dtype().element_index(idx);};
 
@@ -4446,6 +4659,16 @@ private:
     void             set_parent(Node *new_parent)
                         { m_parent = new_parent;}
 
+    ///
+    /// creates a Node that uses the passed (parent owned) schema pointer
+    /// with this node as its parent. Children come from this node's arena
+    /// when enabled. The result still needs to be added via append_node_ptr
+    ///
+    Node            *create_child_node(Schema *schema_ptr,
+                                       index_t allocator_id = 0);
+    /// destroys a child created via create_child_node
+    static void      destroy_child_node(Node *node);
+
 
 //-----------------------------------------------------------------------------
 ///@}
@@ -4488,14 +4711,57 @@ private:
     void             allocate(index_t dsize);
     void             allocate(const DataType &dtype);
     void             mmap(const std::string &stream_path,
-                          index_t dsize);
-    // release any alloced or memory mapped data
+                          index_t dsize,
+                          bool read_only = false);
+    // release any alloced, shared, or memory mapped data
     void             release();
+    // takes ownership of data (an array described by dtype), owner is
+    // passed to free_owner when the last node using data releases it
+    void             adopt_data(const DataType &dtype,
+                                void *data,
+                                void *owner,
+                                void (*free_owner)(void*));
+    // true if a set of dtype data should adopt an rvalue buffer
+    bool             can_adopt(const DataType &dtype) const;
+    // dtypes for adopt()
+    static DataType  adopt_dtype(const int8 *, index_t num_elements)
+                        { return DataType::int8(num_elements);}
+    static DataType  adopt_dtype(const int16 *, index_t num_elements)
+                        { return DataType::int16(num_elements);}
+    static DataType  adopt_dtype(const int32 *, index_t num_elements)
+                        { return DataType::int32(num_elements);}
+    static DataType  adopt_dtype(const int64 *, index_t num_elements)
+                        { return DataType::int64(num_elements);}
+    static DataType  adopt_dtype(const uint8 *, index_t num_elements)
+                        { return DataType::uint8(num_elements);}
+    static DataType  adopt_dtype(const uint16 *, index_t num_elements)
+                        { return DataType::uint16(num_elements);}
+    static DataType  adopt_dtype(const uint32 *, index_t num_elements)
+                        { return DataType::uint32(num_elements);}
+    static DataType  adopt_dtype(const uint64 *, index_t num_elements)
+                        { return DataType::uint64(num_elements);}
+    static DataType  adopt_dtype(const float32 *, index_t num_elements)
+                        { return DataType::float32(num_elements);}
+    static DataType  adopt_dtype(const float64 *, index_t num_elements)
+                        { return DataType::float64(num_elements);}
+    // share the leaf buffer of node, returns false if it can't be shared
+    bool             share_data(const Node &node);
+    // copy shared data before it is modified
+    void             unshare_data()
+                        { if(m_shared != NULL) copy_shared_data();}
+    void             copy_shared_data();
+    // unshare_data for this node and all of its descendants
+    void             unshare_all_data();
     // clean up everything (used by destructor)
     void             cleanup();
 
     // set defaults (used by constructors)
     void              init_defaults();
+    // constructor used by create_child_node, which avoids creating
+    // a schema only to replace it with the parent owned schema
+    Node(Schema *schema_ptr,
+         Node *parent,
+         index_t allocator_id);
     // setup node to act as a list
     void              init_list();
     // setup node to act as an object
@@ -4526,12 +4792,17 @@ private:
                                  Schema *schema,
                                  const Node *src);
 
+    /// number of arena bytes needed to hold the skeleton
+    /// (child nodes and schemas) walk_schema creates for a schema
+    static size_t    arena_skeleton_bytes(const Schema &schema);
+
 //-----------------------------------------------------------------------------
 //
 // -- private methods that help with compaction, serialization, and info  --
 //
 //-----------------------------------------------------------------------------
-    void              compact_to(uint8 *data,
+    // returns the offset past the compacted data
+    index_t           compact_to(uint8 *data,
                                  index_t curr_offset) const;
     /// compact helper for leaf types
     void              compact_elements_to(uint8 *data) const;
@@ -4539,6 +4810,14 @@ private:
 
     void              serialize(uint8 *data,
                                 index_t curr_offset) const;
+    /// ofstream serialize helper, `staging` is reused for non compact leaves
+    void              serialize(std::ofstream &ofs,
+                                std::vector<uint8> &staging) const;
+    /// serialize_iov helpers
+    index_t           serialize_iov_staging_bytes() const;
+    void              serialize_iov(std::vector<std::pair<const void*,index_t> > &iov,
+                                    uint8 *staging,
+                                    index_t &staging_offset) const;
 
     /// Implements recursive check for if node is contiguous to the
     /// passed start address. If contiguous, returns true and the
@@ -4845,13 +5124,60 @@ private:
     // simply knowing if this pointer is valid.
     MMap     *m_mmap;
 
+    // private class that implements reference counted leaf buffers
+    class SharedData;
+
+    // shared (copy-on-write) buffer m_data belongs to, we hold a reference
+    // This is only allocated when m_data is shared or adopted, in this
+    // case m_alloced is false.
+    SharedData *m_shared;
+    // if true, set(const Node &) shares leaf buffers (see
+    // enable_copy_on_write), children inherit this flag
+    bool      m_copy_on_write;
+
     // allocator id for memory
     index_t m_allocator_id;
+
+    // arena used to create children (NULL for the heap),
+    // holds a reference when set
+    Arena    *m_arena;
+    // true if this node instance was allocated from m_arena
+    bool      m_arena_alloced;
+
+    // schema protocol used by save() for conduit_bin schema files
+    static std::string m_conduit_bin_schema_protocol;
 };
 //-----------------------------------------------------------------------------
 // -- end conduit::Node --
 //-----------------------------------------------------------------------------
 
+//-----------------------------------------------------------------------------
+///
+/// dispatch_array for leaf nodes, calls func with a typed ArrayView
+/// of the node's data (see conduit_array_view.hpp)
+///
+//-----------------------------------------------------------------------------
+template <typename Func>
+decltype(auto)
+dispatch_array(Node &node,
+               Func &&func)
+{
+    return dispatch_array(node.data_ptr(),
+                          node.dtype(),
+                          func);
+}
+
+//---------------------------------------------------------------------------//
+template <typename Func>
+decltype(auto)
+dispatch_array(const Node &node,
+               Func &&func)
+{
+    return dispatch_array(node.data_ptr(),
+                          node.dtype(),
+                          func);
+}
+
 }
 //-----------------------------------------------------------------------------
 // -- end conduit:: --
@@ -123,7 +123,7 @@ NodeIterator::name() const
     std::ostringstream oss;
 
     index_t index = m_index-1;
-    if(m_node->m_schema->dtype().is_list())
+    if(m_node->schema().dtype().is_list())
     {
         oss << index;
     }
@@ -393,7 +393,7 @@ NodeConstIterator::name() const
     std::ostringstream oss;
 
     index_t index = m_index-1;
-    if(m_node->m_schema->dtype().is_list())
+    if(m_node->schema().dtype().is_list())
     {
         oss << index;
     }
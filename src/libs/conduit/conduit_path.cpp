@@ -0,0 +1,300 @@
+// Copyright (c) Lawrence Livermore National Security, LLC and other Conduit
+// Project developers. See top-level LICENSE AND COPYRIGHT files for dates and
+// other details. No copyright assignment is required to contribute to Conduit.
+
+//-----------------------------------------------------------------------------
+///
+/// file: conduit_path.cpp
+///
+//-----------------------------------------------------------------------------
+#include "conduit_path.hpp"
+
+#include <sstream>
+
+#include "conduit_error.hpp"
+#include "conduit_node.hpp"
+
+//-----------------------------------------------------------------------------
+// -- begin conduit:: --
+//-----------------------------------------------------------------------------
+namespace conduit
+{
+
+//-----------------------------------------------------------------------------
+//
+// -- conduit::Path public methods --
+//
+//-----------------------------------------------------------------------------
+
+//---------------------------------------------------------------------------//
+Path::Path()
+: m_path(),
+  m_segments(),
+  m_child_indices()
+{}
+
+//---------------------------------------------------------------------------//
+Path::Path(const Path &path)
+: m_path(path.m_path),
+  m_segments(path.m_segments),
+  m_child_indices(path.m_child_indices)
+{}
+
+//---------------------------------------------------------------------------//
+Path::Path(const std::string &path)
+{
+    set(path);
+}
+
+//---------------------------------------------------------------------------//
+Path::Path(const char *path)
+{
+    set(std::string(path));
+}
+
+//---------------------------------------------------------------------------//
+Path::~Path()
+{}
+
+//---------------------------------------------------------------------------//
+Path &
+Path::operator=(const Path &path)
+{
+    if(this != &path)
+    {
+        m_path          = path.m_path;
+        m_segments      = path.m_segments;
+        m_child_indices = path.m_child_indices;
+    }
+    return *this;
+}
+
+//---------------------------------------------------------------------------//
+void
+Path::set(const std::string &path)
+{
+    m_path = path;
+    m_segments.clear();
+
+    // split on "/", culling empty segments (same as Node::fetch)
+    std::string::size_type start = 0;
+    while(start <= path.size())
+    {
+        std::string::size_type end = path.find('/',start);
+        if(end == std::string::npos)
+        {
+            end = path.size();
+        }
+
+        if(end > start)
+        {
+            m_segments.push_back(path.substr(start,end - start));
+        }
+
+        start = end + 1;
+    }
+
+    m_child_indices.clear();
+    m_child_indices.resize(m_segments.size(),-1);
+}
+
+//---------------------------------------------------------------------------//
+const std::string &
+Path::segment(index_t idx) const
+{
+    if(idx < 0 || ((size_t)idx) >= m_segments.size())
+    {
+        CONDUIT_ERROR("Invalid path segment index: " << idx <<
+                      " (number of segments: " << m_segments.size() << ")");
+    }
+    return m_segments[(size_t)idx];
+}
+
+//---------------------------------------------------------------------------//
+void
+Path::reset_cache() const
+{
+    m_child_indices.assign(m_segments.size(),-1);
+}
+
+//---------------------------------------------------------------------------//
+std::string
+Path::to_string() const
+{
+    std::ostringstream oss;
+    oss << "{\"path\": \"" << m_path << "\", \"segments\": [";
+    for(size_t i=0; i < m_segments.size(); i++)
+    {
+        if(i > 0)
+        {
+            oss << ", ";
+        }
+        oss << "{\"name\": \"" << m_segments[i] << "\", "
+            << "\"index\": " << m_child_indices[i] << "}";
+    }
+    oss << "]}";
+    return oss.str();
+}
+
+//---------------------------------------------------------------------------//
+Node &
+Path::fetch(Node &node) const
+{
+    if(m_segments.empty())
+    {
+        CONDUIT_ERROR("Cannot fetch empty path string");
+    }
+
+    Node *curr = &node;
+    for(size_t i=0; i < m_segments.size(); i++)
+    {
+        const std::string &seg = m_segments[i];
+        if(seg == "..")
+        {
+            if(curr->parent() == NULL)
+            {
+                CONDUIT_ERROR("Cannot fetch from NULL parent" << m_path);
+            }
+            curr = curr->parent();
+            continue;
+        }
+
+        index_t idx = child_index(*curr,(index_t)i);
+
+        if(idx < 0)
+        {
+            // fetch forces the object role and creates the child
+            curr = &curr->fetch(seg);
+            m_child_indices[i] = curr->parent()->number_of_children() - 1;
+        }
+        else
+        {
+            curr = &curr->child(idx);
+        }
+    }
+
+    return *curr;
+}
+
+//---------------------------------------------------------------------------//
+const Node &
+Path::fetch_existing(const Node &node) const
+{
+    if(m_segments.empty())
+    {
+        CONDUIT_ERROR("Cannot fetch_existing empty path string");
+    }
+
+    const Node *curr = &node;
+    for(size_t i=0; i < m_segments.size(); i++)
+    {
+        const std::string &seg = m_segments[i];
+        if(seg == "..")
+        {
+            if(curr->parent() == NULL)
+            {
+                CONDUIT_ERROR("Cannot fetch_existing from NULL parent"
+                              << m_path);
+            }
+            curr = curr->parent();
+            continue;
+        }
+
+        if(!curr->dtype().is_object())
+        {
+            CONDUIT_ERROR("Cannot fetch_existing, Node(" << curr->path()
+                          << ") is not an object");
+        }
+
+        index_t idx = child_index(*curr,(index_t)i);
+
+        if(idx < 0)
+        {
+            CONDUIT_ERROR("Cannot fetch non-existent "
+                          << "child \"" << seg << "\" from Node("
+                          << curr->path()
+                          << ")");
+        }
+
+        curr = &curr->child(idx);
+    }
+
+    return *curr;
+}
+
+//---------------------------------------------------------------------------//
+Node &
+Path::fetch_existing(Node &node) const
+{
+    // Note: use const_cast so we can share the same implementation,
+    // the passed node is non-const so this is safe.
+    return const_cast<Node&>(fetch_existing((const Node&)node));
+}
+
+//---------------------------------------------------------------------------//
+const Node *
+Path::fetch_ptr(const Node &node) const
+{
+    if(m_segments.empty())
+    {
+        return NULL;
+    }
+
+    const Node *curr = &node;
+    for(size_t i=0; i < m_segments.size() && curr != NULL; i++)
+    {
+        if(m_segments[i] == "..")
+        {
+            curr = curr->parent();
+        }
+        else
+        {
+            index_t idx = child_index(*curr,(index_t)i);
+            curr = idx < 0 ? NULL : &curr->child(idx);
+        }
+    }
+
+    return curr;
+}
+
+//-----------------------------------------------------------------------------
+//
+// -- conduit::Path private methods --
+//
+//-----------------------------------------------------------------------------
+
+//---------------------------------------------------------------------------//
+index_t
+Path::child_index(const Node &node,
+                  index_t seg_idx) const
+{
+    if(!node.dtype().is_object())
+    {
+        return -1;
+    }
+
+    const std::string &seg = m_segments[(size_t)seg_idx];
+    const std::vector<std::string> &names = node.child_names();
+    index_t idx = m_child_indices[(size_t)seg_idx];
+
+    // fast path: cached index still names the same child
+    if(idx >= 0 &&
+       ((size_t)idx) < names.size() &&
+       names[(size_t)idx] == seg)
+    {
+        return idx;
+    }
+
+    // slow path: full name lookup
+    idx = node.schema().find_child_index(seg);
+    if(idx >= 0)
+    {
+        m_child_indices[(size_t)seg_idx] = idx;
+    }
+    return idx;
+}
+
+}
+//-----------------------------------------------------------------------------
+// -- end conduit:: --
+//-----------------------------------------------------------------------------
@@ -0,0 +1,133 @@
+// Copyright (c) Lawrence Livermore National Security, LLC and other Conduit
+// Project developers. See top-level LICENSE AND COPYRIGHT files for dates and
+// other details. No copyright assignment is required to contribute to Conduit.
+
+//-----------------------------------------------------------------------------
+///
+/// file: conduit_path.hpp
+///
+//-----------------------------------------------------------------------------
+
+#ifndef CONDUIT_PATH_HPP
+#define CONDUIT_PATH_HPP
+
+//-----------------------------------------------------------------------------
+// -- standard lib includes --
+//-----------------------------------------------------------------------------
+#include <vector>
+#include <string>
+
+//-----------------------------------------------------------------------------
+// -- conduit includes --
+//-----------------------------------------------------------------------------
+#include "conduit_core.hpp"
+
+//-----------------------------------------------------------------------------
+// -- begin conduit:: --
+//-----------------------------------------------------------------------------
+namespace conduit
+{
+
+class Node;
+
+//-----------------------------------------------------------------------------
+// -- begin conduit::Path --
+//-----------------------------------------------------------------------------
+///
+/// class: conduit::Path
+///
+/// description:
+///  A compiled path: the path string is split into its segments once
+///  (using the same rules as Node::fetch, empty segments are culled and
+///  ".." refers to the parent) so repeated lookups avoid re-parsing the
+///  path and allocating temporary strings.
+///
+///  Each segment also caches the child index it resolved to the last time
+///  the path was used. On the next lookup the cached index is checked
+///  against the child name at that index, and only falls back to a
+///  name lookup if the hierarchy has changed. This means a single Path
+///  can be resolved against any Node with the same hierarchy shape.
+///
+///  Since the index cache is updated during lookups, a Path instance
+///  should not be shared across threads.
+///
+//-----------------------------------------------------------------------------
+class CONDUIT_API Path
+{
+public:
+    /// create an empty path
+    Path();
+    /// path copy constructor
+    Path(const Path &path);
+    /// create a compiled path from a path string
+    explicit Path(const std::string &path);
+    /// create a compiled path from a path string (c string case)
+    explicit Path(const char *path);
+
+    ~Path();
+
+    Path &operator=(const Path &path);
+
+    /// compile a new path string, clears any cached child indices
+    void               set(const std::string &path);
+
+    /// return the path string this path was compiled from
+    const std::string &path() const
+                            { return m_path;}
+
+    /// returns the number of (non-empty) segments in this path
+    index_t            number_of_segments() const
+                            { return (index_t)m_segments.size();}
+
+    /// access segment names
+    const std::string &segment(index_t idx) const;
+
+    /// returns if the path has no segments
+    bool               is_empty() const
+                            { return m_segments.empty();}
+
+    /// clears the cached child indices
+    void               reset_cache() const;
+
+    /// returns a string with the compiled segments and cached indices
+    std::string        to_string() const;
+
+    /// Path resolution methods
+    ///
+    /// these back the Node::fetch(const Path&) family of methods
+    /// and follow the same semantics as their string path counterparts.
+
+    /// resolves the path, creating any missing nodes (Node::fetch)
+    Node              &fetch(Node &node) const;
+    /// resolves the path, throws an error if a segment does not exist
+    /// (Node::fetch_existing)
+    Node              &fetch_existing(Node &node) const;
+    const Node        &fetch_existing(const Node &node) const;
+    /// resolves the path, returns NULL if a segment does not exist
+    const Node        *fetch_ptr(const Node &node) const;
+
+private:
+    /// finds the index of the child named by the given (non "..") segment,
+    /// using the cached index when it is still valid.
+    /// returns -1 if the child does not exist
+    index_t            child_index(const Node &node,
+                                   index_t seg_idx) const;
+
+    /// holds the path string
+    std::string                  m_path;
+    /// holds the non-empty segments of the path
+    std::vector<std::string>     m_segments;
+    /// holds the child index each segment last resolved to
+    /// (-1 for not yet resolved, or ".." segments)
+    mutable std::vector<index_t> m_child_indices;
+};
+//-----------------------------------------------------------------------------
+// -- end conduit::Path --
+//-----------------------------------------------------------------------------
+
+}
+//-----------------------------------------------------------------------------
+// -- end conduit:: --
+//-----------------------------------------------------------------------------
+
+#endif
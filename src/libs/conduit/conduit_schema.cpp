@@ -13,10 +13,13 @@
 // -- standard lib includes -- 
 //-----------------------------------------------------------------------------
 #include <stdio.h>
+#include <string.h>
+#include <new>
 
 //-----------------------------------------------------------------------------
 // -- conduit includes -- 
 //-----------------------------------------------------------------------------
+#include "conduit_arena.hpp"
 #include "conduit_generator.hpp"
 #include "conduit_error.hpp"
 #include "conduit_utils.hpp"
@@ -30,6 +33,225 @@ namespace conduit
 
 std::vector<std::string> Schema::m_empty_child_names;
 
+index_t Schema::m_object_index_threshold = 32;
+
+//-----------------------------------------------------------------------------
+// -- begin conduit::detail --
+//-----------------------------------------------------------------------------
+namespace detail
+{
+
+//---------------------------------------------------------------------------//
+// binary schema encoding helpers
+//
+// layout:
+//   header:     4 magic bytes + 1 version byte
+//   name table: count, then (length, bytes) for each unique child name
+//   tree:       pre-order, each schema is its dtype id followed by
+//                 object: number of children, (name index, child) pairs
+//                 list:   number of children, children
+//                 leaf:   num_ele, offset, stride, ele_bytes, endianness
+//
+// all integers are LEB128 varints, offset and stride are zigzag encoded
+//---------------------------------------------------------------------------//
+static const uint8 binary_schema_magic[4] = {0x89, 'C', 'S', 'B'};
+static const uint8 binary_schema_version  = 1;
+static const index_t binary_schema_header_bytes = 5;
+
+//---------------------------------------------------------------------------//
+static inline void
+write_varint(uint64 val, std::vector<uint8> &out)
+{
+    while(val >= 0x80)
+    {
+        out.push_back((uint8)(val | 0x80));
+        val >>= 7;
+    }
+    out.push_back((uint8)val);
+}
+
+//---------------------------------------------------------------------------//
+static inline void
+write_zigzag(index_t val, std::vector<uint8> &out)
+{
+    // sign fill from an explicit 64-bit arithmetic shift
+    write_varint(((uint64)val << 1) ^ (uint64)((int64)val >> 63), out);
+}
+
+//---------------------------------------------------------------------------//
+static inline uint64
+read_varint(const uint8 *&ptr, const uint8 *end)
+{
+    uint64 res = 0;
+    for(int shift = 0; shift < 64; shift += 7)
+    {
+        if(ptr >= end)
+        {
+            CONDUIT_ERROR("<Schema::from_binary> unexpected end of data");
+        }
+        uint8 b = *ptr++;
+        res |= ((uint64)(b & 0x7f)) << shift;
+        if((b & 0x80) == 0)
+        {
+            return res;
+        }
+    }
+    CONDUIT_ERROR("<Schema::from_binary> invalid varint");
+    return 0;
+}
+
+//---------------------------------------------------------------------------//
+static inline index_t
+read_zigzag(const uint8 *&ptr, const uint8 *end)
+{
+    uint64 val = read_varint(ptr,end);
+    return (index_t)((val >> 1) ^ (~(val & 1) + 1));
+}
+
+//---------------------------------------------------------------------------//
+static void
+binary_schema_collect_names(const Schema &schema,
+                            std::map<std::string,uint64> &name_ids,
+                            std::vector<const std::string*> &names)
+{
+    index_t dt_id = schema.dtype().id();
+    if(dt_id == DataType::OBJECT_ID)
+    {
+        const std::vector<std::string> &cld_names = schema.child_names();
+        for(size_t i = 0; i < cld_names.size(); i++)
+        {
+            std::pair<std::map<std::string,uint64>::iterator,bool> res =
+                name_ids.insert(std::make_pair(cld_names[i],
+                                               (uint64)names.size()));
+            if(res.second)
+            {
+                names.push_back(&res.first->first);
+            }
+            binary_schema_collect_names(schema.child((index_t)i),
+                                        name_ids,
+                                        names);
+        }
+    }
+    else if(dt_id == DataType::LIST_ID)
+    {
+        index_t nchildren = schema.number_of_children();
+        for(index_t i = 0; i < nchildren; i++)
+        {
+            binary_schema_collect_names(schema.child(i),name_ids,names);
+        }
+    }
+}
+
+//---------------------------------------------------------------------------//
+static void
+binary_schema_write_tree(const Schema &schema,
+                         const std::map<std::string,uint64> &name_ids,
+                         std::vector<uint8> &out)
+{
+    const DataType &dt = schema.dtype();
+    index_t dt_id = dt.id();
+    write_varint((uint64)dt_id,out);
+
+    if(dt_id == DataType::OBJECT_ID)
+    {
+        const std::vector<std::string> &cld_names = schema.child_names();
+        write_varint((uint64)cld_names.size(),out);
+        for(size_t i = 0; i < cld_names.size(); i++)
+        {
+            write_varint(name_ids.find(cld_names[i])->second,out);
+            binary_schema_write_tree(schema.child((index_t)i),name_ids,out);
+        }
+    }
+    else if(dt_id == DataType::LIST_ID)
+    {
+        index_t nchildren = schema.number_of_children();
+        write_varint((uint64)nchildren,out);
+        for(index_t i = 0; i < nchildren; i++)
+        {
+            binary_schema_write_tree(schema.child(i),name_ids,out);
+        }
+    }
+    else if(dt_id != DataType::EMPTY_ID)
+    {
+        write_varint((uint64)dt.number_of_elements(),out);
+        write_zigzag(dt.offset(),out);
+        write_zigzag(dt.stride(),out);
+        write_varint((uint64)dt.element_bytes(),out);
+        write_varint((uint64)dt.endianness(),out);
+    }
+}
+
+//---------------------------------------------------------------------------//
+static void
+binary_schema_read_tree(Schema &schema,
+                        const std::vector<std::string> &names,
+                        const uint8 *&ptr,
+                        const uint8 *end)
+{
+    index_t dt_id = (index_t)read_varint(ptr,end);
+
+    if(dt_id == DataType::OBJECT_ID)
+    {
+        schema.set(DataType::object());
+        uint64 nchildren = read_varint(ptr,end);
+        for(uint64 i = 0; i < nchildren; i++)
+        {
+            uint64 name_idx = read_varint(ptr,end);
+            if(name_idx >= (uint64)names.size())
+            {
+                CONDUIT_ERROR("<Schema::from_binary> invalid name index: "
+                              << name_idx);
+            }
+            const std::string &name = names[(size_t)name_idx];
+            // (add_child returns the existing child for duplicate names)
+            Schema &child = schema.add_child(name);
+            if(schema.number_of_children() != (index_t)i + 1)
+            {
+                CONDUIT_ERROR("<Schema::from_binary> duplicate child name: "
+                              << "\"" << name << "\"");
+            }
+            binary_schema_read_tree(child,names,ptr,end);
+        }
+    }
+    else if(dt_id == DataType::LIST_ID)
+    {
+        schema.set(DataType::list());
+        uint64 nchildren = read_varint(ptr,end);
+        for(uint64 i = 0; i < nchildren; i++)
+        {
+            binary_schema_read_tree(schema.append(),names,ptr,end);
+        }
+    }
+    else if(dt_id == DataType::EMPTY_ID)
+    {
+        schema.set(DataType::empty());
+    }
+    else
+    {
+        if(DataType::id_to_name(dt_id) == "empty")
+        {
+            CONDUIT_ERROR("<Schema::from_binary> invalid dtype id: "
+                          << dt_id);
+        }
+        index_t num_ele    = (index_t)read_varint(ptr,end);
+        index_t offset     = read_zigzag(ptr,end);
+        index_t stride     = read_zigzag(ptr,end);
+        index_t ele_bytes  = (index_t)read_varint(ptr,end);
+        index_t endianness = (index_t)read_varint(ptr,end);
+        schema.set(DataType(dt_id,
+                            num_ele,
+                            offset,
+                            stride,
+                            ele_bytes,
+                            endianness));
+    }
+}
+
+}
+//-----------------------------------------------------------------------------
+// -- end conduit::detail --
+//-----------------------------------------------------------------------------
+
 //=============================================================================
 //-----------------------------------------------------------------------------
 //
@@ -91,7 +313,10 @@ Schema::Schema(const char *json_schema)
 
 //---------------------------------------------------------------------------//
 Schema::~Schema()
-{release();}
+{
+    release();
+    Arena::release(m_arena);
+}
 
 //---------------------------------------------------------------------------//
 void
@@ -118,8 +343,9 @@ Schema::set(const Schema &schema)
        init_object();
        init_children = true;
 
-       object_map()   = schema.object_map();
        object_order() = schema.object_order();
+       // child order is the same, so the index can be copied as is
+       object_hierarchy()->object_index = schema.object_hierarchy()->object_index;
     } 
     else if (dt_id == DataType::LIST_ID)
     {
@@ -138,8 +364,8 @@ Schema::set(const Schema &schema)
        const std::vector<Schema*> &their_children = schema.children();
        for (size_t i = 0; i < their_children.size(); i++) 
        {
-           Schema *child_schema = new Schema(*their_children[i]);
-           child_schema->m_parent = this;
+           Schema *child_schema = create_child_schema();
+           child_schema->set(*their_children[i]);
            my_children.push_back(child_schema);
        }
     }
@@ -303,6 +529,12 @@ Schema::spanned_bytes() const
 bool
 Schema::compatible(const Schema &s) const
 {
+    // identical schemas are compatible
+    // (fingerprints can't be used here: compatible schemas can differ in
+    //  offsets, strides, lengths and extra children)
+    if(this == &s)
+        return true;
+
     index_t dt_id   = m_dtype.id();
     index_t s_dt_id = s.dtype().id();
 
@@ -314,22 +546,17 @@ Schema::compatible(const Schema &s) const
     if(dt_id == DataType::OBJECT_ID)
     {
         // each of s's entries that match paths must have dtypes that match
+        const std::vector<std::string> &s_names = s.object_order();
         
-        std::map<std::string, index_t>::const_iterator itr;
-        
-        for(itr  = s.object_map().begin(); 
-            itr != s.object_map().end() && res;
-            itr++)
+        for(size_t s_idx = 0; s_idx < s_names.size() && res; s_idx++)
         {
-            // make sure we actually have the path
-            if(has_path(itr->first))
+            // make sure we actually have the child
+            index_t idx = find_child_index(s_names[s_idx]);
+            if(idx >= 0)
             {
-                // use index to fetch the child from the other schema
-                const Schema &s_chld = s.child(itr->second);
-                // fetch our child by name
-                const Schema &chld = child(itr->first);
                 // do compat check
-                res = chld.compatible(s_chld);
+                res = children()[(size_t)idx]->compatible(
+                                                *s.children()[s_idx]);
             }
         }
     }
@@ -361,6 +588,14 @@ Schema::compatible(const Schema &s) const
 bool
 Schema::equals(const Schema &s) const
 {
+    if(this == &s)
+        return true;
+
+    // equal schemas always have equal fingerprints, so a mismatch is a
+    // cheap reject. a match still needs the full walk below.
+    if(fingerprint() != s.fingerprint())
+        return false;
+
     index_t dt_id   = m_dtype.id();
     index_t s_dt_id = s.dtype().id();
 
@@ -372,39 +607,25 @@ Schema::equals(const Schema &s) const
     if(dt_id == DataType::OBJECT_ID)
     {
         // all entries must be equal
-        
-        std::map<std::string, index_t>::const_iterator itr;
-        
-        for(itr  = s.object_map().begin(); 
-            itr != s.object_map().end() && res;
-            itr++)
-        {
-            if(has_path(itr->first))
-            {
-                size_t s_idx = (size_t) itr->second;
-                res = s.children()[s_idx]->equals(child(itr->first));
-            }
-            else
-            {
-                res = false;
-            }
-        }
-        
-        for(itr  = object_map().begin(); 
-            itr != object_map().end() && res;
-            itr++)
+        const std::vector<std::string> &s_names = s.object_order();
+
+        // names are unique, so matching counts and finding each of s's
+        // names here means both have the same set of names
+        if(number_of_children() != s.number_of_children())
+            return false;
+
+        for(size_t s_idx = 0; s_idx < s_names.size() && res; s_idx++)
         {
-            if(s.has_path(itr->first))
+            index_t idx = find_child_index(s_names[s_idx]);
+            if(idx >= 0)
             {
-                size_t idx = (size_t) itr->second;
-                res = children()[idx]->equals(s.child(itr->first));
+                res = s.children()[s_idx]->equals(*children()[(size_t)idx]);
             }
             else
             {
                 res = false;
             }
         }
-        
     }
     else if(dt_id == DataType::LIST_ID) 
     {
@@ -432,6 +653,54 @@ Schema::equals(const Schema &s) const
 
 
 
+//---------------------------------------------------------------------------//
+uint64
+Schema::fingerprint() const
+{
+    if(m_fingerprint_valid.load(std::memory_order_acquire))
+    {
+        return m_fingerprint.load(std::memory_order_relaxed);
+    }
+
+    uint64 res = 0;
+
+    index_t dt_id = m_dtype.id();
+    if(dt_id == DataType::OBJECT_ID ||
+       dt_id == DataType::LIST_ID)
+    {
+        // id, number of children, then (name hash,) fingerprint of each child
+        const std::vector<Schema*> &chldrn = children();
+        std::vector<uint64> vals;
+        vals.reserve(2 + 2 * chldrn.size());
+        vals.push_back((uint64)dt_id);
+        vals.push_back((uint64)chldrn.size());
+        for(size_t i = 0; i < chldrn.size(); i++)
+        {
+            if(dt_id == DataType::OBJECT_ID)
+            {
+                vals.push_back((uint64)utils::hash(object_order()[i]));
+            }
+            vals.push_back(chldrn[i]->fingerprint());
+        }
+        res = utils::hash(&vals[0],(unsigned int)vals.size());
+    }
+    else
+    {
+        uint64 vals[6] = {(uint64)dt_id,
+                          (uint64)m_dtype.number_of_elements(),
+                          (uint64)m_dtype.offset(),
+                          (uint64)m_dtype.stride(),
+                          (uint64)m_dtype.element_bytes(),
+                          (uint64)m_dtype.endianness()};
+        res = utils::hash(vals,6);
+    }
+
+    // threads racing to fill the cache all store the same value
+    m_fingerprint.store(res, std::memory_order_relaxed);
+    m_fingerprint_valid.store(true, std::memory_order_release);
+    return res;
+}
+
 //-----------------------------------------------------------------------------
 //
 /// Transformation Methods
@@ -692,6 +961,102 @@ Schema::to_yaml_default() const
    return to_yaml();
 }
 
+//---------------------------------------------------------------------------//
+void
+Schema::to_binary(std::vector<uint8> &data) const
+{
+    std::map<std::string,uint64> name_ids;
+    std::vector<const std::string*> names;
+    detail::binary_schema_collect_names(*this,name_ids,names);
+
+    data.clear();
+    data.insert(data.end(),
+                detail::binary_schema_magic,
+                detail::binary_schema_magic + 4);
+    data.push_back(detail::binary_schema_version);
+
+    detail::write_varint((uint64)names.size(),data);
+    for(size_t i = 0; i < names.size(); i++)
+    {
+        const std::string &name = *names[i];
+        detail::write_varint((uint64)name.size(),data);
+        data.insert(data.end(),name.begin(),name.end());
+    }
+
+    detail::binary_schema_write_tree(*this,name_ids,data);
+}
+
+//---------------------------------------------------------------------------//
+void
+Schema::from_binary(const void *data, index_t num_bytes)
+{
+    if(!is_binary(data,num_bytes))
+    {
+        CONDUIT_ERROR("<Schema::from_binary> data does not start with a "
+                      "binary schema header");
+    }
+
+    const uint8 *ptr = (const uint8*)data;
+    const uint8 *end = ptr + num_bytes;
+
+    if(ptr[4] != detail::binary_schema_version)
+    {
+        CONDUIT_ERROR("<Schema::from_binary> unsupported binary schema "
+                      "version: " << (int)ptr[4]);
+    }
+    ptr += detail::binary_schema_header_bytes;
+
+    uint64 num_names = detail::read_varint(ptr,end);
+    if(num_names > (uint64)(end - ptr))
+    {
+        CONDUIT_ERROR("<Schema::from_binary> invalid name table size: "
+                      << num_names);
+    }
+    std::vector<std::string> names((size_t)num_names);
+    for(size_t i = 0; i < names.size(); i++)
+    {
+        uint64 len = detail::read_varint(ptr,end);
+        if(len > (uint64)(end - ptr))
+        {
+            CONDUIT_ERROR("<Schema::from_binary> unexpected end of data");
+        }
+        names[i].assign((const char*)ptr,(size_t)len);
+        ptr += len;
+    }
+
+    reset();
+    try
+    {
+        detail::binary_schema_read_tree(*this,names,ptr,end);
+        if(ptr != end)
+        {
+            CONDUIT_ERROR("<Schema::from_binary> unexpected trailing data: "
+                          << (end - ptr) << " bytes after the schema");
+        }
+    }
+    catch(const conduit::Error &)
+    {
+        reset();
+        throw;
+    }
+}
+
+//---------------------------------------------------------------------------//
+void
+Schema::from_binary(const std::vector<uint8> &data)
+{
+    from_binary(data.empty() ? NULL : &data[0],(index_t)data.size());
+}
+
+//---------------------------------------------------------------------------//
+bool
+Schema::is_binary(const void *data, index_t num_bytes)
+{
+    return data != NULL &&
+           num_bytes >= detail::binary_schema_header_bytes &&
+           memcmp(data,detail::binary_schema_magic,4) == 0;
+}
+
 
 //-----------------------------------------------------------------------------
 //
@@ -708,6 +1073,22 @@ Schema::save(const std::string &ofname,
              const std::string &pad,
              const std::string &eoe) const
 {
+    if ("conduit_bin_schema" == protocol)
+    {
+        std::vector<uint8> bin;
+        to_binary(bin);
+        std::ofstream ofile;
+        ofile.open(ofname.c_str(), std::ios::out | std::ios::binary);
+        if(!ofile.is_open())
+        {
+            CONDUIT_ERROR("<Schema::save> failed to open file: "
+                          << "\"" << ofname << "\"");
+        }
+        ofile.write((const char*)bin.data(),(std::streamsize)bin.size());
+        ofile.close();
+        return;
+    }
+
     // TODO: this is ineff, get base class rep correct?
     std::ostringstream oss;
     if ("json" == protocol)
@@ -741,7 +1122,7 @@ void
 Schema::load(const std::string &ifname)
 {
     std::ifstream ifile;
-    ifile.open(ifname.c_str());
+    ifile.open(ifname.c_str(), std::ios::in | std::ios::binary);
     if(!ifile.is_open())
     {
         CONDUIT_ERROR("<Schema::load> failed to open file: "
@@ -749,7 +1130,15 @@ Schema::load(const std::string &ifname)
     }
     std::string res((std::istreambuf_iterator<char>(ifile)),
                      std::istreambuf_iterator<char>());
-    set(res);
+
+    if(is_binary(res.data(),(index_t)res.size()))
+    {
+        from_binary(res.data(),(index_t)res.size());
+    }
+    else
+    {
+        set(res);
+    }
 }
 
 
@@ -823,21 +1212,21 @@ Schema::remove(index_t idx)
                     << idx << ">=" << chldrn.size() <<  "(number_of_children)");
     }
 
+    invalidate_fingerprint();
+
     if(dtype_id == DataType::OBJECT_ID)
     {
-        // any index above the current needs to shift down by one
-        for (size_t i = (size_t)idx; i < object_order().size(); i++)
-        {
-            object_map()[object_order()[i]]--;
-        }
-        
-        object_map().erase(object_order()[(size_t)idx]);
         object_order().erase(object_order().begin() + (size_t)idx);
     }
 
     Schema* child = chldrn[(size_t)idx];
-    delete child;
+    destroy_child_schema(child);
     chldrn.erase(chldrn.begin() + (size_t)idx);
+
+    if(dtype_id == DataType::OBJECT_ID)
+    {
+        object_index_rebuild();
+    }
 }
 
 //---------------------------------------------------------------------------//
@@ -870,13 +1259,13 @@ Schema::add_child(const std::string &name)
     }
 
     init_object();
+    invalidate_fingerprint();
 
-    Schema* child = new Schema();
-    child->m_parent = this;
+    Schema* child = create_child_schema();
     children().push_back(child);
-    object_map()[name] = children().size()-1;
     object_order().push_back(name);
-    return *children()[child_index(name)];
+    object_index_add_child();
+    return *child;
 }
 
 
@@ -995,23 +1384,15 @@ Schema::fetch_existing(const std::string &path) const
 index_t
 Schema::child_index(const std::string &name) const
 {
-    index_t res=0;
-
-    // find p_curr with an iterator
-    std::map<std::string, index_t>::const_iterator itr;
-    itr = object_map().find(name);
+    index_t res = find_child_index(name);
 
     // error if child does not exist. 
-    if(itr == object_map().end())
+    if(res < 0)
     {
         CONDUIT_ERROR("<Schema::child_index> Error: "
                       << "Schema(" << this->path() << ") "
                       << "attempt to access invalid child named:" << name);
     }
-    else
-    {
-        res = itr->second;
-    }
 
     return res;
 }
@@ -1066,19 +1447,16 @@ Schema::rename_child(const std::string &current_name,
                       " already exists.");
     }
 
-    std::map<std::string,index_t> &obj_map = object_map();
-    index_t idx = obj_map[current_name];
-
-    // update string to index map
+    invalidate_fingerprint();
 
-    // remove current_name
-    obj_map.erase(current_name);
-    // link new_name to the idx
-    obj_map[new_name] = idx;
+    index_t idx = find_child_index(current_name);
 
     // update index to string lookup
     object_order()[(size_t)idx] = new_name;
 
+    // update hash index
+    object_index_rebuild();
+
     // we don't need to modify children(), we are not changing the
     // child schema 
 }
@@ -1105,11 +1483,11 @@ Schema::fetch(const std::string &path)
     
     if (!has_path(p_curr)) 
     {
-        Schema* my_schema = new Schema();
-        my_schema->m_parent = this;
+        invalidate_fingerprint();
+        Schema* my_schema = create_child_schema();
         children().push_back(my_schema);
-        object_map()[p_curr] = children().size() - 1;
         object_order().push_back(p_curr);
+        object_index_add_child();
     }
 
     size_t idx = (size_t) child_index(p_curr);
@@ -1252,16 +1630,7 @@ Schema::has_child(const std::string &name) const
     if(m_dtype.id() != DataType::OBJECT_ID)
         return false;
 
-    const std::map<std::string,index_t> &ents = object_map();
-
-    if(ents.find(name) == ents.end())
-    {
-        return false;
-    }
-    else
-    {
-        return true;
-    }
+    return find_child_index(name) >= 0;
 }
 
 
@@ -1291,17 +1660,16 @@ Schema::has_path(const std::string &path) const
     utils::split_path(p_input,p_curr,p_next);
 
     // handle parent case (..)
-    const std::map<std::string,index_t> &ents = object_map();
+    index_t idx = find_child_index(p_curr);
 
-    if(ents.find(p_curr) == ents.end())
+    if(idx < 0)
     {
         return false;
     }
 
     if(!p_next.empty())
     {
-        size_t idx = (size_t) ents.find(p_curr)->second;
-        return children()[idx]->has_path(p_next);
+        return children()[(size_t)idx]->has_path(p_next);
     }
     else
     {
@@ -1365,17 +1733,14 @@ Schema::remove_child(const std::string &name)
                       " does not have named children.");
     }
 
+    invalidate_fingerprint();
+
     size_t idx = (size_t)child_index(name);
     Schema *child = children()[idx];
-    // any index above the current needs to shift down by one
-    for (size_t i = idx; i < object_order().size(); i++)
-    {
-        object_map()[object_order()[i]]--;
-    }
-    object_map().erase(name);
     object_order().erase(object_order().begin() + idx);
     children().erase(children().begin() + idx);
-    delete child;
+    destroy_child_schema(child);
+    object_index_rebuild();
 }
 
 //---------------------------------------------------------------------------//
@@ -1383,12 +1748,32 @@ Schema &
 Schema::append()
 {
     init_list();
-    Schema *sch = new Schema();
-    sch->m_parent = this;
+    invalidate_fingerprint();
+    Schema *sch = create_child_schema();
     children().push_back(sch);
     return *sch;
 }
 
+//-----------------------------------------------------------------------------
+//
+/// Child lookup settings
+//
+//-----------------------------------------------------------------------------
+
+//---------------------------------------------------------------------------//
+void
+Schema::set_object_index_threshold(index_t num_children)
+{
+    m_object_index_threshold = num_children;
+}
+
+//---------------------------------------------------------------------------//
+index_t
+Schema::object_index_threshold()
+{
+    return m_object_index_threshold;
+}
+
 
 //=============================================================================
 //-----------------------------------------------------------------------------
@@ -1414,6 +1799,10 @@ Schema::init_defaults()
     m_dtype  = DataType::empty();
     m_hierarchy_data = NULL;
     m_parent = NULL;
+    m_arena  = NULL;
+    m_arena_alloced = false;
+    m_fingerprint = 0;
+    m_fingerprint_valid = false;
 }
 
 //---------------------------------------------------------------------------//
@@ -1424,7 +1813,15 @@ Schema::init_object()
     {
         reset();
         m_dtype  = DataType::object();
-        m_hierarchy_data = new Schema_Object_Hierarchy();
+        if(m_arena != NULL)
+        {
+            void *ptr = m_arena->allocate(sizeof(Schema_Object_Hierarchy));
+            m_hierarchy_data = new (ptr) Schema_Object_Hierarchy();
+        }
+        else
+        {
+            m_hierarchy_data = new Schema_Object_Hierarchy();
+        }
     }
 }
 
@@ -1436,7 +1833,15 @@ Schema::init_list()
     {
         reset();
         m_dtype  = DataType::list();
-        m_hierarchy_data = new Schema_List_Hierarchy();
+        if(m_arena != NULL)
+        {
+            void *ptr = m_arena->allocate(sizeof(Schema_List_Hierarchy));
+            m_hierarchy_data = new (ptr) Schema_List_Hierarchy();
+        }
+        else
+        {
+            m_hierarchy_data = new Schema_List_Hierarchy();
+        }
     }
 }
 
@@ -1445,29 +1850,115 @@ Schema::init_list()
 void
 Schema::release()
 {
+    invalidate_fingerprint();
+
     if(dtype().id() == DataType::OBJECT_ID ||
        dtype().id() == DataType::LIST_ID)
     {
         std::vector<Schema*> &chld = children();
         for(size_t i=0; i< chld.size(); i++)
         {
-            delete chld[i];
+            destroy_child_schema(chld[i]);
         }
     }
     
     if(dtype().id() == DataType::OBJECT_ID)
     { 
-        delete object_hierarchy();
+        Schema_Object_Hierarchy *obj_hier = object_hierarchy();
+        if(m_arena != NULL)
+        {
+            obj_hier->~Schema_Object_Hierarchy();
+            Arena::deallocate(m_arena,obj_hier);
+        }
+        else
+        {
+            delete obj_hier;
+        }
     }
     else if(dtype().id() == DataType::LIST_ID)
     { 
-        delete list_hierarchy();
+        Schema_List_Hierarchy *list_hier = list_hierarchy();
+        if(m_arena != NULL)
+        {
+            list_hier->~Schema_List_Hierarchy();
+            Arena::deallocate(m_arena,list_hier);
+        }
+        else
+        {
+            delete list_hier;
+        }
     }
 
     m_dtype  = DataType::empty();
     m_hierarchy_data = NULL;
 }
 
+//---------------------------------------------------------------------------//
+void
+Schema::invalidate_fingerprint()
+{
+    // ancestors of a schema with a stale fingerprint are already stale
+    Schema *curr = this;
+    while(curr != NULL && curr->m_fingerprint_valid.load())
+    {
+        curr->m_fingerprint_valid.store(false);
+        curr = curr->m_parent;
+    }
+}
+
+//---------------------------------------------------------------------------//
+Schema *
+Schema::create_child_schema()
+{
+    Schema *res = NULL;
+    if(m_arena != NULL)
+    {
+        res = new (m_arena->allocate(sizeof(Schema))) Schema();
+        res->m_arena_alloced = true;
+        res->m_arena = m_arena;
+        m_arena->add_ref();
+    }
+    else
+    {
+        res = new Schema();
+    }
+    res->m_parent = this;
+    return res;
+}
+
+//---------------------------------------------------------------------------//
+void
+Schema::destroy_child_schema(Schema *schema)
+{
+    if(schema->m_arena_alloced)
+    {
+        // the schema's own reference is dropped by its destructor,
+        // the arena stays alive until the allocation is returned
+        Arena *arena = schema->m_arena;
+        schema->~Schema();
+        Arena::deallocate(arena,schema);
+    }
+    else
+    {
+        delete schema;
+    }
+}
+
+//---------------------------------------------------------------------------//
+void
+Schema::set_arena(Arena *arena)
+{
+    // any existing hierarchy data came from the old arena
+    release();
+
+    if(arena != NULL)
+    {
+        arena->add_ref();
+    }
+    Arena::release(m_arena);
+    m_arena = arena;
+}
+
 
 
 //-----------------------------------------------------------------------------
@@ -1479,7 +1970,7 @@ Schema::release()
 
 
 //---------------------------------------------------------------------------//
-void    
+index_t
 Schema::compact_to(Schema &s_dest, index_t curr_offset) const
 {
     index_t dtype_id = m_dtype.id();
@@ -1488,24 +1979,25 @@ Schema::compact_to(Schema &s_dest, index_t curr_offset) const
     {
         s_dest.init_object();
         size_t nchildren = children().size();
+        s_dest.children().reserve(nchildren);
+        s_dest.object_order().reserve(nchildren);
         for(size_t i=0; i < nchildren;i++)
         {
             Schema  *cld_src = children()[i];
             Schema &cld_dest = s_dest.add_child(object_order()[i]);
-            cld_src->compact_to(cld_dest,curr_offset);
-            curr_offset += cld_dest.total_bytes_compact();
+            curr_offset = cld_src->compact_to(cld_dest,curr_offset);
         }
     }
     else if(dtype_id == DataType::LIST_ID)
     {
         s_dest.init_list();
         size_t nchildren = children().size();
+        s_dest.children().reserve(nchildren);
         for(size_t i=0; i < nchildren ;i++)
         {            
             Schema  *cld_src = children()[i];
             Schema &cld_dest = s_dest.append();
-            cld_src->compact_to(cld_dest,curr_offset);
-            curr_offset += cld_dest.total_bytes_compact();
+            curr_offset = cld_src->compact_to(cld_dest,curr_offset);
         }
     }
     else if (dtype_id != DataType::EMPTY_ID)
@@ -1513,7 +2005,10 @@ Schema::compact_to(Schema &s_dest, index_t curr_offset) const
         // create a compact data type
         m_dtype.compact_to(s_dest.m_dtype);
         s_dest.m_dtype.set_offset(curr_offset);
+        curr_offset += s_dest.m_dtype.bytes_compact();
     }
+
+    return curr_offset;
 }
 
 
@@ -1619,14 +2114,6 @@ Schema::children()
 
 }
 
-//---------------------------------------------------------------------------//
-std::map<std::string, index_t> &
-Schema::object_map()
-{
-    return object_hierarchy()->object_map;
-}
-
-
 //---------------------------------------------------------------------------//
 std::vector<std::string> &
 Schema::object_order()
@@ -1664,14 +2151,6 @@ Schema::child_index(Schema *schema_ptr) const
     return -1;
 }
 
-//---------------------------------------------------------------------------//
-const std::map<std::string, index_t> &
-Schema::object_map() const
-{
-    return object_hierarchy()->object_map;
-}
-
-
 //---------------------------------------------------------------------------//
 const std::vector<std::string> &
 Schema::object_order() const
@@ -1699,15 +2178,125 @@ Schema::object_map_print() const
 void
 Schema::object_order_print() const
 {
-    std::map<std::string, index_t>::const_iterator itr; 
-        
-    for(itr = object_map().begin(); itr != object_map().end();itr++)
+    size_t sz = object_order().size();
+    for(size_t i=0;i<sz;i++)
     {
-       std::cout << itr->first << ":" << itr->second << " ";
+        std::cout << object_order()[i] << ":" << i << " ";
     }
     std::cout << std::endl;
 }
 
+//---------------------------------------------------------------------------//
+index_t
+Schema::find_child_index(const std::string &name) const
+{
+    const Schema_Object_Hierarchy *obj_h = object_hierarchy();
+    const Schema_Object_Index &obj_idx = obj_h->object_index;
+
+    if(obj_idx.slots.empty())
+    {
+        // no index (small object, or the index is disabled): scan names
+        const std::vector<std::string> &names = obj_h->object_order;
+        for(size_t i=0; i < names.size(); i++)
+        {
+            if(names[i] == name)
+            {
+                return (index_t)i;
+            }
+        }
+        return -1;
+    }
+
+    unsigned int h = utils::hash(name);
+    size_t mask = obj_idx.slots.size() - 1;
+    size_t slot = (size_t)h & mask;
+
+    // linear probe until we hit an empty slot
+    while(obj_idx.slots[slot] >= 0)
+    {
+        size_t cld_idx = (size_t)obj_idx.slots[slot];
+        if(obj_idx.hashes[cld_idx] == h &&
+           obj_h->object_order[cld_idx] == name)
+        {
+            return (index_t)cld_idx;
+        }
+        slot = (slot + 1) & mask;
+    }
+
+    return -1;
+}
+
+//---------------------------------------------------------------------------//
+void
+Schema::object_index_add_child()
+{
+    Schema_Object_Hierarchy *obj_h = object_hierarchy();
+    Schema_Object_Index &obj_idx = obj_h->object_index;
+
+    size_t num_children = obj_h->object_order.size();
+
+    // keep the load factor at or below 1/2, rebuild if the index
+    // doesn't exist yet or needs to grow
+    if(obj_idx.slots.empty() || 2 * num_children > obj_idx.slots.size())
+    {
+        object_index_rebuild();
+        return;
+    }
+
+    size_t cld_idx = num_children - 1;
+    unsigned int h = utils::hash(obj_h->object_order[cld_idx]);
+    obj_idx.hashes.push_back(h);
+
+    size_t mask = obj_idx.slots.size() - 1;
+    size_t slot = (size_t)h & mask;
+    while(obj_idx.slots[slot] >= 0)
+    {
+        slot = (slot + 1) & mask;
+    }
+    obj_idx.slots[slot] = (index_t)cld_idx;
+}
+
+//---------------------------------------------------------------------------//
+void
+Schema::object_index_rebuild()
+{
+    Schema_Object_Hierarchy *obj_h = object_hierarchy();
+    Schema_Object_Index &obj_idx = obj_h->object_index;
+
+    size_t num_children = obj_h->object_order.size();
+
+    if(m_object_index_threshold <= 0 ||
+       num_children < (size_t)m_object_index_threshold)
+    {
+        // release any existing index
+        std::vector<index_t>().swap(obj_idx.slots);
+        std::vector<unsigned int>().swap(obj_idx.hashes);
+        return;
+    }
+
+    size_t num_slots = 16;
+    while(num_slots < 2 * num_children)
+    {
+        num_slots *= 2;
+    }
+
+    obj_idx.slots.assign(num_slots,-1);
+    obj_idx.hashes.resize(num_children);
+
+    size_t mask = num_slots - 1;
+    for(size_t i=0; i < num_children; i++)
+    {
+        unsigned int h = utils::hash(obj_h->object_order[i]);
+        obj_idx.hashes[i] = h;
+        size_t slot = (size_t)h & mask;
+        while(obj_idx.slots[slot] >= 0)
+        {
+            slot = (slot + 1) & mask;
+        }
+        obj_idx.slots[slot] = (index_t)i;
+    }
+}
+
 
 }
 //-----------------------------------------------------------------------------
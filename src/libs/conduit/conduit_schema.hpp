@@ -16,6 +16,7 @@
 //-----------------------------------------------------------------------------
 #include <map>
 #include <vector>
+#include <atomic>
 #include <string>
 #include <sstream>
 
@@ -23,6 +24,7 @@
 // -- conduit includes -- 
 //-----------------------------------------------------------------------------
 #include "conduit_core.hpp"
+#include "conduit_arena.hpp"
 #include "conduit_endianness.hpp"
 #include "conduit_data_type.hpp"
 
@@ -52,6 +54,7 @@ public:
     friend class Node;
     friend class NodeIterator;
     friend class NodeConstIterator;
+    friend class Path;
 
 //----------------------------------------------------------------------------
 //
@@ -114,8 +117,10 @@ public:
     const DataType &dtype() const 
                         {return m_dtype;}
 
+    /// (marks the cached fingerprint as stale, since the dtype can be
+    /// changed through the returned reference)
     DataType       &dtype() 
-                        {return m_dtype;}
+                        {invalidate_fingerprint(); return m_dtype;}
 
     index_t         element_index(index_t idx) const 
                         {return m_dtype.element_index(idx);}
@@ -132,6 +137,16 @@ public:
     /// is this schema equal to given schema
     bool            equals(const Schema &s) const;
 
+    /// 64-bit hash of the schema's structure (child names and order, and
+    /// the dtypes of all leaves). The value is cached and recomputed after
+    /// this schema or any of its descendants change, so it can be used as
+    /// a cheap key for caches of schema derived data. Schemas with
+    /// different fingerprints are never equal, equals() rejects them
+    /// without walking the tree. Equal fingerprints are not proof of
+    /// equality (hashes can collide), so they are not used as such.
+    /// Concurrent calls on an unchanging schema are safe.
+    uint64          fingerprint() const;
+
     /// sum of the strided bytes of all leaves
     index_t         total_strided_bytes() const;
     /// sum of the bytes of the compact form of all leaves
@@ -257,6 +272,23 @@ public:
     // difficulty allocating default string parameters.
     std::string         to_yaml_default() const;
 
+    //-----------------------------------------------------------------------------
+    // -- Binary encoding methods ---
+    //-----------------------------------------------------------------------------
+    /// Creates a compact binary representation of a schema. Much smaller
+    /// and faster to parse than JSON: names are stored once in a name
+    /// table and dtype ids, sizes and offsets are stored as varints.
+    /// The encoding is also available as the "conduit_bin_schema"
+    /// Generator and Schema::save() protocol.
+    void                to_binary(std::vector<uint8> &data) const;
+
+    /// sets this schema from the output of to_binary()
+    void                from_binary(const void *data, index_t num_bytes);
+    void                from_binary(const std::vector<uint8> &data);
+
+    /// checks if the passed bytes start with the binary schema header
+    static bool         is_binary(const void *data, index_t num_bytes);
+
 //-----------------------------------------------------------------------------
 //
 /// Basic I/O methods
@@ -270,6 +302,7 @@ public:
                          const std::string &pad=" ",
                          const std::string &eoe="\n") const;
 
+    /// loads a json, yaml, or binary ("conduit_bin_schema") schema file
     void            load(const std::string &stream_path);
 
 
@@ -362,6 +395,18 @@ public:
 //-----------------------------------------------------------------------------
     Schema &append();
 
+//-----------------------------------------------------------------------------
+//
+/// Child lookup settings
+//
+//-----------------------------------------------------------------------------
+    /// Object schemas with at least this many children maintain a hash
+    /// index to accelerate child name lookups, smaller objects scan
+    /// their child names. A threshold of 0 disables the hash index.
+    /// Changes only apply to objects that are modified after the call.
+    static void     set_object_index_threshold(index_t num_children);
+    static index_t  object_index_threshold();
+
 private:
 //-----------------------------------------------------------------------------
 //
@@ -376,6 +421,16 @@ private:
     void        init_object();
     // cleanup any allocated memory.
     void        release();
+    // marks the cached fingerprint of this schema and its ancestors stale
+    void        invalidate_fingerprint();
+    // creates a child schema (from this schema's arena, if set)
+    // with this schema as its parent
+    Schema     *create_child_schema();
+    // destroys a child schema created via create_child_schema()
+    static void destroy_child_schema(Schema *schema);
+    // sets the arena used to create children and hierarchy data,
+    // releases any current children. (used by Node::enable_arena)
+    void        set_arena(Arena *arena);
 
     /// helps with proper alloc size for:
     /// Node::set_using_schema()and Node::set_data_using_schema
@@ -392,7 +447,8 @@ private:
 /// -- Private transform helpers -- 
 //
 //-----------------------------------------------------------------------------
-    void        compact_to(Schema &s_dest, index_t curr_offset) const ;
+    // returns the offset past the compacted data
+    index_t     compact_to(Schema &s_dest, index_t curr_offset) const ;
     void        walk_schema(const std::string &json_schema);
 //-----------------------------------------------------------------------------
 //
@@ -403,13 +459,33 @@ private:
 /// Holds hierarchy data for schemas that describe an object.
 //-----------------------------------------------------------------------------
 
+//-----------------------------------------------------------------------------
+/// Optional hash index used to accelerate child name lookups for objects
+/// with many children. This is an open addressing (linear probing) table
+/// that stores child indices, keys are not duplicated: each slot is checked
+/// against the cached hash of the child's name and then object_order.
+//-----------------------------------------------------------------------------
+    struct Schema_Object_Index
+    {
+        /// table slots, holds a child index or -1 for an empty slot.
+        /// the number of slots is always a power of two
+        std::vector<index_t>            slots;
+        /// hash of each child name, in child order
+        std::vector<unsigned int>       hashes;
+    };
+
     struct Schema_Object_Hierarchy 
     {
         std::vector<Schema*>            children;
         std::vector<std::string>        object_order;
-        std::map<std::string, index_t>  object_map;
+        /// empty unless the number of children reaches
+        /// the object index threshold
+        Schema_Object_Index             object_index;
     };
 
+    // number of children that triggers use of the object index
+    static index_t                      m_object_index_threshold;
+
     // this is used to return a ref to an empty list of strings as 
     // child names when the schema is not in the object role.
     static std::vector<std::string>     m_empty_child_names;
@@ -434,15 +510,24 @@ private:
 //-----------------------------------------------------------------------------
     // for obj and list interfaces
     std::vector<Schema*>                   &children();
-    std::map<std::string, index_t>         &object_map();
     std::vector<std::string>               &object_order();
 
     const std::vector<Schema*>             &children()  const;    
-    const std::map<std::string, index_t>   &object_map()   const;
     const std::vector<std::string>         &object_order() const;
 
     void                                   object_map_print()   const;
     void                                   object_order_print() const;
+
+    /// finds the index of the named child, returns -1 if the child does
+    /// not exist (uses the object index when available, otherwise
+    /// scans object_order)
+    index_t                                find_child_index(const std::string &name) const;
+    /// adds the newest child to the object index, or builds the index
+    /// if the number of children has reached the threshold
+    void                                   object_index_add_child();
+    /// rebuilds (or drops) the object index after children are renamed
+    /// or removed
+    void                                   object_index_rebuild();
 //-----------------------------------------------------------------------------
 /// Cast helpers for hierarchy data.
 //-----------------------------------------------------------------------------
@@ -465,7 +550,7 @@ private:
     DataType    m_dtype;
     /// holds the schema hierarchy data.
     /// Instead of accessing this directly, use the private methods:
-    ///   children(), object_map(), object_order
+    ///   children(), object_order()
     /// concretely, this will be:
     /// - NULL for leaf type
     /// - A Schema_Object_Hierarchy instance for schemas describing an object
@@ -474,6 +559,17 @@ private:
     /// if this schema instance has a parent, this holds the pointer to that
     /// parent
     Schema     *m_parent;
+    /// arena used to create children and hierarchy data (NULL for the heap),
+    /// holds a reference when set
+    Arena      *m_arena;
+    /// true if this schema instance was allocated from m_arena
+    bool        m_arena_alloced;
+    /// cached result of fingerprint(), valid if m_fingerprint_valid.
+    /// (if a schema's fingerprint is valid, so are its descendants')
+    /// these are atomic since const readers may fill the cache
+    /// from several threads
+    mutable std::atomic<uint64>  m_fingerprint;
+    mutable std::atomic<bool>    m_fingerprint_valid;
 
 
 };
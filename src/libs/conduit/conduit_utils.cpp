@@ -38,9 +38,11 @@
 #include <stdlib.h>
 
 #include <algorithm>
+#include <atomic>
 #include <limits>
 #include <fstream>
 #include <map>
+#include <mutex>
 
 
 // define proper path sep
@@ -53,6 +55,7 @@
 static const std::string file_path_sep_string(CONDUIT_UTILS_FILE_PATH_SEPARATOR);
 
 #include "conduit.hpp"
+#include "conduit_execution.hpp"
 #include "conduit_fmt/conduit_fmt.h"
 
 
@@ -249,6 +252,7 @@ conduit_allocate(size_t n_items,
                  size_t item_size,
                  index_t allocator_id)
 {
+    instrumentation::record_allocate(allocator_id, n_items * item_size);
     return detail::AllocManager::instance().allocate(n_items,
                                                      item_size,
                                                      allocator_id);
@@ -259,15 +263,245 @@ void
 conduit_free(void *ptr,
              index_t allocator_id)
 {
+    instrumentation::record_free(allocator_id);
     detail::AllocManager::instance().free(ptr,allocator_id);
 }
 
+namespace detail
+{
+    //
+    // PoolAllocator: A singleton size-class pool that caches freed blocks
+    //
+    // Block sizes are rounded up to one of four classes per power of two
+    // (so at most 25% of a block is unused) and each block is preceded
+    // by a header that records its class. Freed blocks are kept on per
+    // class free lists, up to a limit on the total cached bytes.
+    //
+    // NOTE: Like the AllocManager, the singleton is intentionally leaked
+    // because Nodes may free pool blocks during static destruction.
+    //
+    class PoolAllocator {
+
+     public:
+          static PoolAllocator& instance()
+          {
+            static PoolAllocator *inst = new PoolAllocator();
+            return *inst;
+          }
+
+          void *allocate(size_t nbytes)
+          {
+              size_t class_bytes = 0;
+              size_t class_idx = size_class(nbytes,class_bytes);
+
+              {
+                  std::lock_guard<std::mutex> lock(m_mutex);
+                  std::vector<BlockHeader*> &blocks = m_free_lists[class_idx];
+                  if(!blocks.empty())
+                  {
+                      BlockHeader *hdr = blocks.back();
+                      blocks.pop_back();
+                      m_cached_bytes -= class_bytes;
+                      void *res = (void*)(hdr + 1);
+                      // match the default allocator (calloc)
+                      memset(res,0,nbytes);
+                      return res;
+                  }
+              }
+
+              BlockHeader *hdr = (BlockHeader*) calloc(1,
+                                                sizeof(BlockHeader) +
+                                                class_bytes);
+              if(hdr == NULL)
+              {
+                  return NULL;
+              }
+              hdr->class_idx = class_idx;
+              return (void*)(hdr + 1);
+          }
+
+          void free(void *ptr)
+          {
+              if(ptr == NULL)
+              {
+                  return;
+              }
+
+              BlockHeader *hdr = ((BlockHeader*)ptr) - 1;
+              size_t class_bytes = size_class_bytes(hdr->class_idx);
+
+              {
+                  std::lock_guard<std::mutex> lock(m_mutex);
+                  if(m_cached_bytes + class_bytes <= m_max_cached_bytes)
+                  {
+                      m_free_lists[hdr->class_idx].push_back(hdr);
+                      m_cached_bytes += class_bytes;
+                      return;
+                  }
+              }
+
+              ::free(hdr);
+          }
+
+          void trim()
+          {
+              std::lock_guard<std::mutex> lock(m_mutex);
+              for(size_t i = 0; i < NUM_CLASSES; i++)
+              {
+                  std::vector<BlockHeader*> &blocks = m_free_lists[i];
+                  for(size_t j = 0; j < blocks.size(); j++)
+                  {
+                      ::free(blocks[j]);
+                  }
+                  blocks.clear();
+              }
+              m_cached_bytes = 0;
+          }
+
+          size_t cached_bytes()
+          {
+              std::lock_guard<std::mutex> lock(m_mutex);
+              return m_cached_bytes;
+          }
+
+          size_t max_cached_bytes()
+          {
+              std::lock_guard<std::mutex> lock(m_mutex);
+              return m_max_cached_bytes;
+          }
+
+          void set_max_cached_bytes(size_t max_bytes)
+          {
+              {
+                  std::lock_guard<std::mutex> lock(m_mutex);
+                  m_max_cached_bytes = max_bytes;
+                  if(m_cached_bytes <= m_max_cached_bytes)
+                  {
+                      return;
+                  }
+              }
+              trim();
+          }
+
+     private:
+          // keeps the returned pointers 16 byte aligned
+          struct BlockHeader
+          {
+              size_t class_idx;
+              size_t pad;
+          };
+
+          // classes: 0 holds blocks up to 64 bytes, then four classes
+          // per power of two
+          static const size_t MIN_CLASS_BYTES = 64;
+          static const size_t MIN_CLASS_SHIFT = 6;
+          static const size_t NUM_CLASSES = 1 + 4 * (64 - MIN_CLASS_SHIFT);
+
+          static size_t size_class(size_t nbytes,
+                                   size_t &class_bytes)
+          {
+              if(nbytes <= MIN_CLASS_BYTES)
+              {
+                  class_bytes = MIN_CLASS_BYTES;
+                  return 0;
+              }
+              // largest power of two less than nbytes
+              size_t shift = MIN_CLASS_SHIFT;
+              while( shift < 63 && ((size_t)1 << (shift + 1)) < nbytes)
+              {
+                  shift++;
+              }
+              size_t base = (size_t)1 << shift;
+              size_t step = base / 4;
+              size_t sub  = (nbytes - base + step - 1) / step;
+              class_bytes = base + sub * step;
+              return 1 + 4 * (shift - MIN_CLASS_SHIFT) + (sub - 1);
+          }
+
+          static size_t size_class_bytes(size_t class_idx)
+          {
+              if(class_idx == 0)
+              {
+                  return MIN_CLASS_BYTES;
+              }
+              size_t shift = MIN_CLASS_SHIFT + (class_idx - 1) / 4;
+              size_t sub   = 1 + (class_idx - 1) % 4;
+              size_t base  = (size_t)1 << shift;
+              return base + sub * (base / 4);
+          }
+
+          PoolAllocator()
+          : m_cached_bytes(0),
+            m_max_cached_bytes((size_t)1 << 30)
+          {}
+
+          std::mutex                 m_mutex;
+          std::vector<BlockHeader*>  m_free_lists[NUM_CLASSES];
+          size_t                     m_cached_bytes;
+          size_t                     m_max_cached_bytes;
+    };
+}
+
+//-----------------------------------------------------------------------------
+void *
+pool_allocate(size_t n_items,
+              size_t item_size)
+{
+    return detail::PoolAllocator::instance().allocate(n_items * item_size);
+}
+
+//-----------------------------------------------------------------------------
+void
+pool_free(void *ptr)
+{
+    detail::PoolAllocator::instance().free(ptr);
+}
+
+//-----------------------------------------------------------------------------
+index_t
+pool_allocator_id()
+{
+    // registered once, on first use
+    static index_t pool_id = register_allocator(pool_allocate,
+                                                pool_free);
+    return pool_id;
+}
+
+//-----------------------------------------------------------------------------
+void
+pool_trim()
+{
+    detail::PoolAllocator::instance().trim();
+}
+
+//-----------------------------------------------------------------------------
+size_t
+pool_cached_bytes()
+{
+    return detail::PoolAllocator::instance().cached_bytes();
+}
+
+//-----------------------------------------------------------------------------
+size_t
+pool_max_cached_bytes()
+{
+    return detail::PoolAllocator::instance().max_cached_bytes();
+}
+
+//-----------------------------------------------------------------------------
+void
+set_pool_max_cached_bytes(size_t max_bytes)
+{
+    detail::PoolAllocator::instance().set_max_cached_bytes(max_bytes);
+}
+
 //-----------------------------------------------------------------------------
 void
 conduit_memcpy(void *destination,
                const void *source,
                size_t num)
 {
+    instrumentation::record_memcpy(num);
     conduit_handle_memcpy(destination,source,num);
 }
 
@@ -1306,29 +1540,211 @@ unescape_special_chars(const std::string &input)
 }
 
 
+//-----------------------------------------------------------------------------
+// -- begin conduit::utils::detail (base64) --
+//-----------------------------------------------------------------------------
+namespace detail
+{
+
+//-----------------------------------------------------------------------------
+// Base64 codec
+//
+// Full 3 byte / 4 char groups are encoded and decoded with lookup tables.
+// Groups are independent, so buffers with at least
+// base64_parallel_threshold bytes are split into chunks of whole groups
+// that run in parallel. The padded tail and any input that is not pure
+// base64 (whitespace, etc) are handled by libb64.
+//-----------------------------------------------------------------------------
+#if defined(CONDUIT_USE_OPENMP)
+using Base64Exec = execution::OpenMPExec;
+#else
+// runs serially unless threads or an executor are enabled via
+// conduit::execution::task
+using Base64Exec = execution::TaskExec;
+#endif
+
+static const index_t base64_parallel_threshold = 1 << 20;
+// number of groups per chunk
+static const index_t base64_chunk_groups = 1 << 16;
+
+static const char base64_alphabet[] =
+    "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+//-----------------------------------------------------------------------------
+// maps 12 bits of input to the two chars that encode them
+//-----------------------------------------------------------------------------
+class Base64EncodeTable
+{
+public:
+    static const Base64EncodeTable &instance()
+    {
+        static const Base64EncodeTable inst;
+        return inst;
+    }
+
+    char m_pairs[4096][2];
+
+private:
+    Base64EncodeTable()
+    {
+        for(int i = 0; i < 4096; i++)
+        {
+            m_pairs[i][0] = base64_alphabet[i >> 6];
+            m_pairs[i][1] = base64_alphabet[i & 0x3f];
+        }
+    }
+};
+
+//-----------------------------------------------------------------------------
+// maps chars to their 6 bit value, or -1 for chars outside the alphabet
+//-----------------------------------------------------------------------------
+class Base64DecodeTable
+{
+public:
+    static const Base64DecodeTable &instance()
+    {
+        static const Base64DecodeTable inst;
+        return inst;
+    }
+
+    int32 m_values[256];
+
+private:
+    Base64DecodeTable()
+    {
+        for(int i = 0; i < 256; i++)
+        {
+            m_values[i] = -1;
+        }
+        for(int i = 0; i < 64; i++)
+        {
+            m_values[(uint8)base64_alphabet[i]] = i;
+        }
+    }
+};
+
+//-----------------------------------------------------------------------------
+// calls func(group_begin, group_end) over [0, num_groups), in parallel
+// chunks for large buffers
+//-----------------------------------------------------------------------------
+template <typename Func>
+void
+base64_for_groups(index_t num_groups,
+                  index_t group_nbytes,
+                  Func &&func)
+{
+    if(num_groups * group_nbytes < base64_parallel_threshold)
+    {
+        func(0,num_groups);
+        return;
+    }
+
+    const index_t num_chunks = (num_groups + base64_chunk_groups - 1) /
+                                base64_chunk_groups;
+    execution::for_all<Base64Exec>(0, (size_t)num_chunks, [&](index_t c)
+    {
+        const index_t group_begin = c * base64_chunk_groups;
+        const index_t group_end   = std::min(group_begin + base64_chunk_groups,
+                                             num_groups);
+        func(group_begin,group_end);
+    },
+    1);
+}
+
+//-----------------------------------------------------------------------------
+static void
+base64_encode_groups(const uint8 *src,
+                     index_t num_groups,
+                     char *dest)
+{
+    const Base64EncodeTable &table = Base64EncodeTable::instance();
+    for(index_t i = 0; i < num_groups; i++)
+    {
+        const uint32 v = ((uint32)src[0] << 16) |
+                         ((uint32)src[1] << 8)  |
+                          (uint32)src[2];
+        memcpy(dest,     table.m_pairs[v >> 12],  2);
+        memcpy(dest + 2, table.m_pairs[v & 0xfff],2);
+        src  += 3;
+        dest += 4;
+    }
+}
+
+//-----------------------------------------------------------------------------
+// returns false if a group holds a char outside the alphabet
+//-----------------------------------------------------------------------------
+static bool
+base64_decode_groups(const char *src,
+                     index_t num_groups,
+                     uint8 *dest)
+{
+    const int32 *values = Base64DecodeTable::instance().m_values;
+    for(index_t i = 0; i < num_groups; i++)
+    {
+        const int32 a = values[(uint8)src[0]];
+        const int32 b = values[(uint8)src[1]];
+        const int32 c = values[(uint8)src[2]];
+        const int32 d = values[(uint8)src[3]];
+        if((a | b | c | d) < 0)
+        {
+            return false;
+        }
+        const uint32 v = ((uint32)a << 18) | ((uint32)b << 12) |
+                         ((uint32)c << 6)  |  (uint32)d;
+        dest[0] = (uint8)(v >> 16);
+        dest[1] = (uint8)(v >> 8);
+        dest[2] = (uint8)v;
+        src  += 4;
+        dest += 3;
+    }
+    return true;
+}
+
+}
+//-----------------------------------------------------------------------------
+// -- end conduit::utils::detail (base64) --
+//-----------------------------------------------------------------------------
+
 //-----------------------------------------------------------------------------
 void
 base64_encode(const void *src,
               const index_t src_nbytes,
               void *dest)
 {
-    int nbytes = (int)src_nbytes;
-    base64_encodestate enc_state;
-    base64_init_encodestate(&enc_state);
-    const char *src_ptr = (const char*)src;
-    char *des_ptr       = (char*)dest;
-    memset(des_ptr,0,(size_t)base64_encode_buffer_size(src_nbytes));
+    const uint8 *src_ptr = (const uint8*)src;
+    char *des_ptr        = (char*)dest;
 
-    int code_len = base64_encode_block(src_ptr,
-                                       nbytes,
-                                       des_ptr,
-                                       &enc_state);
-    des_ptr += code_len;
-    code_len = base64_encode_blockend(des_ptr, &enc_state);
-    des_ptr += code_len;
+    const index_t num_groups = src_nbytes / 3;
+    detail::base64_for_groups(num_groups, 3,
+                              [&](index_t group_begin, index_t group_end)
+    {
+        detail::base64_encode_groups(src_ptr + group_begin * 3,
+                                     group_end - group_begin,
+                                     des_ptr + group_begin * 4);
+    });
+
+    // pad the last 1 or 2 bytes
+    const uint8 *tail_src = src_ptr + num_groups * 3;
+    char *tail_des        = des_ptr + num_groups * 4;
+    const index_t tail_nbytes = src_nbytes - num_groups * 3;
+    if(tail_nbytes > 0)
+    {
+        uint32 v = (uint32)tail_src[0] << 16;
+        if(tail_nbytes > 1)
+        {
+            v |= (uint32)tail_src[1] << 8;
+        }
+        tail_des[0] = detail::base64_alphabet[(v >> 18) & 0x3f];
+        tail_des[1] = detail::base64_alphabet[(v >> 12) & 0x3f];
+        tail_des[2] = tail_nbytes > 1 ? detail::base64_alphabet[(v >> 6) & 0x3f]
+                                      : '=';
+        tail_des[3] = '=';
+        tail_des += 4;
+    }
 
-    // for some reason libb64 adds a newline
-    des_ptr[-1] = 0;
+    // null terminate, and zero the rest of the buffer
+    const char *des_end = des_ptr + base64_encode_buffer_size(src_nbytes);
+    memset(tail_des,0,(size_t)(des_end - tail_des));
 }
 
 //-----------------------------------------------------------------------------
@@ -1352,14 +1768,43 @@ base64_decode(const void *src,
               index_t src_nbytes,
               void *dest)
 {
+    const char *src_ptr = (const char*)src;
+    uint8 *des_ptr      = (uint8*)dest;
+
+    // find the full groups that precede the padding (and any trailing
+    // nulls, newlines, etc)
+    const int32 *values = detail::Base64DecodeTable::instance().m_values;
+    index_t data_nbytes = src_nbytes;
+    while(data_nbytes > 0 && values[(uint8)src_ptr[data_nbytes-1]] < 0)
+    {
+        data_nbytes--;
+    }
+    index_t num_groups = data_nbytes / 4;
+
+    std::atomic<bool> groups_ok(true);
+    detail::base64_for_groups(num_groups, 4,
+                              [&](index_t group_begin, index_t group_end)
+    {
+        if(!detail::base64_decode_groups(src_ptr + group_begin * 4,
+                                         group_end - group_begin,
+                                         des_ptr + group_begin * 3))
+        {
+            groups_ok = false;
+        }
+    });
+
+    // libb64 skips chars outside the alphabet, if we found any
+    // let it decode the entire buffer
+    if(!groups_ok)
+    {
+        num_groups = 0;
+    }
+
     base64_decodestate dec_state;
-    int src_len = (int)src_nbytes;
     base64_init_decodestate(&dec_state);
-    const char *src_ptr = (const char*)src;
-    char *des_ptr = (char*)dest;
-    base64_decode_block(src_ptr,
-                        src_len,
-                        des_ptr,
+    base64_decode_block(src_ptr + num_groups * 4,
+                        (int)(src_nbytes - num_groups * 4),
+                        (char*)(des_ptr + num_groups * 3),
                         &dec_state);
 }
 
@@ -1399,6 +1844,80 @@ float64_to_string(float64 value)
     return res;
 }
 
+//-----------------------------------------------------------------------------
+void
+append_json_number(std::string &buffer, int64 value)
+{
+    conduit_fmt::format_int res(value);
+    buffer.append(res.data(),res.size());
+}
+
+//-----------------------------------------------------------------------------
+void
+append_json_number(std::string &buffer, uint64 value)
+{
+    conduit_fmt::format_int res(value);
+    buffer.append(res.data(),res.size());
+}
+
+//-----------------------------------------------------------------------------
+// shared by the float32 and float64 cases, `txt` holds the shortest round
+// trip text from fmt
+static void
+append_json_float_text(std::string &buffer, const char *txt, const char *end)
+{
+    bool has_dot_or_exp = false;
+    bool inf_or_nan = false;
+    for(const char *c = txt; c < end; c++)
+    {
+        if(*c == '.' || *c == 'e')
+        {
+            has_dot_or_exp = true;
+        }
+        // looking for 'n' covers inf and nan
+        else if(*c == 'n')
+        {
+            inf_or_nan = true;
+        }
+    }
+
+    if(inf_or_nan)
+    {
+        buffer += '"';
+        buffer.append(txt,end);
+        buffer += '"';
+    }
+    else
+    {
+        buffer.append(txt,end);
+        // keep the value a floating point number for json parsers
+        if(!has_dot_or_exp)
+        {
+            buffer.append(".0",2);
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+void
+append_json_number(std::string &buffer, float32 value)
+{
+    char txt[64];
+    // (same as format_to(txt,"{}",value), without format string parsing)
+    char *end = conduit_fmt::detail::write<char>(txt,value);
+    append_json_float_text(buffer,txt,end);
+}
+
+//-----------------------------------------------------------------------------
+void
+append_json_number(std::string &buffer, float64 value)
+{
+    char txt[64];
+    // (same as format_to(txt,"{}",value), without format string parsing)
+    char *end = conduit_fmt::detail::write<char>(txt,value);
+    append_json_float_text(buffer,txt,end);
+}
+
 //-----------------------------------------------------------------------------
 /// fmt style string formatting helpers
 //-----------------------------------------------------------------------------
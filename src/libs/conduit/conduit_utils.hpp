@@ -21,6 +21,7 @@
 #include <sstream>
 #include <chrono>
 #include <cstdlib>
+#include <type_traits>
 
 //-----------------------------------------------------------------------------
 // -- conduit includes --
@@ -332,6 +333,33 @@ namespace utils
     void CONDUIT_API conduit_free(void *data_ptr,
                                   index_t allocator_id = 0);
 
+//-----------------------------------------------------------------------------
+/// Size-class pool allocator.
+//-----------------------------------------------------------------------------
+    // pool_allocate and pool_free are a thread safe allocator pair that
+    // caches freed blocks by size class (four classes per power of two)
+    // and hands them back to later allocations of the same class. This
+    // removes malloc/free churn when trees with the same shape are rebuilt.
+    // Like the default allocator, the pool returns zeroed memory.
+    //
+    // Register them as an allocator, and select it for a Node:
+    //   node.set_allocator(utils::pool_allocator_id());
+    void CONDUIT_API * pool_allocate(size_t num_items,
+                                     size_t item_size);
+    void CONDUIT_API   pool_free(void *data_ptr);
+
+    // id of the pool allocator pair (registered on first call)
+    index_t CONDUIT_API pool_allocator_id();
+
+    // frees all cached blocks
+    void CONDUIT_API   pool_trim();
+    // number of bytes held in cached blocks
+    size_t CONDUIT_API pool_cached_bytes();
+    // limit for the bytes held in cached blocks (default: 1 GB), blocks
+    // freed beyond this limit are returned to the system
+    size_t CONDUIT_API pool_max_cached_bytes();
+    void CONDUIT_API   set_pool_max_cached_bytes(size_t max_bytes);
+
 
 
 //-----------------------------------------------------------------------------
@@ -501,6 +529,10 @@ namespace utils
 
 //-----------------------------------------------------------------------------
 /// Base64 Encoding of Buffers
+///
+/// Large buffers are split into chunks that are encoded / decoded in
+/// parallel (with OpenMP, or with conduit::execution::task threads).
+/// base64_decode skips chars outside of the base64 alphabet.
 //-----------------------------------------------------------------------------
     void CONDUIT_API base64_encode(const void *src,
                                    index_t src_nbytes,
@@ -593,6 +625,39 @@ namespace utils
 //-----------------------------------------------------------------------------
     std::string CONDUIT_API float64_to_string(float64 value);
 
+//-----------------------------------------------------------------------------
+// Fast number formatting for json and yaml output. Appends the text for
+// `value` to `buffer`. Floating point values use the shortest form that
+// round trips and always include a '.' or an exponent. Inf and nan are
+// quoted.
+//-----------------------------------------------------------------------------
+    void CONDUIT_API append_json_number(std::string &buffer, int64 value);
+    void CONDUIT_API append_json_number(std::string &buffer, uint64 value);
+    void CONDUIT_API append_json_number(std::string &buffer, float32 value);
+    void CONDUIT_API append_json_number(std::string &buffer, float64 value);
+
+    /// dispatches other native types (char, long long, etc) to the
+    /// overloads above
+    template <typename T>
+    inline void append_json_number(std::string &buffer, T value)
+    {
+        if(std::is_floating_point<T>::value)
+        {
+            if(sizeof(T) == sizeof(float32))
+                append_json_number(buffer, (float32)value);
+            else
+                append_json_number(buffer, (float64)value);
+        }
+        else if(std::is_signed<T>::value)
+        {
+            append_json_number(buffer, (int64)value);
+        }
+        else
+        {
+            append_json_number(buffer, (uint64)value);
+        }
+    }
+
 //-----------------------------------------------------------------------------
      void CONDUIT_API indent(std::ostream &os,
                              index_t indent,
@@ -318,6 +318,11 @@ save(const Node &node,
      const std::string &protocol_,
      const Node &options)
 {
+    if(instrumentation::enabled())
+    {
+        instrumentation::record_io_write((size_t)node.total_bytes_compact());
+    }
+
     // we expect options to unused if all 3rd party i/o options are disabled
     // avoid warning using CONDUIT_UNUSED macro.
     CONDUIT_UNUSED(options);
@@ -438,6 +443,11 @@ save_merged(const Node &node,
             const std::string &protocol_,
             const Node &options)
 {
+    if(instrumentation::enabled())
+    {
+        instrumentation::record_io_write((size_t)node.total_bytes_compact());
+    }
+
     // we expect options to unused if all 3rd party i/o options are disabled
     // avoid warning using CONDUIT_UNUSED macro.
     CONDUIT_UNUSED(options);
@@ -587,16 +597,41 @@ load(const std::string &path,
                                         std::string(":"),
                                         file_path,
                                         sub_path);
+        // conduit_bin files can be memory mapped instead of read
+        bool use_mmap = protocol == "conduit_bin" &&
+                        options.has_child("mmap") &&
+                        options["mmap"].as_string() == "true";
+        Node mmap_opts;
+        if(use_mmap && options.has_child("mmap_advice"))
+        {
+            mmap_opts["advice"] = options["mmap_advice"].as_string();
+        }
+
         // We read the root if no sub path is given.
         // (most common case)
         if(sub_path.size() == 0)
         {
-            node.load(path,protocol);
+            if(use_mmap)
+            {
+                node.load_mmap(path,mmap_opts);
+            }
+            else
+            {
+                node.load(path,protocol);
+            }
         }
         else
         {
             Node n_load;
-            n_load.load(file_path,protocol);
+            if(use_mmap)
+            {
+                // only the pages of the sub path are read
+                n_load.load_mmap(file_path,mmap_opts);
+            }
+            else
+            {
+                n_load.load(file_path,protocol);
+            }
             node.set(n_load[sub_path]);
         }
     }
@@ -678,6 +713,11 @@ load(const std::string &path,
         CONDUIT_ERROR("unknown conduit_relay protocol: " << protocol);
 
     }
+
+    if(instrumentation::enabled())
+    {
+        instrumentation::record_io_read((size_t)node.total_bytes_compact());
+    }
 }
 
 //---------------------------------------------------------------------------//
@@ -729,6 +769,10 @@ load_merged(const std::string &path,
             const Node &options,
             Node &node)
 {
+    // merged reads are counted by how much they grow the node
+    index_t bytes_before = instrumentation::enabled() ?
+                           node.total_bytes_compact() : 0;
+
     std::string protocol = protocol_;
     // allow empty protocol to be used for auto detect
     if(protocol.empty())
@@ -812,6 +856,13 @@ load_merged(const std::string &path,
 
     }
 
+    if(instrumentation::enabled())
+    {
+        index_t bytes_after = node.total_bytes_compact();
+        instrumentation::record_io_read(bytes_after > bytes_before ?
+                                        (size_t)(bytes_after - bytes_before) :
+                                        0);
+    }
 }
 
 //---------------------------------------------------------------------------//
@@ -123,6 +123,11 @@ void CONDUIT_RELAY_API add_step(const Node &node,
 ///
 /// ``load`` works like a 'set', the node is reset and then populated
 ///
+/// For conduit_bin files, the option ``mmap: "true"`` memory maps the
+/// file read-only (see Node::load_mmap) instead of reading all of its
+/// data. ``mmap_advice`` passes an access pattern hint ("normal",
+/// "sequential", "random", or "willneed").
+///
 
 //-----------------------------------------------------------------------------
 void CONDUIT_RELAY_API load(const std::string &path,
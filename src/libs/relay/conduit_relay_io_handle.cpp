@@ -27,6 +27,14 @@
 //-----------------------------------------------------------------------------
 // standard lib includes
 //-----------------------------------------------------------------------------
+#include <algorithm>
+#include <condition_variable>
+#include <cstring>
+#include <deque>
+#include <fstream>
+#include <mutex>
+#include <sstream>
+#include <thread>
 
 //-----------------------------------------------------------------------------
 // -- begin conduit:: --
@@ -98,11 +106,30 @@ public:
 
     bool has_path(const std::string &path);
 
+    void read_schema(Schema &schema);
+    void read_schema(const std::string &path,
+                     Schema &schema);
+
     void close();
 
 private:
+    // loads the file into m_node on first use
+    void load();
+
+    // sub-range reads from a conduit_bin file that isn't loaded,
+    // these only read the selected elements
+    void read_slab_from_file(const std::string &path,
+                             const Node &opts,
+                             Node &node);
+    void read_slab_from_file(std::ifstream &ifs,
+                             const Schema &schema,
+                             const std::string &ref_path,
+                             const Node &opts,
+                             Node &dest);
+
     Node m_node;
     bool m_open;
+    bool m_loaded;
 
 };
 
@@ -149,9 +176,20 @@ public:
 
     bool has_path(const std::string &path);
 
+    void read_schema(Schema &schema);
+    void read_schema(const std::string &path,
+                     Schema &schema);
+
     void close();
 
 private:
+    // sub-range reads with a 'shape' option, these read each run of
+    // the hyperslab from the (flat) datasets
+    void read_shaped_slab(const Schema &schema,
+                          const std::string &path,
+                          const Node &opts,
+                          Node &dest);
+
     hid_t m_h5_id;
 
 };
@@ -160,6 +198,94 @@ private:
 //-----------------------------------------------------------------------------
 
 
+//-----------------------------------------------------------------------------
+// AsyncHandle -- wraps another handle and writes copies of nodes on a
+//                background thread
+//-----------------------------------------------------------------------------
+class AsyncHandle: public IOHandle::HandleInterface
+{
+public:
+    // takes ownership of handle
+    AsyncHandle(IOHandle::HandleInterface *handle,
+                const std::string &path,
+                const std::string &protocol,
+                const Node &options);
+    virtual ~AsyncHandle();
+
+    void open();
+
+    bool is_open() const;
+
+    // main interface methods
+    void read(Node &node);
+    void read(Node &node, const Node &opts);
+    void read(const std::string &path,
+              Node &node);
+    void read(const std::string &path,
+              Node &node,
+              const Node &opts);
+
+    void write(const Node &node);
+    void write(const Node &node, const Node &opts);
+    void write(const Node &node,
+               const std::string &path);
+    void write(const Node &node,
+               const std::string &path,
+               const Node &opts);
+
+    void remove(const std::string &path);
+
+    void list_child_names(std::vector<std::string> &res);
+    void list_child_names(const std::string &path,
+                          std::vector<std::string> &res);
+
+    bool has_path(const std::string &path);
+
+    void read_schema(Schema &schema);
+    void read_schema(const std::string &path,
+                     Schema &schema);
+
+    void flush();
+
+    void close();
+
+    // checks for the async option
+    static bool requested(const Node &options);
+
+private:
+    struct Job
+    {
+        Node        *node;
+        bool         use_path;
+        std::string  path;
+        Node         opts;
+    };
+
+    void enqueue(const Node &node,
+                 bool use_path,
+                 const std::string &path,
+                 const Node &opts);
+    void run();
+    // waits for pending writes, returns error message (if any)
+    std::string wait();
+    void        stop();
+
+    IOHandle::HandleInterface *m_handle;
+
+    bool                       m_copy_on_write;
+    size_t                     m_max_pending;
+
+    std::thread                m_thread;
+    std::mutex                 m_mutex;
+    std::condition_variable    m_cond;
+    std::deque<Job>            m_jobs;
+    // true while the thread is writing the front job
+    bool                       m_busy;
+    bool                       m_stop;
+    std::string                m_error;
+};
+
+
 //-----------------------------------------------------------------------------
 // HandleInterface Implementation
 //-----------------------------------------------------------------------------
@@ -277,6 +403,304 @@ IOHandle::HandleInterface::open()
 }
 
 
+//-----------------------------------------------------------------------------
+void
+IOHandle::HandleInterface::flush()
+{
+    // empty
+}
+
+//-----------------------------------------------------------------------------
+// fetches the values of a per dim sub-range read option
+//-----------------------------------------------------------------------------
+static void
+slab_option_values(const Node &opts,
+                   const std::string &name,
+                   const std::string &alt_name,
+                   index_t rank,
+                   index_t default_value,
+                   const std::string &ref_path,
+                   std::vector<index_t> &res)
+{
+    res.assign(rank, default_value);
+
+    const Node *opt = NULL;
+    if(opts.has_child(name))
+    {
+        opt = &opts.fetch_existing(name);
+    }
+    else if(opts.has_child(alt_name))
+    {
+        opt = &opts.fetch_existing(alt_name);
+    }
+
+    if(opt == NULL)
+    {
+        return;
+    }
+
+    Node n_vals;
+    opt->to_index_t_array(n_vals);
+    index_t_array vals = n_vals.value();
+
+    if(vals.number_of_elements() != rank)
+    {
+        CONDUIT_ERROR("Invalid sub-range read of \"" << ref_path << "\": "
+                      << "option '" << opt->name() << "' has "
+                      << vals.number_of_elements() << " values, "
+                      << "expected " << rank << " (one per dim)");
+    }
+
+    for(index_t d=0; d < rank; d++)
+    {
+        res[d] = vals[d];
+    }
+}
+
+//-----------------------------------------------------------------------------
+bool
+IOHandle::HandleInterface::has_slab_options(const Node &opts)
+{
+    return opts.has_child("offset") || opts.has_child("offsets") ||
+           opts.has_child("stride") || opts.has_child("strides") ||
+           opts.has_child("size")   || opts.has_child("sizes")   ||
+           opts.has_child("shape");
+}
+
+//-----------------------------------------------------------------------------
+void
+IOHandle::HandleInterface::slab_runs(const Node &opts,
+                                     index_t num_elements,
+                                     const std::string &ref_path,
+                                     std::vector<index_t> &runs)
+{
+    runs.clear();
+
+    std::vector<index_t> shape;
+    if(opts.has_child("shape"))
+    {
+        Node n_shape;
+        opts["shape"].to_index_t_array(n_shape);
+        index_t_array shape_vals = n_shape.value();
+        index_t shape_total = 1;
+        for(index_t d=0; d < shape_vals.number_of_elements(); d++)
+        {
+            shape.push_back(shape_vals[d]);
+            shape_total *= shape_vals[d];
+        }
+
+        if(shape.empty() || shape_total != num_elements)
+        {
+            CONDUIT_ERROR("Invalid sub-range read of \"" << ref_path << "\": "
+                          << "'shape' " << n_shape.to_string("json")
+                          << " does not match the number of elements ("
+                          << num_elements << ")");
+        }
+    }
+    else
+    {
+        shape.push_back(num_elements);
+    }
+
+    // nothing to select from empty arrays
+    if(num_elements == 0)
+    {
+        return;
+    }
+
+    index_t rank = (index_t)shape.size();
+
+    std::vector<index_t> offsets;
+    std::vector<index_t> strides;
+    std::vector<index_t> sizes;
+    slab_option_values(opts,"offset","offsets",rank,0,ref_path,offsets);
+    slab_option_values(opts,"stride","strides",rank,1,ref_path,strides);
+    slab_option_values(opts,"size","sizes",rank,0,ref_path,sizes);
+
+    for(index_t d=0; d < rank; d++)
+    {
+        if(strides[d] < 1)
+        {
+            CONDUIT_ERROR("Invalid sub-range read of \"" << ref_path << "\": "
+                          << "'stride' must be greater than zero.");
+        }
+
+        if(offsets[d] < 0 || offsets[d] >= shape[d])
+        {
+            CONDUIT_ERROR("Invalid sub-range read of \"" << ref_path << "\": "
+                          << "'offset' (" << offsets[d] << ") is outside "
+                          << "of dim " << d << " (" << shape[d] << ")");
+        }
+
+        if(sizes[d] < 0)
+        {
+            CONDUIT_ERROR("Invalid sub-range read of \"" << ref_path << "\": "
+                          << "'size' must not be negative.");
+        }
+
+        // a size of zero selects all remaining elements
+        if(sizes[d] == 0)
+        {
+            sizes[d] = (shape[d] - offsets[d] + strides[d] - 1) / strides[d];
+        }
+        else if(offsets[d] + (sizes[d] - 1) * strides[d] >= shape[d])
+        {
+            CONDUIT_ERROR("Invalid sub-range read of \"" << ref_path << "\": "
+                          << "'size' (" << sizes[d] << ") with 'offset' ("
+                          << offsets[d] << ") and 'stride' ("
+                          << strides[d] << ") selects past the end of "
+                          << "dim " << d << " (" << shape[d] << ")");
+        }
+    }
+
+    // element steps of each dim (row major)
+    std::vector<index_t> steps(rank, 1);
+    for(index_t d = rank - 2; d >= 0; d--)
+    {
+        steps[d] = steps[d+1] * shape[d+1];
+    }
+
+    // merge inner dims into a single run while the selected elements
+    // continue with the same stride (ex: whole z-slabs of a 3d array)
+    index_t run_dim    = rank - 1;
+    index_t run_count  = sizes[run_dim];
+    index_t run_stride = strides[run_dim] * steps[run_dim];
+
+    while(run_dim > 0)
+    {
+        index_t outer_step = strides[run_dim-1] * steps[run_dim-1];
+        if(run_count == 1)
+        {
+            run_stride = outer_step;
+        }
+
+        if(run_stride * run_count != outer_step)
+        {
+            break;
+        }
+
+        run_dim--;
+        run_count *= sizes[run_dim];
+    }
+
+    index_t base = 0;
+    for(index_t d=0; d < rank; d++)
+    {
+        base += offsets[d] * steps[d];
+    }
+
+    // visit the remaining outer dims in row major order
+    std::vector<index_t> idx(run_dim, 0);
+    while(true)
+    {
+        index_t start = base;
+        for(index_t d=0; d < run_dim; d++)
+        {
+            start += idx[d] * strides[d] * steps[d];
+        }
+
+        runs.push_back(start);
+        runs.push_back(run_count);
+        runs.push_back(run_stride);
+
+        index_t d = run_dim - 1;
+        while(d >= 0)
+        {
+            idx[d]++;
+            if(idx[d] < sizes[d])
+            {
+                break;
+            }
+            idx[d] = 0;
+            d--;
+        }
+
+        if(d < 0)
+        {
+            break;
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+void
+IOHandle::HandleInterface::read_slab(const Node &src,
+                                     const Node &opts,
+                                     Node &dest)
+{
+    const DataType &src_dt = src.dtype();
+
+    if(src_dt.is_object())
+    {
+        dest.set(DataType::object());
+        NodeConstIterator itr = src.children();
+        while(itr.has_next())
+        {
+            const Node &chld = itr.next();
+            read_slab(chld, opts, dest.add_child(itr.name()));
+        }
+    }
+    else if(src_dt.is_list())
+    {
+        dest.set(DataType::list());
+        NodeConstIterator itr = src.children();
+        while(itr.has_next())
+        {
+            const Node &chld = itr.next();
+            read_slab(chld, opts, dest.append());
+        }
+    }
+    else if(src_dt.is_empty())
+    {
+        dest.reset();
+    }
+    else
+    {
+        std::vector<index_t> runs;
+        slab_runs(opts, src_dt.number_of_elements(), src.path(), runs);
+
+        index_t total = 0;
+        for(size_t i=0; i < runs.size(); i+=3)
+        {
+            total += runs[i+1];
+        }
+
+        index_t ele_bytes = src_dt.element_bytes();
+        dest.set(DataType(src_dt.id(),
+                          total,
+                          0,
+                          ele_bytes,
+                          ele_bytes,
+                          src_dt.endianness()));
+
+        uint8 *dest_ptr = (uint8*)dest.data_ptr();
+        for(size_t i=0; i < runs.size(); i+=3)
+        {
+            index_t start  = runs[i];
+            index_t count  = runs[i+1];
+            index_t stride = runs[i+2];
+
+            if(stride == 1 && src_dt.stride() == ele_bytes)
+            {
+                utils::conduit_memcpy(dest_ptr,
+                                      src.element_ptr(start),
+                                      (size_t)(count * ele_bytes));
+                dest_ptr += count * ele_bytes;
+            }
+            else
+            {
+                for(index_t j=0; j < count; j++)
+                {
+                    utils::conduit_memcpy(dest_ptr,
+                                          src.element_ptr(start + j * stride),
+                                          (size_t)ele_bytes);
+                    dest_ptr += ele_bytes;
+                }
+            }
+        }
+    }
+}
+
 //-----------------------------------------------------------------------------
 IOHandle::HandleInterface *
 IOHandle::HandleInterface::create(const std::string &path)
@@ -347,6 +771,12 @@ IOHandle::HandleInterface::create(const std::string &path,
         CONDUIT_ERROR("Relay I/O Handle does not support the protocol: "
                       << protocol);
     }
+
+    if(AsyncHandle::requested(options))
+    {
+        res = new AsyncHandle(res, path, protocol, options);
+    }
+
     return res;
 }
 
@@ -387,7 +817,8 @@ BasicHandle::BasicHandle(const std::string &path,
                          const Node &options)
 : HandleInterface(path,protocol,options),
   m_node(),
-  m_open(false)
+  m_open(false),
+  m_loaded(false)
 {
     // empty
 }
@@ -412,15 +843,15 @@ BasicHandle::open()
         // read if handle is not 'write' only and we aren't truncating
         if( open_mode_read() && !open_mode_truncate() )
         {
-            // read from file
-            io::load(path(),
-                     protocol(),
-                     options(),
-                     m_node);
+            // the file is read on first use (see load()), so opening
+            // a handle just to call read_schema doesn't read the data
+            m_node.reset();
+            m_loaded = false;
         }
         else
         {
             m_node.reset();
+            m_loaded = true;
         }
     }
     else if( open_mode_read_only() ) // fail on read only if file doesn't exist
@@ -439,11 +870,26 @@ BasicHandle::open()
                  path(),
                  protocol(),
                  options());
+        m_loaded = true;
     }
 
     m_open = true;
 }
 
+//-----------------------------------------------------------------------------
+void
+BasicHandle::load()
+{
+    if(!m_loaded)
+    {
+        io::load(path(),
+                 protocol(),
+                 options(),
+                 m_node);
+        m_loaded = true;
+    }
+}
+
 //-----------------------------------------------------------------------------
 bool
 BasicHandle::is_open() const
@@ -463,9 +909,15 @@ BasicHandle::read(Node &node)
 void
 BasicHandle::read(Node &node, const Node& opts)
 {
-    CONDUIT_UNUSED(opts);
     // note: wrong mode errors are handled before dispatch to interface
 
+    if(has_slab_options(opts))
+    {
+        read("", node, opts);
+        return;
+    }
+
+    load();
     node.update(m_node);
 }
 
@@ -484,15 +936,193 @@ BasicHandle::read(const std::string &path,
                   Node &node,
                   const Node &opts)
 {
-    CONDUIT_UNUSED(opts);
     // note: wrong mode errors are handled before dispatch to interface
 
+    if(has_slab_options(opts))
+    {
+        bool use_mmap = options().has_child("mmap") &&
+                        options()["mmap"].as_string() == "true";
+
+        if(!m_loaded && protocol() == "conduit_bin" && !use_mmap)
+        {
+            read_slab_from_file(path, opts, node);
+        }
+        else
+        {
+            // (with mmap, only the pages of the selected elements are read)
+            load();
+            if(path.empty() || m_node.has_path(path))
+            {
+                Node n_slab;
+                read_slab(path.empty() ? m_node : m_node[path],
+                          opts,
+                          n_slab);
+                node.update(n_slab);
+            }
+        }
+        return;
+    }
+
+    load();
     if(m_node.has_path(path))
     {
         node.update(m_node[path]);
     }
 }
 
+//-----------------------------------------------------------------------------
+void
+BasicHandle::read_slab_from_file(const std::string &path,
+                                 const Node &opts,
+                                 Node &node)
+{
+    // the schema file describes where each leaf is in the data file
+    Schema s_file;
+    s_file.load(this->path() + "_json");
+
+    const Schema *s_read = &s_file;
+    if(!path.empty())
+    {
+        if(!s_file.has_path(path))
+        {
+            return;
+        }
+        s_read = &s_file.fetch_existing(path);
+    }
+
+    std::ifstream ifs;
+    ifs.open(this->path().c_str(), std::ios_base::binary);
+    if(!ifs.is_open())
+    {
+        CONDUIT_ERROR("IOHandle: failed to open: " << this->path());
+    }
+
+    Node n_slab;
+    read_slab_from_file(ifs, *s_read, path, opts, n_slab);
+    ifs.close();
+
+    if(instrumentation::enabled())
+    {
+        instrumentation::record_io_read((size_t)n_slab.total_bytes_compact());
+    }
+
+    node.update(n_slab);
+}
+
+//-----------------------------------------------------------------------------
+void
+BasicHandle::read_slab_from_file(std::ifstream &ifs,
+                                 const Schema &schema,
+                                 const std::string &ref_path,
+                                 const Node &opts,
+                                 Node &dest)
+{
+    const DataType &dt = schema.dtype();
+
+    if(dt.is_object())
+    {
+        dest.set(DataType::object());
+        for(index_t i=0; i < schema.number_of_children(); i++)
+        {
+            std::string chld_name = schema.child_name(i);
+            read_slab_from_file(ifs,
+                                schema.child(i),
+                                utils::join_path(ref_path, chld_name),
+                                opts,
+                                dest.add_child(chld_name));
+        }
+    }
+    else if(dt.is_list())
+    {
+        dest.set(DataType::list());
+        for(index_t i=0; i < schema.number_of_children(); i++)
+        {
+            std::ostringstream oss;
+            oss << i;
+            read_slab_from_file(ifs,
+                                schema.child(i),
+                                utils::join_path(ref_path, oss.str()),
+                                opts,
+                                dest.append());
+        }
+    }
+    else if(dt.is_empty())
+    {
+        dest.reset();
+    }
+    else
+    {
+        std::vector<index_t> runs;
+        slab_runs(opts, dt.number_of_elements(), ref_path, runs);
+
+        index_t total = 0;
+        for(size_t i=0; i < runs.size(); i+=3)
+        {
+            total += runs[i+1];
+        }
+
+        index_t ele_bytes = dt.element_bytes();
+        dest.set(DataType(dt.id(),
+                          total,
+                          0,
+                          ele_bytes,
+                          ele_bytes,
+                          dt.endianness()));
+
+        // strided runs are read in spans of at most this many bytes
+        const index_t max_span_bytes = 1 << 20;
+
+        char *dest_ptr = (char*)dest.data_ptr();
+        std::vector<char> span_buffer;
+
+        for(size_t i=0; i < runs.size(); i+=3)
+        {
+            index_t start  = runs[i];
+            index_t count  = runs[i+1];
+            // bytes between selected elements in the file
+            index_t step   = runs[i+2] * dt.stride();
+            std::streamoff pos = (std::streamoff)(dt.offset() +
+                                                  start * dt.stride());
+
+            if(step == ele_bytes)
+            {
+                ifs.seekg(pos);
+                ifs.read(dest_ptr, (std::streamsize)(count * ele_bytes));
+                dest_ptr += count * ele_bytes;
+                continue;
+            }
+
+            index_t span_count = max_span_bytes / step;
+            if(span_count < 1)
+            {
+                span_count = 1;
+            }
+
+            for(index_t j=0; j < count; j += span_count)
+            {
+                index_t n = std::min(span_count, count - j);
+                index_t span_bytes = (n - 1) * step + ele_bytes;
+                span_buffer.resize((size_t)span_bytes);
+
+                ifs.seekg(pos + (std::streamoff)(j * step));
+                ifs.read(span_buffer.data(), (std::streamsize)span_bytes);
+
+                for(index_t k=0; k < n; k++)
+                {
+                    memcpy(dest_ptr, &span_buffer[k * step], ele_bytes);
+                    dest_ptr += ele_bytes;
+                }
+            }
+        }
+
+        if(!ifs)
+        {
+            CONDUIT_ERROR("IOHandle: failed to read \"" << ref_path << "\""
+                          << " from: " << path());
+        }
+    }
+}
+
 //-----------------------------------------------------------------------------
 void
 BasicHandle::write(const Node &node)
@@ -509,6 +1139,7 @@ BasicHandle::write(const Node &node,
     CONDUIT_UNUSED(opts);
     // note: wrong mode errors are handled before dispatch to interface
 
+    load();
     m_node.update(node);
 }
 
@@ -531,6 +1162,7 @@ BasicHandle::write(const Node &node,
     CONDUIT_UNUSED(opts);
     // note: wrong mode errors are handled before dispatch to interface
 
+    load();
     m_node[path].update(node);
 }
 
@@ -540,6 +1172,7 @@ BasicHandle::list_child_names(std::vector<std::string> &res)
 {
     // note: wrong mode errors are handled before dispatch to interface
 
+    load();
     res = m_node.child_names();
 }
 
@@ -550,6 +1183,7 @@ BasicHandle::list_child_names(const std::string &path,
 {
     // note: wrong mode errors are handled before dispatch to interface
 
+    load();
     res.clear();
     if(m_node.has_path(path))
         res = m_node[path].child_names();
@@ -561,6 +1195,7 @@ BasicHandle::remove(const std::string &path)
 {
     // note: wrong mode errors are handled before dispatch to interface
 
+    load();
     m_node.remove(path);
 }
 
@@ -570,9 +1205,56 @@ BasicHandle::has_path(const std::string &path)
 {
     // note: wrong mode errors are handled before dispatch to interface
 
+    load();
     return m_node.has_path(path);
 }
 
+//-----------------------------------------------------------------------------
+void
+BasicHandle::read_schema(Schema &schema)
+{
+    read_schema("", schema);
+}
+
+//-----------------------------------------------------------------------------
+void
+BasicHandle::read_schema(const std::string &path,
+                         Schema &schema)
+{
+    // note: wrong mode errors are handled before dispatch to interface
+
+    schema.reset();
+
+    if(!m_loaded && protocol() == "conduit_bin")
+    {
+        // conduit_bin keeps its schema in a separate json file,
+        // we can read it without touching the data
+        Schema s_file;
+        s_file.load(this->path() + "_json");
+        if(path.empty())
+        {
+            schema.set(s_file);
+        }
+        else if(s_file.has_path(path))
+        {
+            schema.set(s_file.fetch_existing(path));
+        }
+    }
+    else
+    {
+        // json and yaml have to be parsed to find extents
+        load();
+        if(path.empty())
+        {
+            schema.set(m_node.schema());
+        }
+        else if(m_node.has_path(path))
+        {
+            schema.set(m_node[path].schema());
+        }
+    }
+}
+
 //-----------------------------------------------------------------------------
 void
 BasicHandle::close()
@@ -580,11 +1262,16 @@ BasicHandle::close()
     if(m_open && !open_mode_read_only() )
     {
         // here is where it actually gets realized on disk
-        io::save(m_node,
-                 path(),
-                 protocol(),
-                 options());
+        // (if the file was never loaded, there are no changes to save)
+        if(m_loaded)
+        {
+            io::save(m_node,
+                     path(),
+                     protocol(),
+                     options());
+        }
         m_node.reset();
+        m_loaded = false;
         m_open = false;
     }
 }
@@ -675,7 +1362,14 @@ HDF5Handle::read(Node &node,
 {
     // note: wrong mode errors are handled before dispatch to interface
 
-    hdf5_read(m_h5_id,opts,node);
+    if(opts.has_child("shape"))
+    {
+        read("",node,opts);
+    }
+    else
+    {
+        hdf5_read(m_h5_id,opts,node);
+    }
 }
 
 //-----------------------------------------------------------------------------
@@ -695,7 +1389,114 @@ HDF5Handle::read(const std::string &path,
 {
     // note: wrong mode errors are handled before dispatch to interface
 
-    hdf5_read(m_h5_id,path,opts,node);
+    if(opts.has_child("shape"))
+    {
+        Schema s_read;
+        if(path.empty())
+        {
+            hdf5_read_schema(m_h5_id,s_read);
+        }
+        else
+        {
+            hdf5_read_schema(m_h5_id,path,s_read);
+        }
+
+        Node n_slab;
+        read_shaped_slab(s_read, path, opts, n_slab);
+        node.update(n_slab);
+    }
+    else
+    {
+        // hdf5_read supports offset, stride and size directly
+        hdf5_read(m_h5_id,path,opts,node);
+    }
+}
+
+//-----------------------------------------------------------------------------
+void
+HDF5Handle::read_shaped_slab(const Schema &schema,
+                             const std::string &path,
+                             const Node &opts,
+                             Node &dest)
+{
+    const DataType &dt = schema.dtype();
+
+    if(dt.is_object() || dt.is_list())
+    {
+        if(dt.is_object())
+        {
+            dest.set(DataType::object());
+        }
+        else
+        {
+            dest.set(DataType::list());
+        }
+
+        for(index_t i=0; i < schema.number_of_children(); i++)
+        {
+            // list entries are stored using their index as name
+            std::string chld_name;
+            if(dt.is_object())
+            {
+                chld_name = schema.child_name(i);
+            }
+            else
+            {
+                std::ostringstream oss;
+                oss << i;
+                chld_name = oss.str();
+            }
+
+            Node &chld = dt.is_object() ? dest.add_child(chld_name)
+                                        : dest.append();
+
+            read_shaped_slab(schema.child(i),
+                             utils::join_path(path, chld_name),
+                             opts,
+                             chld);
+        }
+    }
+    else if(dt.is_empty())
+    {
+        dest.reset();
+    }
+    else
+    {
+        std::vector<index_t> runs;
+        slab_runs(opts, dt.number_of_elements(), path, runs);
+
+        index_t total = 0;
+        for(size_t i=0; i < runs.size(); i+=3)
+        {
+            total += runs[i+1];
+        }
+
+        index_t ele_bytes = dt.element_bytes();
+        dest.set(DataType(dt.id(),
+                          total,
+                          0,
+                          ele_bytes,
+                          ele_bytes,
+                          dt.endianness()));
+
+        uint8 *dest_ptr = (uint8*)dest.data_ptr();
+
+        Node run_opts;
+        Node n_run;
+        for(size_t i=0; i < runs.size(); i+=3)
+        {
+            run_opts["offset"] = runs[i];
+            run_opts["size"]   = runs[i+1];
+            run_opts["stride"] = runs[i+2];
+
+            n_run.reset();
+            hdf5_read(m_h5_id, path, run_opts, n_run);
+
+            index_t run_bytes = runs[i+1] * ele_bytes;
+            utils::conduit_memcpy(dest_ptr, n_run.data_ptr(), (size_t)run_bytes);
+            dest_ptr += run_bytes;
+        }
+    }
 }
 
 //-----------------------------------------------------------------------------
@@ -803,6 +1604,25 @@ HDF5Handle::has_path(const std::string &path)
     return hdf5_has_path(m_h5_id,path);
 }
 
+//-----------------------------------------------------------------------------
+void
+HDF5Handle::read_schema(Schema &schema)
+{
+    // note: wrong mode errors are handled before dispatch to interface
+
+    hdf5_read_schema(m_h5_id,schema);
+}
+
+//-----------------------------------------------------------------------------
+void
+HDF5Handle::read_schema(const std::string &path,
+                        Schema &schema)
+{
+    // note: wrong mode errors are handled before dispatch to interface
+
+    hdf5_read_schema(m_h5_id,path,schema);
+}
+
 
 //-----------------------------------------------------------------------------
 void
@@ -822,6 +1642,366 @@ HDF5Handle::close()
 //-----------------------------------------------------------------------------
 
 
+//-----------------------------------------------------------------------------
+// AsyncHandle Implementation
+//-----------------------------------------------------------------------------
+AsyncHandle::AsyncHandle(IOHandle::HandleInterface *handle,
+                         const std::string &path,
+                         const std::string &protocol,
+                         const Node &options)
+: HandleInterface(path,protocol,options),
+  m_handle(handle),
+  m_copy_on_write(false),
+  m_max_pending(4),
+  m_busy(false),
+  m_stop(false)
+{
+    if(options.has_child("async_snapshot"))
+    {
+        std::string snapshot = options["async_snapshot"].as_string();
+        if(snapshot == "copy_on_write")
+        {
+            m_copy_on_write = true;
+        }
+        else if(snapshot != "compact")
+        {
+            delete m_handle;
+            m_handle = NULL;
+            CONDUIT_ERROR("IOHandle: invalid async_snapshot option: "
+                          << "\"" << snapshot << "\"."
+                          << " Expected \"compact\" or \"copy_on_write\"");
+        }
+    }
+
+    if(options.has_child("async_max_pending"))
+    {
+        index_t max_pending = options["async_max_pending"].to_index_t();
+        m_max_pending = max_pending > 0 ? (size_t)max_pending : 1;
+    }
+}
+
+//-----------------------------------------------------------------------------
+AsyncHandle::~AsyncHandle()
+{
+    // errors can't be raised here, they are lost if close wasn't called
+    stop();
+    delete m_handle;
+}
+
+//-----------------------------------------------------------------------------
+bool
+AsyncHandle::requested(const Node &options)
+{
+    if(!options.has_child("async"))
+    {
+        return false;
+    }
+
+    const Node &opt = options["async"];
+    if(opt.dtype().is_string())
+    {
+        return opt.as_string() == "true";
+    }
+    return opt.dtype().is_number() && opt.to_int() != 0;
+}
+
+//-----------------------------------------------------------------------------
+void
+AsyncHandle::open()
+{
+    close();
+    // call base class method, which does final sanity checks
+    HandleInterface::open();
+
+    m_handle->open();
+
+    m_stop  = false;
+    m_error = "";
+    m_thread = std::thread(&AsyncHandle::run, this);
+}
+
+//-----------------------------------------------------------------------------
+bool
+AsyncHandle::is_open() const
+{
+    return m_handle->is_open();
+}
+
+//-----------------------------------------------------------------------------
+void
+AsyncHandle::read(Node &node)
+{
+    Node opts;
+    read(node, opts);
+}
+
+//-----------------------------------------------------------------------------
+void
+AsyncHandle::read(Node &node,
+                  const Node &opts)
+{
+    flush();
+    m_handle->read(node, opts);
+}
+
+//-----------------------------------------------------------------------------
+void
+AsyncHandle::read(const std::string &path,
+                  Node &node)
+{
+    Node opts;
+    read(path, node, opts);
+}
+
+//-----------------------------------------------------------------------------
+void
+AsyncHandle::read(const std::string &path,
+                  Node &node,
+                  const Node &opts)
+{
+    flush();
+    m_handle->read(path, node, opts);
+}
+
+//-----------------------------------------------------------------------------
+void
+AsyncHandle::write(const Node &node)
+{
+    Node opts;
+    write(node, opts);
+}
+
+//-----------------------------------------------------------------------------
+void
+AsyncHandle::write(const Node &node,
+                   const Node &opts)
+{
+    enqueue(node, false, std::string(), opts);
+}
+
+//-----------------------------------------------------------------------------
+void
+AsyncHandle::write(const Node &node,
+                   const std::string &path)
+{
+    Node opts;
+    write(node, path, opts);
+}
+
+//-----------------------------------------------------------------------------
+void
+AsyncHandle::write(const Node &node,
+                   const std::string &path,
+                   const Node &opts)
+{
+    enqueue(node, true, path, opts);
+}
+
+//-----------------------------------------------------------------------------
+void
+AsyncHandle::remove(const std::string &path)
+{
+    flush();
+    m_handle->remove(path);
+}
+
+//-----------------------------------------------------------------------------
+void
+AsyncHandle::list_child_names(std::vector<std::string> &res)
+{
+    flush();
+    m_handle->list_child_names(res);
+}
+
+//-----------------------------------------------------------------------------
+void
+AsyncHandle::list_child_names(const std::string &path,
+                              std::vector<std::string> &res)
+{
+    flush();
+    m_handle->list_child_names(path, res);
+}
+
+//-----------------------------------------------------------------------------
+bool
+AsyncHandle::has_path(const std::string &path)
+{
+    flush();
+    return m_handle->has_path(path);
+}
+
+//-----------------------------------------------------------------------------
+void
+AsyncHandle::read_schema(Schema &schema)
+{
+    flush();
+    m_handle->read_schema(schema);
+}
+
+//-----------------------------------------------------------------------------
+void
+AsyncHandle::read_schema(const std::string &path,
+                         Schema &schema)
+{
+    flush();
+    m_handle->read_schema(path, schema);
+}
+
+//-----------------------------------------------------------------------------
+void
+AsyncHandle::flush()
+{
+    std::string error = wait();
+    if(!error.empty())
+    {
+        CONDUIT_ERROR("IOHandle: async write failed: " << error);
+    }
+}
+
+//-----------------------------------------------------------------------------
+void
+AsyncHandle::close()
+{
+    std::string error = wait();
+    stop();
+    m_handle->close();
+
+    if(!error.empty())
+    {
+        CONDUIT_ERROR("IOHandle: async write failed: " << error);
+    }
+}
+
+//-----------------------------------------------------------------------------
+void
+AsyncHandle::enqueue(const Node &node,
+                     bool use_path,
+                     const std::string &path,
+                     const Node &opts)
+{
+    Job job;
+    job.node     = new Node();
+    job.use_path = use_path;
+    job.path     = path;
+    job.opts.set(opts);
+
+    if(m_copy_on_write)
+    {
+        job.node->enable_copy_on_write();
+        job.node->set(node);
+    }
+    else
+    {
+        job.node->set_allocator(utils::pool_allocator_id());
+        node.compact_to(*job.node);
+    }
+
+    std::unique_lock<std::mutex> lock(m_mutex);
+    // block while the queue is full
+    m_cond.wait(lock, [this]{ return m_jobs.size() < m_max_pending ||
+                                     !m_error.empty(); });
+    if(!m_error.empty())
+    {
+        std::string error = m_error;
+        m_error = "";
+        lock.unlock();
+        delete job.node;
+        CONDUIT_ERROR("IOHandle: async write failed: " << error);
+    }
+    m_jobs.push_back(job);
+    lock.unlock();
+    m_cond.notify_all();
+}
+
+//-----------------------------------------------------------------------------
+void
+AsyncHandle::run()
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    while(true)
+    {
+        m_cond.wait(lock, [this]{ return m_stop || !m_jobs.empty(); });
+        if(m_jobs.empty())
+        {
+            // stopped and drained
+            return;
+        }
+
+        Job job = m_jobs.front();
+        m_busy = true;
+        lock.unlock();
+
+        std::string error;
+        try
+        {
+            if(!job.use_path)
+            {
+                m_handle->write(*job.node, job.opts);
+            }
+            else
+            {
+                m_handle->write(*job.node, job.path, job.opts);
+            }
+        }
+        catch(const conduit::Error &e)
+        {
+            error = e.message();
+        }
+        catch(const std::exception &e)
+        {
+            error = e.what();
+        }
+        delete job.node;
+
+        lock.lock();
+        m_jobs.pop_front();
+        m_busy = false;
+        if(!error.empty())
+        {
+            // keep the first error, drop the remaining writes
+            if(m_error.empty())
+            {
+                m_error = error;
+            }
+            while(!m_jobs.empty())
+            {
+                delete m_jobs.front().node;
+                m_jobs.pop_front();
+            }
+        }
+        m_cond.notify_all();
+    }
+}
+
+//-----------------------------------------------------------------------------
+std::string
+AsyncHandle::wait()
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_cond.wait(lock, [this]{ return m_jobs.empty() && !m_busy; });
+    std::string res = m_error;
+    m_error = "";
+    return res;
+}
+
+//-----------------------------------------------------------------------------
+void
+AsyncHandle::stop()
+{
+    if(!m_thread.joinable())
+    {
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stop = true;
+    }
+    m_cond.notify_all();
+    m_thread.join();
+}
+
+
 //-----------------------------------------------------------------------------
 // IOHandle Implementation
 //-----------------------------------------------------------------------------
@@ -1121,6 +2301,55 @@ IOHandle::has_path(const std::string &path)
     return false;
 }
 
+//-----------------------------------------------------------------------------
+void
+IOHandle::read_schema(Schema &schema)
+{
+    read_schema("",schema);
+}
+
+//-----------------------------------------------------------------------------
+void
+IOHandle::read_schema(const std::string &path,
+                      Schema &schema)
+{
+    if(m_handle != NULL)
+    {
+        if( m_handle->open_mode_write_only() )
+        {
+            CONDUIT_ERROR("IOHandle: cannot call read_schema, handle is"
+                          " write only"
+                          " (mode = '" << m_handle->open_mode() << "')");
+        }
+
+        Schema s_read;
+        if(path.empty())
+        {
+            m_handle->read_schema(s_read);
+        }
+        else
+        {
+            m_handle->read_schema(path, s_read);
+        }
+        // return the layout read() would produce
+        s_read.compact_to(schema);
+    }
+    else
+    {
+        CONDUIT_ERROR("Invalid or closed handle.");
+    }
+}
+
+//-----------------------------------------------------------------------------
+void
+IOHandle::flush()
+{
+    if(m_handle != NULL)
+    {
+        m_handle->flush();
+    }
+}
+
 //-----------------------------------------------------------------------------
 void
 IOHandle::close()
@@ -19,6 +19,42 @@
 ///
 /// Contract: Changes to backing (file on disk, etc) aren't guaranteed to
 //  be reflected until a call to close
+///
+/// Async writes: Opening with the option {"async": "true"} returns from
+///  write() right after the passed node is copied. A background thread
+///  writes the copies in order. Other methods (read, has_path, etc) wait
+///  for pending writes first. flush() waits for all pending writes.
+///  Errors from background writes are raised by the next flush(), write()
+///  or close() call.
+///
+///  Additional async options:
+///   async_snapshot: "compact" (default) copies the node into a compact
+///                   buffer from the pool allocator.
+///                   "copy_on_write" shares the node's owned leaf buffers,
+///                   which are copied if they are changed before the
+///                   write finishes (see Node::enable_copy_on_write).
+///   async_max_pending: max number of queued writes (default: 4),
+///                      write() blocks while the queue is full
+///
+///  Note: Background HDF5 writes call the HDF5 library from another
+///  thread. Don't use HDF5 from other threads while writes are pending
+///  unless HDF5 was built thread safe.
+///
+/// Sub-range reads: read() options select a sub-range of each leaf array
+///  that is read (for all protocols):
+///   offset (or offsets): index of the first element (default: 0)
+///   stride (or strides): step between elements (default: 1)
+///   size   (or sizes):   number of elements (default: all elements from
+///                        offset to the end, using stride)
+///   shape:               optional dims (slowest varying first) of
+///                        flat leaf arrays, with it offset, stride and
+///                        size give a multi-dimensional hyperslab
+///                        (one entry per dim)
+///
+///  The result is a compact array with the selected elements in row major
+///  order. Without shape, multi-dimensional HDF5 datasets use their own
+///  dims. conduit_bin handles read only the selected bytes of the file,
+///  HDF5 and Sidre handles only read the selected part of datasets.
 //-----------------------------------------------------------------------------
 class CONDUIT_RELAY_API IOHandle
 {
@@ -79,10 +115,15 @@ public:
     /// check if given path exists
     bool has_path(const std::string &path);
 
-    // FUTURE: also provide access to read schema
-    // void read_schema(Schema &schema);
-    // void read_schema(const std::string &path,
-    //                  Schema &schema);
+    /// read the schema (dtypes and extents) of the contents at the root
+    /// of the handle, without reading data
+    void read_schema(Schema &schema);
+    /// read the schema of the contents at given subpath
+    void read_schema(const std::string &path,
+                     Schema &schema);
+
+    /// wait for pending async writes, no-op for sync handles
+    void flush();
 
     /// close the handle
     void close();
@@ -124,6 +165,11 @@ public:
                               std::vector<std::string> &res) = 0;
         virtual void remove(const std::string &path) = 0;
         virtual bool has_path(const std::string &path) = 0;
+        virtual void read_schema(Schema &schema) = 0;
+        virtual void read_schema(const std::string &path,
+                                 Schema &schema) = 0;
+        // waits for buffered writes (default is a no-op)
+        virtual void flush();
         virtual void close() = 0;
 
         // access to common state
@@ -160,6 +206,23 @@ public:
                                        const std::string &protocol,
                                        const Node &options);
 
+    protected:
+        // helpers for sub-range reads (see read() options above)
+
+        // checks if options select a sub-range
+        static bool has_slab_options(const Node &opts);
+        // computes the runs of elements a sub-range selects from a
+        // leaf with the given number of elements, as flat
+        // (first element, count, stride) triples in read order
+        static void slab_runs(const Node &opts,
+                              index_t num_elements,
+                              const std::string &ref_path,
+                              std::vector<index_t> &runs);
+        // copies the sub-range of each leaf of src into dest
+        static void read_slab(const Node &src,
+                              const Node &opts,
+                              Node &dest);
+
     private:
         std::string m_path;
         std::string m_protocol;
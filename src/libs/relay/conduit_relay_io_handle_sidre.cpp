@@ -183,7 +183,6 @@ void
 SidreIOHandle::read(Node &node,
                     const Node &opts)
 {
-    CONDUIT_UNUSED(opts);
     // note: wrong mode errors are handled before dispatch to interface
 
     std::vector<std::string> child_names;
@@ -191,7 +190,7 @@ SidreIOHandle::read(Node &node,
 
     for(size_t i=0;i<child_names.size();i++)
     {
-        read(child_names[i],node[child_names[i]]);
+        read(child_names[i],node[child_names[i]],opts);
     }
 }
 
@@ -210,13 +209,12 @@ SidreIOHandle::read(const std::string &path,
                     Node &node,
                     const Node &opts)
 {
-    CONDUIT_UNUSED(opts);
     // note: wrong mode errors are handled before dispatch to interface
 
     // if blank path or "/", use other method and early exist.
     if(path.empty() || path == "/")
     {
-        read(node);
+        read(node,opts);
         return;
     }
 
@@ -232,7 +230,7 @@ SidreIOHandle::read(const std::string &path,
     {
         if(p_first == "root")
         {
-            read_from_root(p_next,node);
+            read_from_root(p_next,opts,node);
         }
         else
         {
@@ -260,6 +258,7 @@ SidreIOHandle::read(const std::string &path,
 
             read_from_sidre_tree(tree_id,
                                  p_next,
+                                 opts,
                                  node);
         }
     }
@@ -271,6 +270,7 @@ SidreIOHandle::read(const std::string &path,
                              "",
                              path,
                              m_sidre_meta[0],
+                             opts,
                              node);
     }
 }
@@ -468,6 +468,90 @@ SidreIOHandle::has_path(const std::string &path)
     return res;
 }
 
+//-----------------------------------------------------------------------------
+void
+SidreIOHandle::read_schema(Schema &schema)
+{
+    // note: wrong mode errors are handled before dispatch to interface
+
+    schema.set(DataType::object());
+
+    std::vector<std::string> child_names;
+    list_child_names(child_names);
+
+    for(size_t i=0;i<child_names.size();i++)
+    {
+        read_schema(child_names[i],schema.add_child(child_names[i]));
+    }
+}
+
+//-----------------------------------------------------------------------------
+void
+SidreIOHandle::read_schema(const std::string &path,
+                           Schema &schema)
+{
+    // note: wrong mode errors are handled before dispatch to interface
+
+    // if blank path or "/", use other method and early exist.
+    if(path.empty() || path == "/")
+    {
+        read_schema(schema);
+        return;
+    }
+
+    // same dispatch as read()
+    std::string p_first;
+    std::string p_next;
+    utils::split_path(path,p_first,p_next);
+
+    if(m_has_spio_index)
+    {
+        if(p_first == "root")
+        {
+            if(!p_next.empty())
+                m_root_handle.read_schema(p_next,schema);
+            else
+                m_root_handle.read_schema(schema);
+        }
+        else
+        {
+            if(!utils::string_is_integer(p_first))
+            {
+                CONDUIT_ERROR("Cannot read Sidre path: '"
+                              << p_first
+                              << "'"
+                              << std::endl
+                              << "Expected 'root' or an integer "
+                              << "tree id (ex: '0')");
+            }
+
+            int tree_id = utils::string_to_value<int>(p_first);
+
+            // make sure we have a valid tree_id
+            if(tree_id < 0 || tree_id >= m_num_trees)
+            {
+                CONDUIT_ERROR("Cannot read from invalid Sidre tree id: "
+                              << tree_id
+                              << std::endl
+                              << "Expected id in range [0,"
+                              << m_num_trees << ")");
+            }
+
+            read_from_sidre_tree(tree_id,
+                                 p_next,
+                                 schema);
+        }
+    }
+    else
+    {
+        read_from_sidre_tree(m_root_handle,
+                             "",
+                             path,
+                             m_sidre_meta[0],
+                             schema);
+    }
+}
+
 
 //-----------------------------------------------------------------------------
 void
@@ -831,6 +915,7 @@ SidreIOHandle::load_sidre_tree(Node &sidre_meta,
                                const std::string &tree_prefix,
                                const std::string &tree_path,
                                const std::string &curr_path,
+                               const Node &opts,
                                Node &out)
 {
     // CONDUIT_INFO("load_sidre_tree w/ meta "
@@ -854,6 +939,7 @@ SidreIOHandle::load_sidre_tree(Node &sidre_meta,
                              hnd,
                              tree_prefix,
                              "",
+                             opts,
                              out);
     }
     else if( sidre_meta["groups"].has_path(tree_curr) )
@@ -866,6 +952,7 @@ SidreIOHandle::load_sidre_tree(Node &sidre_meta,
                              hnd,
                              tree_prefix,
                              curr_path + tree_curr  + "/",
+                             opts,
                              out);
         }
         else // keep descending
@@ -875,6 +962,7 @@ SidreIOHandle::load_sidre_tree(Node &sidre_meta,
                             tree_prefix,
                             tree_next,
                             curr_path + tree_curr  + "/",
+                            opts,
                             out);
         }
     }
@@ -892,6 +980,7 @@ SidreIOHandle::load_sidre_tree(Node &sidre_meta,
                             hnd,
                             tree_prefix,
                             curr_path + tree_curr  + "/",
+                            opts,
                             out);
         }
     }
@@ -910,6 +999,7 @@ SidreIOHandle::load_sidre_group(Node &sidre_meta,
                                 IOHandle &hnd,
                                 const std::string &tree_prefix,
                                 const std::string &group_path,
+                                const Node &opts,
                                 Node &out)
 {
     // CONDUIT_INFO("load_sidre_group "
@@ -928,6 +1018,7 @@ SidreIOHandle::load_sidre_group(Node &sidre_meta,
                          hnd,
                          tree_prefix,
                          cld_path + "/",
+                         opts,
                          out[g_name]);
     }
 
@@ -942,6 +1033,7 @@ SidreIOHandle::load_sidre_group(Node &sidre_meta,
                         hnd,
                         tree_prefix,
                         cld_path,
+                        opts,
                         out[v_name]);
     }
 }
@@ -952,6 +1044,7 @@ SidreIOHandle::load_sidre_view(Node &sidre_meta_view,
                                IOHandle &hnd,
                                const std::string &tree_prefix,
                                const std::string &view_path,
+                               const Node &opts,
                                Node &out)
 {
     // CONDUIT_INFO("load_sidre_view " << view_path);
@@ -969,18 +1062,36 @@ SidreIOHandle::load_sidre_view(Node &sidre_meta_view,
     //     for this case we can follow the "tree_path" in the sidre external
     //     data tree, and fetch the hdf5 dataset that was written there.
     //
+    // sub-range options (offset, stride, size, shape) select part of
+    // each view's values, see HandleInterface::slab_runs
 
     std::string view_state = sidre_meta_view["state"].as_string();
 
+    bool slab = has_slab_options(opts);
+
     if( view_state == "STRING")
     {
         //BP_PLUGIN_INFO("loading " << view_path << " as sidre string view");
-        out.set(sidre_meta_view["value"]);
+        if(slab)
+        {
+            read_slab(sidre_meta_view["value"],opts,out);
+        }
+        else
+        {
+            out.set(sidre_meta_view["value"]);
+        }
     }
     else if(view_state == "SCALAR")
     {
         // BP_PLUGIN_INFO("loading " << view_path << " as sidre scalar view");
-        out.set(sidre_meta_view["value"]);
+        if(slab)
+        {
+            read_slab(sidre_meta_view["value"],opts,out);
+        }
+        else
+        {
+            out.set(sidre_meta_view["value"]);
+        }
     }
     else if( view_state == "BUFFER" )
     {
@@ -1014,6 +1125,18 @@ SidreIOHandle::load_sidre_view(Node &sidre_meta_view,
         Schema view_schema(view_schema_str);
         // BP_PLUGIN_INFO("sidre view schema: " << view_schema.to_json());
 
+        if(slab)
+        {
+            load_sidre_buffer_view_slab(hnd,
+                                        buffer_data_fetch_path,
+                                        buffer_schema,
+                                        view_schema,
+                                        view_path,
+                                        opts,
+                                        out);
+            return;
+        }
+
         // if the schema isn't compact, or if we are reading
         // less elements than the entire buffer,
         // we need to read a subset of the hdf5 dataset
@@ -1086,7 +1209,239 @@ SidreIOHandle::load_sidre_view(Node &sidre_meta_view,
         //                << " : "
         //                << fetch_path);
 
-        hnd.read(fetch_path,out);;
+        hnd.read(fetch_path,out,opts);
+    }
+    else
+    {
+        // error:  "unsupported sidre view state: " << view_state );
+    }
+}
+
+//----------------------------------------------------------------------------/
+void
+SidreIOHandle::load_sidre_buffer_view_slab(IOHandle &hnd,
+                                           const std::string &buffer_data_fetch_path,
+                                           const Schema &buffer_schema,
+                                           const Schema &view_schema,
+                                           const std::string &view_path,
+                                           const Node &opts,
+                                           Node &out)
+{
+    const DataType &buffer_dt = buffer_schema.dtype();
+    const DataType &view_dt   = view_schema.dtype();
+    index_t ele_bytes = view_dt.element_bytes();
+
+    // ---------------------------------------------------------------
+    // BUFFER-SLAB FETCH
+    // ---------------------------------------------------------------
+    //
+    // we can read just the selected elements of the buffer's dataset
+    // if the dtype.id() of the buffer and the view are the same and
+    // the view's offset and stride line up with the buffer's elements.
+    //
+    // otherwise, we will have to fetch the entire buffer since
+    // hdf5 doesn't support byte level striding.
+    if( buffer_dt.id() == view_dt.id() &&
+        buffer_dt.element_bytes() == ele_bytes &&
+        view_dt.offset() % ele_bytes == 0 &&
+        view_dt.stride() % ele_bytes == 0 )
+    {
+        index_t view_ele_offset = view_dt.offset() / ele_bytes;
+        index_t view_ele_stride = view_dt.stride() / ele_bytes;
+
+        std::vector<index_t> runs;
+        slab_runs(opts, view_dt.number_of_elements(), view_path, runs);
+
+        index_t total = 0;
+        for(size_t i=0; i < runs.size(); i+=3)
+        {
+            total += runs[i+1];
+        }
+
+        out.set(DataType(view_dt.id(),
+                         total,
+                         0,
+                         ele_bytes,
+                         ele_bytes,
+                         view_dt.endianness()));
+
+        uint8 *out_ptr = (uint8*)out.data_ptr();
+
+        // one read per run of the selection, in buffer elements
+        Node run_opts;
+        Node n_run;
+        for(size_t i=0; i < runs.size(); i+=3)
+        {
+            run_opts["offset"] = view_ele_offset + runs[i] * view_ele_stride;
+            run_opts["stride"] = runs[i+2] * view_ele_stride;
+            run_opts["size"]   = runs[i+1];
+            n_run.reset();
+            hnd.read(buffer_data_fetch_path, n_run, run_opts);
+
+            index_t run_bytes = runs[i+1] * ele_bytes;
+            if(n_run.dtype().number_of_elements() != runs[i+1] ||
+               !n_run.is_compact())
+            {
+                CONDUIT_ERROR("Sidre buffer slab fetch of " << view_path
+                              << " returned an unexpected result: "
+                              << n_run.schema().to_json());
+            }
+            utils::conduit_memcpy(out_ptr, n_run.data_ptr(), (size_t)run_bytes);
+            out_ptr += run_bytes;
+        }
+    }
+    else
+    {
+        // ---------------------------------------------------------------
+        // Fall back to Non BUFFER-SLAB FETCH
+        // ---------------------------------------------------------------
+        // this reads the entire buffer to get the proper subset
+        Node n_buff;
+        Node n_view;
+
+        hnd.read(buffer_data_fetch_path,n_buff);
+
+        // create our view on the buffer
+        n_view.set_external(view_schema,n_buff.data_ptr());
+        read_slab(n_view,opts,out);
+    }
+}
+
+//----------------------------------------------------------------------------/
+void
+SidreIOHandle::load_sidre_tree(Node &sidre_meta,
+                               IOHandle &hnd,
+                               const std::string &tree_prefix,
+                               const std::string &tree_path,
+                               const std::string &curr_path,
+                               Schema &out)
+{
+    // descend down to "tree_path" in sidre meta, like the Node variant
+
+    std::string tree_curr;
+    std::string tree_next;
+    conduit::utils::split_path(tree_path,tree_curr,tree_next);
+
+    // root case for a data tree
+    if( tree_curr.empty() )
+    {
+        load_sidre_group(sidre_meta,
+                         hnd,
+                         tree_prefix,
+                         "",
+                         out);
+    }
+    else if( sidre_meta["groups"].has_path(tree_curr) )
+    {
+        if(tree_next.size() == 0)
+        {
+            load_sidre_group(sidre_meta["groups"][tree_curr],
+                             hnd,
+                             tree_prefix,
+                             curr_path + tree_curr  + "/",
+                             out);
+        }
+        else // keep descending
+        {
+            load_sidre_tree(sidre_meta["groups"][tree_curr],
+                            hnd,
+                            tree_prefix,
+                            tree_next,
+                            curr_path + tree_curr  + "/",
+                            out);
+        }
+    }
+    else if( sidre_meta["views"].has_path(tree_curr) )
+    {
+        if(tree_next.size() != 0)
+        {
+            CONDUIT_ERROR("Sidre path extends beyond sidre view, "
+                          "however Sidre views are leaves.");
+        }
+        else
+        {
+            load_sidre_view(sidre_meta["views"][tree_curr],
+                            hnd,
+                            tree_prefix,
+                            curr_path + tree_curr  + "/",
+                            out);
+        }
+    }
+    else
+    {
+        CONDUIT_ERROR("sidre path " << curr_path
+                                    << "/"
+                                    << tree_curr
+                                    << " does not exist");
+    }
+}
+
+//----------------------------------------------------------------------------/
+void
+SidreIOHandle::load_sidre_group(Node &sidre_meta,
+                                IOHandle &hnd,
+                                const std::string &tree_prefix,
+                                const std::string &group_path,
+                                Schema &out)
+{
+    out.set(DataType::object());
+
+    NodeIterator g_itr = sidre_meta["groups"].children();
+    while(g_itr.has_next())
+    {
+        Node &g = g_itr.next();
+        std::string g_name = g_itr.name();
+        std::string cld_path = group_path + g_name;
+        load_sidre_group(g,
+                         hnd,
+                         tree_prefix,
+                         cld_path + "/",
+                         out.add_child(g_name));
+    }
+
+    NodeIterator v_itr = sidre_meta["views"].children();
+    while(v_itr.has_next())
+    {
+        Node &v = v_itr.next();
+        std::string v_name = v_itr.name();
+        std::string cld_path = group_path + v_name;
+        load_sidre_view(v,
+                        hnd,
+                        tree_prefix,
+                        cld_path,
+                        out.add_child(v_name));
+    }
+}
+
+//----------------------------------------------------------------------------/
+void
+SidreIOHandle::load_sidre_view(Node &sidre_meta_view,
+                               IOHandle &hnd,
+                               const std::string &tree_prefix,
+                               const std::string &view_path,
+                               Schema &out)
+{
+    // view schema cases:
+    //   scalar or string views: the schema of the "value" in the meta view
+    //   buffer views: the compact form of the view's schema, which is
+    //                 what load_sidre_view reads from the buffer
+    //   external views: the schema of the external data tree entry
+
+    std::string view_state = sidre_meta_view["state"].as_string();
+
+    if( view_state == "STRING" || view_state == "SCALAR" )
+    {
+        out.set(sidre_meta_view["value"].schema());
+    }
+    else if( view_state == "BUFFER" )
+    {
+        Schema view_schema(sidre_meta_view["schema"].as_string());
+        view_schema.compact_to(out);
+    }
+    else if( view_state == "EXTERNAL" )
+    {
+        std::string fetch_path = tree_prefix + "sidre/external/" + view_path;
+        hnd.read_schema(fetch_path,out);
     }
     else
     {
@@ -1096,13 +1451,15 @@ SidreIOHandle::load_sidre_view(Node &sidre_meta_view,
 
 //-----------------------------------------------------------------------------
 void
-SidreIOHandle::read_from_root(const std::string &path, Node &node)
+SidreIOHandle::read_from_root(const std::string &path,
+                              const Node &opts,
+                              Node &node)
 {
     // skip cache first
     if(!path.empty())
-        m_root_handle.read(path,node);
+        m_root_handle.read(path,node,opts);
     else
-        m_root_handle.read(node);
+        m_root_handle.read(node,opts);
 }
 
 //-----------------------------------------------------------------------------
@@ -1218,6 +1575,7 @@ SidreIOHandle::read_from_sidre_tree(IOHandle &hnd,
                                     const std::string &tree_prefix,
                                     const std::string &path,
                                     Node &sidre_meta,
+                                    const Node &opts,
                                     Node &out)
 {
     // if we don't already have it cached, this will fetch
@@ -1227,6 +1585,30 @@ SidreIOHandle::read_from_sidre_tree(IOHandle &hnd,
                             path,
                             sidre_meta);
 
+    load_sidre_tree(sidre_meta,
+                    hnd,
+                    tree_prefix,
+                    path,
+                    "", // current path starts at root
+                    opts,
+                    out);
+}
+
+//-----------------------------------------------------------------------------
+void
+SidreIOHandle::read_from_sidre_tree(IOHandle &hnd,
+                                    const std::string &tree_prefix,
+                                    const std::string &path,
+                                    Node &sidre_meta,
+                                    Schema &out)
+{
+    // if we don't already have it cached, this will fetch
+    // the proper sidre meta data
+    prepare_sidre_meta_tree(hnd,
+                            tree_prefix,
+                            path,
+                            sidre_meta);
+
     load_sidre_tree(sidre_meta,
                     hnd,
                     tree_prefix,
@@ -1239,6 +1621,7 @@ SidreIOHandle::read_from_sidre_tree(IOHandle &hnd,
 void
 SidreIOHandle::read_from_sidre_tree(int tree_id,
                                     const std::string &path,
+                                    const Node &opts,
                                     Node &out)
 {
     // if we don't already have it cached, this will fetch
@@ -1264,6 +1647,7 @@ SidreIOHandle::read_from_sidre_tree(int tree_id,
                         generate_tree_path(tree_id),
                         path,
                         "", // current path starts at root
+                        opts,
                         out);
     }
     else
@@ -1271,6 +1655,44 @@ SidreIOHandle::read_from_sidre_tree(int tree_id,
         // start a top level traversal
         // call load sidre variant that uses existing sidre meta tree
         Node &sidre_meta = m_sidre_meta[tree_id];
+        load_sidre_tree(sidre_meta,
+                        m_root_handle,
+                        generate_tree_path(tree_id),
+                        path,
+                        "", // current path starts at root
+                        opts,
+                        out);
+    }
+}
+
+
+//-----------------------------------------------------------------------------
+void
+SidreIOHandle::read_from_sidre_tree(int tree_id,
+                                    const std::string &path,
+                                    Schema &out)
+{
+    // if we don't already have it cached, this will fetch
+    // the proper sidre meta data
+    prepare_sidre_meta_tree(tree_id,path);
+
+    Node &sidre_meta = m_sidre_meta[tree_id];
+
+    if(m_has_spio_index)
+    {
+        // fetch the right file handle
+        prepare_file_handle(tree_id);
+        int file_id = generate_file_id_for_tree(tree_id);
+
+        load_sidre_tree(sidre_meta,
+                        m_file_handles[file_id],
+                        generate_tree_path(tree_id),
+                        path,
+                        "", // current path starts at root
+                        out);
+    }
+    else
+    {
         load_sidre_tree(sidre_meta,
                         m_root_handle,
                         generate_tree_path(tree_id),
@@ -49,6 +49,10 @@ public:
 
     bool has_path(const std::string &path);
 
+    void read_schema(Schema &schema);
+    void read_schema(const std::string &path,
+                     Schema &schema);
+
     void close();
 
 
@@ -76,28 +80,68 @@ private:
                                      const std::string &tree_prefix,
                                      const std::string &path,
                                      Node &sidre_meta,
+                                     const Node &opts,
                                      Node &node);
 
+    static void read_from_sidre_tree(IOHandle &hnd,
+                                     const std::string &tree_prefix,
+                                     const std::string &path,
+                                     Node &sidre_meta,
+                                     Schema &schema);
+
     // basic sidre read logic that works at the handle level
     static void load_sidre_tree(Node &sidre_meta,
                                 IOHandle &hnd,
                                 const std::string &tree_prefix,
                                 const std::string &tree_path,
                                 const std::string &curr_path,
+                                const Node &opts,
                                 Node &out);
 
     static void load_sidre_group(Node &sidre_meta,
                                  IOHandle &hnd,
                                  const std::string &tree_prefix,
                                  const std::string &group_path,
+                                 const Node &opts,
                                  Node &out);
 
     static void load_sidre_view(Node &sidre_meta_view,
                                 IOHandle &hnd,
                                 const std::string &tree_prefix,
                                 const std::string &view_path,
+                                const Node &opts,
                                 Node &out);
 
+    // sub-range read of a view attached to a buffer
+    static void load_sidre_buffer_view_slab(IOHandle &hnd,
+                                            const std::string &buffer_data_fetch_path,
+                                            const Schema &buffer_schema,
+                                            const Schema &view_schema,
+                                            const std::string &view_path,
+                                            const Node &opts,
+                                            Node &out);
+
+    // schema only variants of the sidre read logic, these read
+    // the sidre meta data, but not buffers or external data
+    static void load_sidre_tree(Node &sidre_meta,
+                                IOHandle &hnd,
+                                const std::string &tree_prefix,
+                                const std::string &tree_path,
+                                const std::string &curr_path,
+                                Schema &out);
+
+    static void load_sidre_group(Node &sidre_meta,
+                                 IOHandle &hnd,
+                                 const std::string &tree_prefix,
+                                 const std::string &group_path,
+                                 Schema &out);
+
+    static void load_sidre_view(Node &sidre_meta_view,
+                                IOHandle &hnd,
+                                const std::string &tree_prefix,
+                                const std::string &view_path,
+                                Schema &out);
+
     bool sidre_meta_tree_has_path(const Node &sidre_meta,
                                   const std::string &path);
 
@@ -106,12 +150,18 @@ private:
                                           std::vector<std::string> &res);
 
     void read_from_root(const std::string &path,
+                        const Node &opts,
                         Node &node);
 
     void read_from_sidre_tree(int tree_id,
                               const std::string &path,
+                              const Node &opts,
                               Node &node);
 
+    void read_from_sidre_tree(int tree_id,
+                              const std::string &path,
+                              Schema &schema);
+
     void prepare_file_handle(int tree_id);
     void prepare_sidre_meta_tree(int tree_id,
                                  const std::string &path);
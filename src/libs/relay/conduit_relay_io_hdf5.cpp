@@ -14,6 +14,7 @@
     #include "conduit_relay_io_hdf5.hpp"
 #endif
 
+#include "conduit_blueprint_ndarray_index.hpp"
 #include "conduit_fmt/conduit_fmt.h"
 
 //-----------------------------------------------------------------------------
@@ -30,13 +31,29 @@
 //-----------------------------------------------------------------------------
 // standard lib includes
 //-----------------------------------------------------------------------------
+#include <algorithm>
+#include <cstring>
+#include <exception>
 #include <iostream>
+#include <map>
+#include <vector>
 
 //-----------------------------------------------------------------------------
 // external lib includes
 //-----------------------------------------------------------------------------
 #include <hdf5.h>
 
+//-----------------------------------------------------------------------------
+// direct chunk writes (for parallel compression) need zlib and
+// H5Dwrite_chunk (hdf5 1.10.3 or newer)
+//-----------------------------------------------------------------------------
+#if defined(CONDUIT_RELAY_IO_HDF5_ZLIB_ENABLED) && \
+    H5_VERSION_GE(1,10,3) && !defined(H5_HAVE_PARALLEL)
+    #define CONDUIT_RELAY_IO_HDF5_DIRECT_CHUNK_WRITE
+    #include <zlib.h>
+    #include "conduit_execution_task.hpp"
+#endif
+
 //-----------------------------------------------------------------------------
 /// macro used to check if an HDF5 object id is valid
 //-----------------------------------------------------------------------------
@@ -156,12 +173,21 @@ public:
     static int  chunk_threshold;
     static int  chunk_size;
 
+    // per path chunk dims and leaf shapes (slowest varying dim first),
+    // paths are matched against the end of each leaf's path
+    static std::map<std::string, std::vector<index_t> > chunk_dims;
+    static std::map<std::string, std::vector<index_t> > chunk_shapes;
+    // find shapes of blueprint structured mesh fields and coordsets
+    static bool chunk_blueprint_shapes;
+
     static bool compact_storage_enabled;
     static int  compact_storage_threshold;
 
     static std::string compression_method;
     // gzip options (gzip level)
     static int         compression_level;
+    // compress gzip chunks on conduit's task pool
+    static bool        compression_parallel;
 
 //-----------------------------------------------------------------------------
 // zfp options
@@ -245,6 +271,24 @@ public:
                 chunk_size = chunking["chunk_size"].to_value();
             }
 
+            if(chunking.has_child("chunk_dims"))
+            {
+                chunk_dims.clear();
+                set_path_dims(chunking["chunk_dims"],"",chunk_dims);
+            }
+
+            if(chunking.has_child("shapes"))
+            {
+                chunk_shapes.clear();
+                set_path_dims(chunking["shapes"],"",chunk_shapes);
+            }
+
+            if(chunking.has_child("blueprint_shapes"))
+            {
+                std::string bp_shapes = chunking["blueprint_shapes"].as_string();
+                chunk_blueprint_shapes = (bp_shapes != "false");
+            }
+
             if(chunking.has_child("compression"))
             {
                 const Node &comp = chunking["compression"];
@@ -259,6 +303,12 @@ public:
                     compression_level = comp["level"].to_value();
                 }
 
+                if(comp.has_child("parallel"))
+                {
+                    std::string parallel = comp["parallel"].as_string();
+                    compression_parallel = (parallel == "true");
+                }
+
 //-----------------------------------------------------------------------------
 // zfp options
 //-----------------------------------------------------------------------------
@@ -382,11 +432,32 @@ public:
         opts["chunking/threshold"] = chunk_threshold;
         opts["chunking/chunk_size"] = chunk_size;
 
+        about_path_dims(chunk_dims,opts["chunking/chunk_dims"]);
+        about_path_dims(chunk_shapes,opts["chunking/shapes"]);
+
+        if(chunk_blueprint_shapes)
+        {
+            opts["chunking/blueprint_shapes"] = "true";
+        }
+        else
+        {
+            opts["chunking/blueprint_shapes"] = "false";
+        }
+
         opts["chunking/compression/method"] = compression_method;
         if(compression_method == "gzip")
         {
             opts["chunking/compression/level"] = compression_level;
         }
+
+        if(compression_parallel)
+        {
+            opts["chunking/compression/parallel"] = "true";
+        }
+        else
+        {
+            opts["chunking/compression/parallel"] = "false";
+        }
 //-----------------------------------------------------------------------------
 // zfp options
 //-----------------------------------------------------------------------------
@@ -426,6 +497,65 @@ public:
 #endif // zfp options
 //-----------------------------------------------------------------------------
     }
+
+private:
+    // flattens a tree of numeric arrays into path -> dims
+    static void set_path_dims(const Node &node,
+                              const std::string &path,
+                              std::map<std::string, std::vector<index_t> > &res)
+    {
+        if(node.dtype().is_object())
+        {
+            NodeConstIterator itr = node.children();
+            while(itr.has_next())
+            {
+                const Node &child = itr.next();
+                std::string child_path = itr.name();
+                if(!path.empty())
+                {
+                    child_path = path + "/" + child_path;
+                }
+                set_path_dims(child,child_path,res);
+            }
+        }
+        else if(node.dtype().is_number() && !path.empty())
+        {
+            Node n_dims;
+            node.to_index_t_array(n_dims);
+            index_t_array dims_vals = n_dims.value();
+            std::vector<index_t> dims;
+            for(index_t i=0; i < dims_vals.number_of_elements(); i++)
+            {
+                if(dims_vals[i] < 1)
+                {
+                    CONDUIT_ERROR("HDF5 chunking option \"" << path << "\""
+                                  " has invalid dims: " << n_dims.to_string()
+                                  << " (dims must be positive)");
+                }
+                dims.push_back(dims_vals[i]);
+            }
+            res[path] = dims;
+        }
+        else if(!node.dtype().is_empty())
+        {
+            CONDUIT_ERROR("HDF5 chunking option \"" << path << "\""
+                          " must be a tree of paths to numeric arrays of dims");
+        }
+    }
+
+    static void about_path_dims(const std::map<std::string, std::vector<index_t> > &dims,
+                                Node &opts)
+    {
+        // always an object, so restoring saved options clears any entries
+        opts.set(DataType::object());
+        std::map<std::string, std::vector<index_t> >::const_iterator itr;
+        for(itr = dims.begin(); itr != dims.end(); ++itr)
+        {
+            // use the path as a single child name, so it round trips
+            // through set_path_dims
+            opts.add_child(itr->first).set(itr->second);
+        }
+    }
 };
 
 // default hdf5 i/o settings
@@ -441,11 +571,13 @@ bool        HDF5Options::chunking_enabled   = true;
 int         HDF5Options::chunk_size         = 1000000; // 1 mb
 int         HDF5Options::chunk_threshold    = 2000000; // 2 mb
 
-// TODO: ndarray chunk heuristics
-
+std::map<std::string, std::vector<index_t> > HDF5Options::chunk_dims;
+std::map<std::string, std::vector<index_t> > HDF5Options::chunk_shapes;
+bool        HDF5Options::chunk_blueprint_shapes = true;
 
 std::string HDF5Options::compression_method = "gzip";
 int         HDF5Options::compression_level  = 5;
+bool        HDF5Options::compression_parallel = false;
 
 //-----------------------------------------------------------------------------
 // zfp options
@@ -604,7 +736,7 @@ bool check_if_hdf5_group_has_conduit_list_attribute(hid_t hdf5_group_id);
 //-----------------------------------------------------------------------------
 
 //-----------------------------------------------------------------------------
-hid_t create_hdf5_dataset_for_conduit_leaf(const DataType &dt,
+hid_t create_hdf5_dataset_for_conduit_leaf(const Node &leaf,
                                            const std::string &ref_path,
                                            hid_t hdf5_group_id,
                                            const std::string &hdf5_dset_name,
@@ -624,6 +756,17 @@ void  write_conduit_leaf_to_hdf5_dataset(const Node &node,
                                          hid_t &hdf5_dset_id,
                                          const Node &opts);
 
+//-----------------------------------------------------------------------------
+// Compresses the chunks of a gzip chunked dataset on conduit's task pool
+// and writes them with direct chunk writes. Returns false (without writing)
+// if the dataset's layout, filters or type don't allow this.
+//-----------------------------------------------------------------------------
+bool  write_hdf5_dataset_chunks_in_parallel(const void *data_ptr,
+                                            hsize_t num_eles,
+                                            hid_t h5_dtype_id,
+                                            const std::string &ref_path,
+                                            hid_t hdf5_dset_id);
+
 //-----------------------------------------------------------------------------
 void  write_conduit_leaf_to_hdf5_group(const Node &node,
                                        const std::string &ref_path,
@@ -670,6 +813,20 @@ void read_hdf5_tree_into_conduit_node(hid_t hdf5_id,
                                       const Node &opts,
                                       Node &dest);
 
+//-----------------------------------------------------------------------------
+// helpers for reading schemas (dtypes and extents, without data)
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+void read_hdf5_dataset_into_conduit_schema(hid_t hdf5_dset_id,
+                                           const std::string &ref_path,
+                                           Schema &dest);
+
+//-----------------------------------------------------------------------------
+void read_hdf5_tree_into_conduit_schema(hid_t hdf5_id,
+                                        const std::string &ref_path,
+                                        Schema &dest);
+
 
 
 //-----------------------------------------------------------------------------
@@ -1522,185 +1679,661 @@ create_hdf5_compact_plist_for_conduit_leaf()
 
 
 //---------------------------------------------------------------------------//
-hid_t
-create_hdf5_chunked_plist_for_conduit_leaf(const DataType &dtype)
+// helpers for chunk shape heuristics
+//
+// relay datasets are always 1D, so chunk shapes are expressed as the number
+// of elements in a chunk. When we know the logical shape of a leaf (listed
+// slowest varying dim first), we pick chunk lengths that hold whole rows
+// (or planes) of the fastest varying axis.
+//---------------------------------------------------------------------------//
+
+//---------------------------------------------------------------------------//
+// checks if path matches the end of leaf_path (on a path boundary)
+//---------------------------------------------------------------------------//
+bool
+hdf5_chunk_path_matches(const std::string &leaf_path,
+                        const std::string &path)
 {
-    hid_t h5_cprops_id = H5Pcreate(H5P_DATASET_CREATE);
+    if(path.empty() || path.size() > leaf_path.size())
+    {
+        return false;
+    }
 
-    // TODO: add ndarray heuristics
+    size_t start = leaf_path.size() - path.size();
 
-    // Turn on chunking
+    if(leaf_path.compare(start, path.size(), path) != 0)
+    {
+        return false;
+    }
 
-    // hdf5 sets chunking in elements, not bytes,
-    // our options are in bytes, so convert to # of elems
-    hsize_t h5_chunk_size =  (hsize_t) (HDF5Options::chunk_size / dtype.element_bytes());
+    return start == 0 || leaf_path[start-1] == '/';
+}
 
-    H5Pset_chunk(h5_cprops_id, 1, &h5_chunk_size);
+//---------------------------------------------------------------------------//
+// finds the option entry whose path matches the leaf or, for mcarray
+// components, the leaf's parent. The longest matching path wins.
+//---------------------------------------------------------------------------//
+bool
+hdf5_chunk_path_dims_for_conduit_leaf(const Node &leaf,
+                                      const std::map<std::string, std::vector<index_t> > &path_dims,
+                                      std::vector<index_t> &dims)
+{
+    if(path_dims.empty())
+    {
+        return false;
+    }
 
-    if(HDF5Options::compression_method == "gzip" )
+    std::string leaf_path = leaf.path();
+    std::string parent_path;
+    if(leaf.parent() != NULL)
     {
-        // Turn on compression
-        H5Pset_shuffle(h5_cprops_id);
-        H5Pset_deflate(h5_cprops_id, HDF5Options::compression_level);
+        parent_path = leaf.parent()->path();
     }
-//-----------------------------------------------------------------------------
-// zfp options
-//-----------------------------------------------------------------------------
-#if defined(CONDUIT_RELAY_IO_H5ZZFP_ENABLED)
-    // else if(false)//HDF5Options::compression_method == "zfp" )
-    else if(HDF5Options::compression_method == "zfp" )
+
+    size_t match_size = 0;
+    std::map<std::string, std::vector<index_t> >::const_iterator itr;
+    for(itr = path_dims.begin(); itr != path_dims.end(); ++itr)
     {
-        // TODO: call once?
-        H5Z_zfp_initialize();
-        // Setup the filter using properties interface.
-        if (HDF5Options::zfp_mode == H5Z_ZFP_MODE_RATE)
-        {
-            H5Pset_zfp_rate(h5_cprops_id, HDF5Options::zfp_rate);
-        }
-        else if (HDF5Options::zfp_mode == H5Z_ZFP_MODE_PRECISION)
-        {
-            H5Pset_zfp_precision(h5_cprops_id, HDF5Options::zfp_prec);
-        }
-        else if (HDF5Options::zfp_mode == H5Z_ZFP_MODE_ACCURACY)
-        {
-            H5Pset_zfp_accuracy(h5_cprops_id, HDF5Options::zfp_acc);
-        }
-        else if (HDF5Options::zfp_mode == H5Z_ZFP_MODE_EXPERT)
-        {
-            H5Pset_zfp_expert(h5_cprops_id,
-                              HDF5Options::zfp_minbits,
-                              HDF5Options::zfp_maxbits,
-                              HDF5Options::zfp_maxprec,
-                              HDF5Options::zfp_minexp);
-        }
-        else if (HDF5Options::zfp_mode == H5Z_ZFP_MODE_REVERSIBLE)
+        const std::string &path = itr->first;
+        if(path.size() > match_size &&
+           ( hdf5_chunk_path_matches(leaf_path,path) ||
+             hdf5_chunk_path_matches(parent_path,path) ) )
         {
-            H5Pset_zfp_reversible(h5_cprops_id);
+            dims = itr->second;
+            match_size = path.size();
         }
     }
-//-----------------------------------------------------------------------------
-#endif // zfp options
-//-----------------------------------------------------------------------------
 
-    return h5_cprops_id;
+    return match_size > 0;
 }
 
-
 //---------------------------------------------------------------------------//
-hid_t
-create_hdf5_dataset_for_conduit_leaf(const DataType &dtype,
-                                     const std::string &ref_path,
-                                     hid_t hdf5_group_id,
-                                     const std::string &hdf5_dset_name,
-                                     bool extendible)
+// reads blueprint style {i,j,k} dims into a vector, fastest varying first
+//---------------------------------------------------------------------------//
+bool
+hdf5_chunk_read_ijk(const Node &node,
+                    std::vector<index_t> &res)
 {
-    hid_t res = -1;
-
-    hid_t h5_dtype = conduit_dtype_to_hdf5_dtype(dtype,ref_path);
+    res.clear();
+    const std::string axes[3] = {"i","j","k"};
+    for(index_t a=0; a < 3 && node.has_child(axes[a]); a++)
+    {
+        const Node &n_axis = node[axes[a]];
+        if(!n_axis.dtype().is_number())
+        {
+            return false;
+        }
+        res.push_back(n_axis.to_index_t());
+    }
+    return !res.empty();
+}
 
-    hsize_t num_eles = (hsize_t) dtype.number_of_elements();
+//---------------------------------------------------------------------------//
+// reads a blueprint offsets or strides integer array into a vector,
+// fastest varying (i) first. the array must have one entry per dim.
+//---------------------------------------------------------------------------//
+bool
+hdf5_chunk_read_index_array(const Node &node,
+                            index_t ndims,
+                            std::vector<index_t> &res)
+{
+    res.clear();
+    if(!node.dtype().is_integer() ||
+       node.dtype().number_of_elements() != ndims)
+    {
+        return false;
+    }
 
-    hid_t h5_cprops_id = H5P_DEFAULT;
+    Node n_vals;
+    node.to_index_t_array(n_vals);
+    index_t_array vals = n_vals.value();
+    for(index_t d=0; d < ndims; d++)
+    {
+        res.push_back(vals[d]);
+    }
+    return true;
+}
 
-    bool unlimited_dim = false;
+//---------------------------------------------------------------------------//
+// uses a blueprint NDIndex to find the full (padded) dims of a strided
+// structured array with num_eles elements, listed slowest varying first.
+//---------------------------------------------------------------------------//
+bool
+hdf5_chunk_strided_dims(const std::vector<index_t> &shape,
+                        const Node *offsets,
+                        const Node *strides,
+                        index_t num_eles,
+                        std::vector<index_t> &dims)
+{
+    index_t ndims = (index_t)shape.size();
 
-    if (extendible && !HDF5Options::chunking_enabled)
+    Node n_idx;
+    n_idx["shape"].set(shape);
+    if(offsets != NULL)
     {
-        CONDUIT_ERROR("Chunking must be enabled to create an extendible array.");
+        std::vector<index_t> offs;
+        if(!hdf5_chunk_read_index_array(*offsets,ndims,offs))
+        {
+            return false;
+        }
+        n_idx["offset"].set(offs);
+    }
+    if(strides != NULL)
+    {
+        std::vector<index_t> strs;
+        if(!hdf5_chunk_read_index_array(*strides,ndims,strs))
+        {
+            return false;
+        }
+        n_idx["stride"].set(strs);
     }
 
-    // TODO: add ndarray heuristics
+    blueprint::ndarray::NDIndex idx(&n_idx);
 
-    // if an offset is supplied, we will default to creating an extendible array
-    if( !extendible && HDF5Options::compact_storage_enabled &&
-        dtype.bytes_compact() <= HDF5Options::compact_storage_threshold)
+    if(idx.stride(0) != 1)
     {
-        h5_cprops_id = create_hdf5_compact_plist_for_conduit_leaf();
+        return false;
     }
-    else if( extendible || (HDF5Options::chunking_enabled &&
-             dtype.bytes_compact() > HDF5Options::chunk_threshold))
+
+    // the extent of each dim follows from the stride of the next
+    std::vector<index_t> full(ndims);
+    for(index_t d=0; d < ndims; d++)
     {
-        h5_cprops_id = create_hdf5_chunked_plist_for_conduit_leaf(dtype);
-        unlimited_dim = true;
-    }
+        index_t next_stride = num_eles;
+        if(d + 1 < ndims)
+        {
+            next_stride = idx.stride(d+1);
+        }
 
-    CONDUIT_CHECK_HDF5_ERROR_WITH_FILE_AND_REF_PATH(h5_cprops_id,
-                                                    hdf5_group_id,
-                                                    ref_path,
+        if(idx.stride(d) < 1 || next_stride % idx.stride(d) != 0)
+        {
+            return false;
+        }
 
-                                         "Failed to create HDF5 property list");
-    hid_t h5_dspace_id = -1;
+        full[d] = next_stride / idx.stride(d);
 
-    // string a scalar with size embedded in type is disabled
-    // b/c this path undermines compression
-    // if(dtype.is_string())
-    // {
-    //     h5_dspace_id = H5Screate(H5S_SCALAR);
-    // }
-    // else
-    // {
-    //     h5_dspace_id = H5Screate_simple(1,
-    //                                     &num_eles,
-    //                                     NULL);
-    // }
+        if(full[d] < idx.offset(d) + idx.shape(d))
+        {
+            return false;
+        }
+    }
 
-    if (unlimited_dim)
+    dims.assign(full.rbegin(),full.rend());
+    return true;
+}
+
+//---------------------------------------------------------------------------//
+// finds the logical shape (slowest varying first) of a blueprint
+// structured mesh field or coordset values leaf, using the mesh tree
+// the leaf belongs to.
+//---------------------------------------------------------------------------//
+bool
+hdf5_chunk_blueprint_shape(const Node &leaf,
+                           std::vector<index_t> &dims)
+{
+    // values may be an array or an mcarray
+    const Node *values = NULL;
+    if(leaf.name() == "values")
     {
-        hsize_t unlimited_dims[1] = {H5S_UNLIMITED};
-        h5_dspace_id = H5Screate_simple(1,
-                                        &num_eles,
-                                        unlimited_dims);
+        values = &leaf;
     }
-    else
+    else if(leaf.parent() != NULL && leaf.parent()->name() == "values")
     {
-        // TODO: add ndarray heuristics
-        h5_dspace_id = H5Screate_simple(1,
-                                        &num_eles,
-                                        NULL);
+        values = leaf.parent();
     }
 
+    if(values == NULL ||
+       values->parent() == NULL ||
+       values->parent()->parent() == NULL ||
+       values->parent()->parent()->parent() == NULL)
+    {
+        return false;
+    }
 
-    CONDUIT_CHECK_HDF5_ERROR_WITH_FILE_AND_REF_PATH(h5_dspace_id,
-                                                    hdf5_group_id,
-                                                    ref_path,
-                                           "Failed to create HDF5 Dataspace");
-
-    // create new dataset
-    res = H5Dcreate(hdf5_group_id,
-                    hdf5_dset_name.c_str(),
-                    h5_dtype,
-                    h5_dspace_id,
-                    H5P_DEFAULT,
-                    h5_cprops_id,
-                    H5P_DEFAULT);
-
-    CONDUIT_CHECK_HDF5_ERROR_WITH_FILE_AND_REF_PATH(res,
-                                                    hdf5_group_id,
-                                                    ref_path,
-                                           "Failed to create HDF5 Dataset "
-                                           << hdf5_group_id << " "
-                                           << hdf5_dset_name);
-
-    // cleanup if custom data type was used
-    conduit_dtype_to_hdf5_dtype_cleanup(h5_dtype);
+    const Node &owner  = *values->parent();
+    const Node &owners = *owner.parent();
+    const Node &domain = *owners.parent();
 
-    // close plist used for compression
-    if(h5_cprops_id != H5P_DEFAULT)
+    if(!domain.has_child("topologies") || !domain.has_child("coordsets"))
     {
-        CONDUIT_CHECK_HDF5_ERROR_WITH_FILE_AND_REF_PATH(H5Pclose(h5_cprops_id),
-                                                        hdf5_group_id,
-                                                        ref_path,
-                                           "Failed to close HDF5 compression "
-                                           "property list "
-                                                       << h5_cprops_id);
+        return false;
     }
 
-    // close our dataspace
-    CONDUIT_CHECK_HDF5_ERROR_WITH_FILE_AND_REF_PATH(H5Sclose(h5_dspace_id),
-                                                    hdf5_group_id,
-                                                    ref_path,
-                                           "Failed to close HDF5 Dataspace "
-                                           << h5_dspace_id);
+    const Node &topos = domain["topologies"];
+    const Node &csets = domain["coordsets"];
+
+    std::vector<index_t> shape;
+    const Node *offsets = NULL;
+    const Node *strides = NULL;
+
+    if(owners.name() == "fields")
+    {
+        if(!owner.has_child("topology")    ||
+           !owner.has_child("association") ||
+           !owner["topology"].dtype().is_string() ||
+           !owner["association"].dtype().is_string())
+        {
+            return false;
+        }
+
+        std::string topo_name = owner["topology"].as_string();
+        std::string assoc     = owner["association"].as_string();
+
+        if(!topos.has_child(topo_name))
+        {
+            return false;
+        }
+
+        const Node &topo = topos[topo_name];
+
+        if(!topo.has_child("type") ||
+           !topo["type"].dtype().is_string() ||
+           !topo.has_child("coordset") ||
+           !topo["coordset"].dtype().is_string())
+        {
+            return false;
+        }
+
+        std::string topo_type = topo["type"].as_string();
+
+        if(topo_type == "uniform")
+        {
+            std::string cset_name = topo["coordset"].as_string();
+            if(!csets.has_path(cset_name + "/dims") ||
+               !hdf5_chunk_read_ijk(csets[cset_name]["dims"],shape))
+            {
+                return false;
+            }
+            // coordset dims are vertex counts
+            for(size_t d=0; d < shape.size(); d++)
+            {
+                shape[d] -= 1;
+            }
+        }
+        else if(topo_type == "rectilinear")
+        {
+            std::string cset_name = topo["coordset"].as_string();
+            if(!csets.has_path(cset_name + "/values"))
+            {
+                return false;
+            }
+            NodeConstIterator itr = csets[cset_name]["values"].children();
+            while(itr.has_next())
+            {
+                shape.push_back(itr.next().dtype().number_of_elements() - 1);
+            }
+        }
+        else if(topo_type == "structured")
+        {
+            if(!topo.has_path("elements/dims") ||
+               !hdf5_chunk_read_ijk(topo["elements/dims"],shape))
+            {
+                return false;
+            }
+        }
+        else
+        {
+            return false;
+        }
+
+        if(assoc == "vertex")
+        {
+            for(size_t d=0; d < shape.size(); d++)
+            {
+                shape[d] += 1;
+            }
+        }
+        else if(assoc != "element")
+        {
+            return false;
+        }
+
+        if(owner.has_child("offsets"))
+        {
+            offsets = &owner["offsets"];
+        }
+
+        if(owner.has_child("strides"))
+        {
+            strides = &owner["strides"];
+        }
+    }
+    else if(owners.name() == "coordsets")
+    {
+        // explicit coords are structured when a structured topology uses
+        // them, the topology's offsets and strides describe their layout
+        NodeConstIterator itr = topos.children();
+        while(itr.has_next() && shape.empty())
+        {
+            const Node &topo = itr.next();
+            if(topo.has_child("type") &&
+               topo["type"].dtype().is_string() &&
+               topo["type"].as_string() == "structured" &&
+               topo.has_child("coordset") &&
+               topo["coordset"].dtype().is_string() &&
+               topo["coordset"].as_string() == owner.name() &&
+               topo.has_path("elements/dims") &&
+               hdf5_chunk_read_ijk(topo["elements/dims"],shape))
+            {
+                for(size_t d=0; d < shape.size(); d++)
+                {
+                    shape[d] += 1;
+                }
+
+                const Node &topo_dims = topo["elements/dims"];
+                if(topo_dims.has_child("offsets"))
+                {
+                    offsets = &topo_dims["offsets"];
+                }
+
+                if(topo_dims.has_child("strides"))
+                {
+                    strides = &topo_dims["strides"];
+                }
+            }
+        }
+    }
+
+    if(shape.empty())
+    {
+        return false;
+    }
+
+    for(size_t d=0; d < shape.size(); d++)
+    {
+        if(shape[d] < 1)
+        {
+            return false;
+        }
+    }
+
+    return hdf5_chunk_strided_dims(shape,
+                                   offsets,
+                                   strides,
+                                   leaf.dtype().number_of_elements(),
+                                   dims);
+}
+
+//---------------------------------------------------------------------------//
+// picks a chunk length (in elements) for an array with the given dims
+// (slowest varying first) that holds whole rows (or planes) of the
+// fastest varying axis, and is no larger than max_eles.
+//---------------------------------------------------------------------------//
+index_t
+hdf5_aligned_chunk_elements(const std::vector<index_t> &dims,
+                            index_t max_eles)
+{
+    if(max_eles < 1)
+    {
+        max_eles = 1;
+    }
+
+    index_t block = 1;
+    for(index_t d = (index_t)dims.size() - 1; d >= 0; d--)
+    {
+        if(block * dims[d] <= max_eles)
+        {
+            block *= dims[d];
+            continue;
+        }
+
+        // we can't fit all of this dim, use as many blocks as we can,
+        // prefer a count that evenly divides the dim so that chunks
+        // don't straddle the next dim
+        index_t max_count = max_eles / block;
+        index_t count = max_count;
+        for(index_t c = max_count; c > 0 && 2 * c >= max_count; c--)
+        {
+            if(dims[d] % c == 0)
+            {
+                count = c;
+                break;
+            }
+        }
+        return block * count;
+    }
+
+    // everything fits
+    return block;
+}
+
+//---------------------------------------------------------------------------//
+// chooses the chunk length (in elements) for a leaf
+//---------------------------------------------------------------------------//
+hsize_t
+hdf5_chunk_elements_for_conduit_leaf(const Node &leaf)
+{
+    const DataType &dtype = leaf.dtype();
+    index_t ele_bytes = dtype.element_bytes();
+    index_t num_eles  = dtype.number_of_elements();
+
+    // hdf5 sets chunking in elements, not bytes,
+    // our options are in bytes, so convert to # of elems
+    index_t max_eles = HDF5Options::chunk_size / ele_bytes;
+    if(max_eles < 1)
+    {
+        max_eles = 1;
+    }
+
+    index_t res = max_eles;
+
+    std::vector<index_t> dims;
+    if(hdf5_chunk_path_dims_for_conduit_leaf(leaf,
+                                             HDF5Options::chunk_dims,
+                                             dims))
+    {
+        // explicit chunk dims, our datasets are 1D so the chunk
+        // is the product of the dims
+        res = 1;
+        for(size_t d=0; d < dims.size(); d++)
+        {
+            res *= dims[d];
+        }
+    }
+    else if( ( hdf5_chunk_path_dims_for_conduit_leaf(leaf,
+                                                     HDF5Options::chunk_shapes,
+                                                     dims) ||
+               ( HDF5Options::chunk_blueprint_shapes &&
+                 hdf5_chunk_blueprint_shape(leaf,dims) ) ) )
+    {
+        index_t shape_eles = 1;
+        for(size_t d=0; d < dims.size(); d++)
+        {
+            shape_eles *= dims[d];
+        }
+
+        // only use shapes that describe the leaf
+        if(shape_eles == num_eles)
+        {
+            res = hdf5_aligned_chunk_elements(dims,max_eles);
+        }
+    }
+
+    // hdf5 limits chunks to 4 GB
+    index_t max_chunk_eles = ((index_t)0xFFFFFFFF) / ele_bytes;
+    if(res > max_chunk_eles)
+    {
+        res = max_chunk_eles;
+    }
+
+    return (hsize_t) res;
+}
+
+//---------------------------------------------------------------------------//
+hid_t
+create_hdf5_chunked_plist_for_conduit_leaf(const Node &leaf)
+{
+    hid_t h5_cprops_id = H5Pcreate(H5P_DATASET_CREATE);
+
+    // Turn on chunking, using the leaf's shape (when known) to
+    // align chunks with the fastest varying axis
+    hsize_t h5_chunk_size = hdf5_chunk_elements_for_conduit_leaf(leaf);
+
+    H5Pset_chunk(h5_cprops_id, 1, &h5_chunk_size);
+
+    if(HDF5Options::compression_method == "gzip" )
+    {
+        // Turn on compression
+        H5Pset_shuffle(h5_cprops_id);
+        H5Pset_deflate(h5_cprops_id, HDF5Options::compression_level);
+    }
+//-----------------------------------------------------------------------------
+// zfp options
+//-----------------------------------------------------------------------------
+#if defined(CONDUIT_RELAY_IO_H5ZZFP_ENABLED)
+    // else if(false)//HDF5Options::compression_method == "zfp" )
+    else if(HDF5Options::compression_method == "zfp" )
+    {
+        // TODO: call once?
+        H5Z_zfp_initialize();
+        // Setup the filter using properties interface.
+        if (HDF5Options::zfp_mode == H5Z_ZFP_MODE_RATE)
+        {
+            H5Pset_zfp_rate(h5_cprops_id, HDF5Options::zfp_rate);
+        }
+        else if (HDF5Options::zfp_mode == H5Z_ZFP_MODE_PRECISION)
+        {
+            H5Pset_zfp_precision(h5_cprops_id, HDF5Options::zfp_prec);
+        }
+        else if (HDF5Options::zfp_mode == H5Z_ZFP_MODE_ACCURACY)
+        {
+            H5Pset_zfp_accuracy(h5_cprops_id, HDF5Options::zfp_acc);
+        }
+        else if (HDF5Options::zfp_mode == H5Z_ZFP_MODE_EXPERT)
+        {
+            H5Pset_zfp_expert(h5_cprops_id,
+                              HDF5Options::zfp_minbits,
+                              HDF5Options::zfp_maxbits,
+                              HDF5Options::zfp_maxprec,
+                              HDF5Options::zfp_minexp);
+        }
+        else if (HDF5Options::zfp_mode == H5Z_ZFP_MODE_REVERSIBLE)
+        {
+            H5Pset_zfp_reversible(h5_cprops_id);
+        }
+    }
+//-----------------------------------------------------------------------------
+#endif // zfp options
+//-----------------------------------------------------------------------------
+
+    return h5_cprops_id;
+}
+
+
+//---------------------------------------------------------------------------//
+hid_t
+create_hdf5_dataset_for_conduit_leaf(const Node &leaf,
+                                     const std::string &ref_path,
+                                     hid_t hdf5_group_id,
+                                     const std::string &hdf5_dset_name,
+                                     bool extendible)
+{
+    hid_t res = -1;
+
+    const DataType &dtype = leaf.dtype();
+
+    hid_t h5_dtype = conduit_dtype_to_hdf5_dtype(dtype,ref_path);
+
+    hsize_t num_eles = (hsize_t) dtype.number_of_elements();
+
+    hid_t h5_cprops_id = H5P_DEFAULT;
+
+    bool unlimited_dim = false;
+
+    if (extendible && !HDF5Options::chunking_enabled)
+    {
+        CONDUIT_ERROR("Chunking must be enabled to create an extendible array.");
+    }
+
+    // if an offset is supplied, we will default to creating an extendible array
+    if( !extendible && HDF5Options::compact_storage_enabled &&
+        dtype.bytes_compact() <= HDF5Options::compact_storage_threshold)
+    {
+        h5_cprops_id = create_hdf5_compact_plist_for_conduit_leaf();
+    }
+    else if( extendible || (HDF5Options::chunking_enabled &&
+             dtype.bytes_compact() > HDF5Options::chunk_threshold))
+    {
+        h5_cprops_id = create_hdf5_chunked_plist_for_conduit_leaf(leaf);
+        unlimited_dim = true;
+    }
+
+    CONDUIT_CHECK_HDF5_ERROR_WITH_FILE_AND_REF_PATH(h5_cprops_id,
+                                                    hdf5_group_id,
+                                                    ref_path,
+
+                                         "Failed to create HDF5 property list");
+    hid_t h5_dspace_id = -1;
+
+    // string a scalar with size embedded in type is disabled
+    // b/c this path undermines compression
+    // if(dtype.is_string())
+    // {
+    //     h5_dspace_id = H5Screate(H5S_SCALAR);
+    // }
+    // else
+    // {
+    //     h5_dspace_id = H5Screate_simple(1,
+    //                                     &num_eles,
+    //                                     NULL);
+    // }
+
+    if (unlimited_dim)
+    {
+        hsize_t unlimited_dims[1] = {H5S_UNLIMITED};
+        h5_dspace_id = H5Screate_simple(1,
+                                        &num_eles,
+                                        unlimited_dims);
+    }
+    else
+    {
+        h5_dspace_id = H5Screate_simple(1,
+                                        &num_eles,
+                                        NULL);
+    }
+
+
+    CONDUIT_CHECK_HDF5_ERROR_WITH_FILE_AND_REF_PATH(h5_dspace_id,
+                                                    hdf5_group_id,
+                                                    ref_path,
+                                           "Failed to create HDF5 Dataspace");
+
+    // create new dataset
+    res = H5Dcreate(hdf5_group_id,
+                    hdf5_dset_name.c_str(),
+                    h5_dtype,
+                    h5_dspace_id,
+                    H5P_DEFAULT,
+                    h5_cprops_id,
+                    H5P_DEFAULT);
+
+    CONDUIT_CHECK_HDF5_ERROR_WITH_FILE_AND_REF_PATH(res,
+                                                    hdf5_group_id,
+                                                    ref_path,
+                                           "Failed to create HDF5 Dataset "
+                                           << hdf5_group_id << " "
+                                           << hdf5_dset_name);
+
+    // cleanup if custom data type was used
+    conduit_dtype_to_hdf5_dtype_cleanup(h5_dtype);
+
+    // close plist used for compression
+    if(h5_cprops_id != H5P_DEFAULT)
+    {
+        CONDUIT_CHECK_HDF5_ERROR_WITH_FILE_AND_REF_PATH(H5Pclose(h5_cprops_id),
+                                                        hdf5_group_id,
+                                                        ref_path,
+                                           "Failed to close HDF5 compression "
+                                           "property list "
+                                                       << h5_cprops_id);
+    }
+
+    // close our dataspace
+    CONDUIT_CHECK_HDF5_ERROR_WITH_FILE_AND_REF_PATH(H5Sclose(h5_dspace_id),
+                                                    hdf5_group_id,
+                                                    ref_path,
+                                           "Failed to close HDF5 Dataspace "
+                                           << h5_dspace_id);
 
 
     return res;
@@ -1842,6 +2475,186 @@ create_hdf5_group_for_conduit_node(const Node &node,
 }
 
 
+//---------------------------------------------------------------------------//
+bool
+write_hdf5_dataset_chunks_in_parallel(const void *data_ptr,
+                                      hsize_t num_eles,
+                                      hid_t h5_dtype_id,
+                                      const std::string &ref_path,
+                                      hid_t hdf5_dset_id)
+{
+#if defined(CONDUIT_RELAY_IO_HDF5_DIRECT_CHUNK_WRITE)
+    if(num_eles == 0)
+    {
+        return false;
+    }
+
+    // direct chunk writes skip hdf5's type conversion, so the data
+    // must already use the dataset's type
+    hid_t h5_dset_dtype_id = H5Dget_type(hdf5_dset_id);
+    CONDUIT_CHECK_HDF5_ERROR_WITH_FILE_AND_REF_PATH(h5_dset_dtype_id,
+                                                    hdf5_dset_id,
+                                                    ref_path,
+                                   "Failed to get HDF5 Dataset Datatype");
+
+    bool same_type   = H5Tequal(h5_dset_dtype_id, h5_dtype_id) > 0;
+    size_t ele_bytes = H5Tget_size(h5_dset_dtype_id);
+    H5Tclose(h5_dset_dtype_id);
+
+    if(!same_type || ele_bytes == 0)
+    {
+        return false;
+    }
+
+    hid_t h5_cprops_id = H5Dget_create_plist(hdf5_dset_id);
+    CONDUIT_CHECK_HDF5_ERROR_WITH_FILE_AND_REF_PATH(h5_cprops_id,
+                                                    hdf5_dset_id,
+                                                    ref_path,
+                        "Failed to get HDF5 Dataset creation property list");
+
+    hsize_t chunk_eles = 0;
+    bool supported = H5Pget_layout(h5_cprops_id) == H5D_CHUNKED &&
+                     H5Pget_chunk(h5_cprops_id, 1, &chunk_eles) == 1 &&
+                     chunk_eles > 0;
+
+    // we can only apply the filters create_hdf5_chunked_plist_for_conduit_leaf
+    // uses for gzip: shuffle (optional), then deflate
+    bool shuffle = false;
+    bool deflate = false;
+    int  deflate_level = 0;
+
+    int num_filters = supported ? H5Pget_nfilters(h5_cprops_id) : 0;
+    for(int i=0; i < num_filters && supported; i++)
+    {
+        unsigned int flags = 0;
+        size_t       cd_nelmts = 8;
+        unsigned int cd_values[8] = {0,0,0,0,0,0,0,0};
+        unsigned int filter_config = 0;
+
+        H5Z_filter_t filter_id = H5Pget_filter2(h5_cprops_id,
+                                                (unsigned int)i,
+                                                &flags,
+                                                &cd_nelmts,
+                                                cd_values,
+                                                0,
+                                                NULL,
+                                                &filter_config);
+
+        if(filter_id == H5Z_FILTER_SHUFFLE && !shuffle && !deflate)
+        {
+            shuffle = true;
+        }
+        else if(filter_id == H5Z_FILTER_DEFLATE && !deflate && cd_nelmts > 0)
+        {
+            deflate = true;
+            deflate_level = (int)cd_values[0];
+        }
+        else
+        {
+            supported = false;
+        }
+    }
+
+    H5Pclose(h5_cprops_id);
+
+    if(!supported || !deflate)
+    {
+        return false;
+    }
+
+    const uint8 *src_ptr = (const uint8*)data_ptr;
+    size_t data_bytes    = (size_t)num_eles * ele_bytes;
+    size_t chunk_bytes   = (size_t)chunk_eles * ele_bytes;
+    index_t num_chunks   = (index_t)((num_eles + chunk_eles - 1) / chunk_eles);
+
+    // compress a batch of chunks at a time, which bounds the memory
+    // used to hold compressed chunks
+    index_t batch_size = std::max<index_t>(1,
+                                2 * execution::task::number_of_workers());
+    batch_size = std::min(batch_size, num_chunks);
+
+    std::vector< std::vector<uint8> > batch_bufs((size_t)batch_size);
+    std::vector<size_t> batch_nbytes((size_t)batch_size, 0);
+
+    for(index_t batch_start = 0;
+        batch_start < num_chunks;
+        batch_start += batch_size)
+    {
+        index_t batch_count = std::min(batch_size, num_chunks - batch_start);
+
+        execution::task::run_tasks(batch_count, [&](index_t i)
+        {
+            size_t chunk_start = (size_t)(batch_start + i) * chunk_bytes;
+            size_t src_bytes   = std::min(chunk_bytes, data_bytes - chunk_start);
+
+            // hdf5 stores filtered edge chunks at full size,
+            // so pad the last chunk with zeros
+            std::vector<uint8> chunk(chunk_bytes, 0);
+            if(shuffle && ele_bytes > 1)
+            {
+                // same byte order as hdf5's shuffle filter
+                for(size_t e = 0; e < src_bytes / ele_bytes; e++)
+                {
+                    for(size_t b = 0; b < ele_bytes; b++)
+                    {
+                        chunk[b * chunk_eles + e] =
+                            src_ptr[chunk_start + e * ele_bytes + b];
+                    }
+                }
+            }
+            else
+            {
+                memcpy(&chunk[0], src_ptr + chunk_start, src_bytes);
+            }
+
+            std::vector<uint8> &res = batch_bufs[(size_t)i];
+            uLongf res_nbytes = compressBound((uLong)chunk_bytes);
+            res.resize((size_t)res_nbytes);
+
+            if(compress2(&res[0],
+                         &res_nbytes,
+                         &chunk[0],
+                         (uLong)chunk_bytes,
+                         deflate_level) != Z_OK)
+            {
+                CONDUIT_HDF5_ERROR(ref_path,
+                                   "Failed to compress chunk "
+                                   << (batch_start + i));
+            }
+
+            batch_nbytes[(size_t)i] = (size_t)res_nbytes;
+        });
+
+        // hdf5 calls stay on this thread
+        for(index_t i=0; i < batch_count; i++)
+        {
+            hsize_t chunk_offset[1] = {(hsize_t)(batch_start + i) * chunk_eles};
+            herr_t h5_status = H5Dwrite_chunk(hdf5_dset_id,
+                                              H5P_DEFAULT,
+                                              0, // all filters were applied
+                                              chunk_offset,
+                                              batch_nbytes[(size_t)i],
+                                              &batch_bufs[(size_t)i][0]);
+
+            CONDUIT_CHECK_HDF5_ERROR_WITH_FILE_AND_REF_PATH(h5_status,
+                                                            hdf5_dset_id,
+                                                            ref_path,
+                                           "Failed to write chunk to HDF5 "
+                                           "Dataset " << hdf5_dset_id);
+        }
+    }
+
+    return true;
+#else
+    CONDUIT_UNUSED(data_ptr);
+    CONDUIT_UNUSED(num_eles);
+    CONDUIT_UNUSED(h5_dtype_id);
+    CONDUIT_UNUSED(ref_path);
+    CONDUIT_UNUSED(hdf5_dset_id);
+    return false;
+#endif
+}
+
 //---------------------------------------------------------------------------//
 void
 write_conduit_leaf_to_hdf5_dataset(const Node &node,
@@ -2010,12 +2823,45 @@ write_conduit_leaf_to_hdf5_dataset(const Node &node,
             dataspace = H5Dget_space(hdf5_dset_id);
         }
 
+        // when the entire dataset is written, gzip chunks can be
+        // compressed in parallel
+        bool chunks_written = false;
+        if(HDF5Options::compression_parallel &&
+           offset == 0 && stride == 1 &&
+           dataset_dim == (hsize_t) dt.number_of_elements())
+        {
+            if(dt.is_compact())
+            {
+                chunks_written = write_hdf5_dataset_chunks_in_parallel(
+                                                        node.data_ptr(),
+                                                        dataset_dim,
+                                                        h5_dtype_id,
+                                                        ref_path,
+                                                        hdf5_dset_id);
+            }
+            else
+            {
+                Node n;
+                node.compact_to(n);
+                chunks_written = write_hdf5_dataset_chunks_in_parallel(
+                                                        n.data_ptr(),
+                                                        dataset_dim,
+                                                        h5_dtype_id,
+                                                        ref_path,
+                                                        hdf5_dset_id);
+            }
+        }
+
         // select indices to write to
         H5Sselect_hyperslab(dataspace, H5S_SELECT_SET, offsets,
                 strides, node_size, NULL);
 
+        if(chunks_written)
+        {
+            h5_status = 0;
+        }
         // if the node is compact, we can write directly from its data ptr
-        if(dt.is_compact())
+        else if(dt.is_compact())
         {
             // write data
             h5_status = H5Dwrite(hdf5_dset_id,
@@ -2116,7 +2962,7 @@ write_conduit_leaf_to_hdf5_group(const Node &node,
         {
             extendible = true;
         }
-        h5_child_id = create_hdf5_dataset_for_conduit_leaf(node.dtype(),
+        h5_child_id = create_hdf5_dataset_for_conduit_leaf(node,
                                                            ref_path,
                                                            hdf5_group_id,
                                                            hdf5_dset_name,
@@ -2515,6 +3361,11 @@ struct h5_read_opdata
 
     // whether to only get metadata
     bool             metadata_only;
+
+    // errors can't be thrown through H5Literate (with a thread safe
+    // hdf5 build that leaves hdf5's global lock held), the callback
+    // keeps them here and they are rethrown after H5Literate returns
+    std::exception_ptr error;
 };
 
 //---------------------------------------------------------------------------//
@@ -2629,7 +3480,7 @@ h5l_iterate_traverse_op_func_get_child(Node &node,
 }
 
 //---------------------------------------------------------------------------//
-/// Our main callback for H5Literate.
+/// Implementation of our main callback for H5Literate.
 /// (adapted from: h5ex_g_traverse)
 //---------------------------------------------------------------------------//
 //  Operator function.  This function prints the name and type
@@ -2641,10 +3492,9 @@ h5l_iterate_traverse_op_func_get_child(Node &node,
 //  circular path in the file.
 //---------------------------------------------------------------------------//
 herr_t
-h5l_iterate_traverse_op_func(hid_t hdf5_id,
-                             const char *hdf5_path,
-                             const H5L_info_t *,// hdf5_info -- unused
-                             void *hdf5_operator_data)
+h5l_iterate_traverse_op_func_impl(hid_t hdf5_id,
+                                  const char *hdf5_path,
+                                  void *hdf5_operator_data)
 {
     herr_t h5_status = 0;
     herr_t h5_return_val = 0;
@@ -2792,6 +3642,72 @@ h5l_iterate_traverse_op_func(hid_t hdf5_id,
     return h5_return_val;
 }
 
+//---------------------------------------------------------------------------//
+/// Our main callback for H5Literate, stops the iteration on errors.
+//---------------------------------------------------------------------------//
+herr_t
+h5l_iterate_traverse_op_func(hid_t hdf5_id,
+                             const char *hdf5_path,
+                             const H5L_info_t *,// hdf5_info -- unused
+                             void *hdf5_operator_data)
+{
+    struct h5_read_opdata *h5_od = (struct h5_read_opdata*)hdf5_operator_data;
+    try
+    {
+        return h5l_iterate_traverse_op_func_impl(hdf5_id,
+                                                 hdf5_path,
+                                                 hdf5_operator_data);
+    }
+    catch(...)
+    {
+        h5_od->error = std::current_exception();
+    }
+    return -1;
+}
+
+
+//---------------------------------------------------------------------------//
+/// Returns the index type used to iterate a group's children, creation
+/// order if the group tracks and indexes it, otherwise name order.
+//---------------------------------------------------------------------------//
+H5_index_t
+hdf5_group_index_type(hid_t hdf5_group_id,
+                      const std::string &ref_path)
+{
+    H5_index_t h5_grp_index_type = H5_INDEX_NAME;
+
+    // check for creation order index using propertylist
+
+    hid_t h5_gc_plist = H5Gget_create_plist(hdf5_group_id);
+
+    if( CONDUIT_HDF5_VALID_ID(h5_gc_plist) )
+    {
+        unsigned int h5_gc_flags = 0;
+        herr_t h5_status = H5Pget_link_creation_order(h5_gc_plist,
+                                                      &h5_gc_flags);
+
+        // first make sure we have the link creation order plist
+        if( CONDUIT_HDF5_STATUS_OK(h5_status) )
+        {
+            // check that we have both order_tracked and order_indexed
+            if( h5_gc_flags & (H5P_CRT_ORDER_TRACKED | H5P_CRT_ORDER_INDEXED) )
+            {
+                // if so, we can use creation order in h5literate
+                h5_grp_index_type = H5_INDEX_CRT_ORDER;
+            }
+        }
+
+        CONDUIT_CHECK_HDF5_ERROR_WITH_FILE_AND_REF_PATH(H5Pclose(h5_gc_plist),
+                                                        hdf5_group_id,
+                                                        ref_path,
+                                               "Failed to close HDF5 "
+                                               << "H5P_GROUP_CREATE "
+                                               << "property list: "
+                                               << h5_gc_plist);
+    }
+
+    return h5_grp_index_type;
+}
 
 //---------------------------------------------------------------------------//
 void
@@ -2838,52 +3754,23 @@ read_hdf5_group_into_conduit_node(hid_t hdf5_group_id,
     // attach the pointer to our node
     h5_od.node = &dest;
     h5_od.opts = &opts;
-    // keep ref path
-    h5_od.ref_path = ref_path;
-
-    // whether to only get metadata
-    if (only_get_metadata)
-    {
-        h5_od.metadata_only = true;
-    }
-    else
-    {
-        h5_od.metadata_only = false;
-    }
-
-    H5_index_t h5_grp_index_type = H5_INDEX_NAME;
-
-    // check for creation order index using propertylist
-
-    hid_t h5_gc_plist = H5Gget_create_plist(hdf5_group_id);
-
-    if( CONDUIT_HDF5_VALID_ID(h5_gc_plist) )
-    {
-        unsigned int h5_gc_flags = 0;
-        h5_status = H5Pget_link_creation_order(h5_gc_plist,
-                                           &h5_gc_flags);
-
-        // first make sure we have the link creation order plist
-        if( CONDUIT_HDF5_STATUS_OK(h5_status) )
-        {
-            // check that we have both order_tracked and order_indexed
-            if( h5_gc_flags & (H5P_CRT_ORDER_TRACKED | H5P_CRT_ORDER_INDEXED) )
-            {
-                // if so, we can use creation order in h5literate
-                h5_grp_index_type = H5_INDEX_CRT_ORDER;
-            }
-        }
+    // keep ref path
+    h5_od.ref_path = ref_path;
 
-        CONDUIT_CHECK_HDF5_ERROR_WITH_FILE_AND_REF_PATH(H5Pclose(h5_gc_plist),
-                                                        hdf5_group_id,
-                                                        ref_path,
-                                               "Failed to close HDF5 "
-                                               << "H5P_GROUP_CREATE "
-                                               << "property list: "
-                                               << h5_gc_plist);
+    // whether to only get metadata
+    if (only_get_metadata)
+    {
+        h5_od.metadata_only = true;
+    }
+    else
+    {
+        h5_od.metadata_only = false;
     }
 
+    h5_od.error = nullptr;
 
+    H5_index_t h5_grp_index_type = hdf5_group_index_type(hdf5_group_id,
+                                                         ref_path);
 
     // use H5Literate to traverse
     h5_status = H5Literate(hdf5_group_id,
@@ -2893,6 +3780,11 @@ read_hdf5_group_into_conduit_node(hid_t hdf5_group_id,
                            h5l_iterate_traverse_op_func,
                            (void *) &h5_od);
 
+    if(h5_od.error)
+    {
+        std::rethrow_exception(h5_od.error);
+    }
+
     CONDUIT_CHECK_HDF5_ERROR_WITH_FILE_AND_REF_PATH(h5_status,
                                                     hdf5_group_id,
                                                     ref_path,
@@ -3208,58 +4100,423 @@ read_hdf5_dataset_into_conduit_node(hid_t hdf5_dset_id,
                                     H5P_DEFAULT,
                                     n_tmp.data_ptr());
 
-                // copy out to our dest
-                dest.set(n_tmp);
-            }
+                // copy out to our dest
+                dest.set(n_tmp);
+            }
+
+            H5Sclose(nodespace);
+            H5Sclose(dataspace);
+        }
+
+        if(opts.dtype().is_empty())
+        {
+            CONDUIT_CHECK_HDF5_ERROR_WITH_FILE_AND_REF_PATH(h5_status,
+                                                            hdf5_dset_id,
+                                                            ref_path,
+                                                            "Error reading HDF5 Dataset: "
+                                                                << hdf5_dset_id);
+        }
+        else
+        {
+            CONDUIT_CHECK_HDF5_ERROR_WITH_FILE_AND_REF_PATH(h5_status,
+                                                            hdf5_dset_id,
+                                                            ref_path,
+                                                            "Error reading HDF5 Dataset: "
+                                                            << hdf5_dset_id
+                                                            << " with options: "
+                                                            << opts.to_yaml()
+                                                            << "HDF5 dataset size: "
+                                                            << nelems);
+        }
+
+        CONDUIT_CHECK_HDF5_ERROR_WITH_FILE_AND_REF_PATH(H5Tclose(h5_dtype_id),
+                                                        hdf5_dset_id,
+                                                        ref_path,
+                                               "Error closing HDF5 Datatype: "
+                                               << h5_dtype_id);
+
+    }
+
+    CONDUIT_CHECK_HDF5_ERROR_WITH_FILE_AND_REF_PATH(H5Sclose(h5_dspace_id),
+                                                    hdf5_dset_id,
+                                                    ref_path,
+                                           "Error closing HDF5 Dataspace: "
+                                           << h5_dspace_id);
+
+}
+
+//---------------------------------------------------------------------------//
+void
+read_hdf5_tree_into_conduit_node(hid_t hdf5_id,
+                                 const std::string &ref_path,
+                                 bool only_get_metadata,
+                                 const Node &opts,
+                                 Node &dest)
+{
+    H5O_info_t h5_info_buf;
+
+#if H5_VERSION_GE(1, 12, 0) && !defined(H5_USE_18_API)
+    herr_t h5_status = H5Oget_info(hdf5_id,&h5_info_buf,H5O_INFO_ALL);
+#else
+    herr_t h5_status = H5Oget_info(hdf5_id,&h5_info_buf);
+#endif 
+
+
+    CONDUIT_CHECK_HDF5_ERROR_WITH_FILE_AND_REF_PATH(h5_status,
+                                                    hdf5_id,
+                                                    ref_path,
+                                           "Error fetching HDF5 object "
+                                           << "info from: "
+                                           << hdf5_id);
+
+    switch (h5_info_buf.type)
+    {
+        // if hdf5_id + hdf5_path points to a group,
+        // use a H5Literate traversal
+        case H5O_TYPE_GROUP:
+        {
+            read_hdf5_group_into_conduit_node(hdf5_id,
+                                              ref_path,
+                                              only_get_metadata,
+                                              opts,
+                                              dest);
+            break;
+        }
+        // if hdf5_id + hdf5_path points directly to a dataset
+        // skip the H5Literate traversal
+        case H5O_TYPE_DATASET:
+        {
+            read_hdf5_dataset_into_conduit_node(hdf5_id,
+                                                ref_path,
+                                                only_get_metadata,
+                                                opts,
+                                                dest);
+            break;
+        }
+        // unsupported types
+        case H5O_TYPE_UNKNOWN:
+        {
+            // we only construct these strings
+            // when an error occurs, to avoid overhead
+            // for healthy fetches
+            std::string hdf5_err_ref_path;
+            hdf5_ref_path_with_filename(hdf5_id,
+                                        ref_path,
+                                        hdf5_err_ref_path);
+            CONDUIT_HDF5_ERROR(hdf5_err_ref_path,
+                               "Cannot read HDF5 Object : "
+                                << "(type == H5O_TYPE_UNKNOWN )");
+            break;
+        }
+        case H5O_TYPE_NAMED_DATATYPE:
+        {
+            std::string hdf5_err_ref_path;
+            hdf5_ref_path_with_filename(hdf5_id,
+                                        ref_path,
+                                        hdf5_err_ref_path);
+            CONDUIT_HDF5_ERROR(hdf5_err_ref_path,
+                               "Cannot read HDF5 Object "
+                               << "(type == H5O_TYPE_NAMED_DATATYPE )");
+            break;
+        }
+        case H5O_TYPE_NTYPES:
+        {
+            std::string hdf5_err_ref_path;
+            hdf5_ref_path_with_filename(hdf5_id,
+                                        ref_path,
+                                        hdf5_err_ref_path);
+            CONDUIT_HDF5_ERROR(hdf5_err_ref_path,
+              "Cannot read HDF5 Object "
+               << "(type == H5O_TYPE_NTYPES [This is an invalid HDF5 type!]");
+            break;
+        }
+        default:
+        {
+            std::string hdf5_err_ref_path;
+            hdf5_ref_path_with_filename(hdf5_id,
+                                        ref_path,
+                                        hdf5_err_ref_path);
+            CONDUIT_HDF5_ERROR(hdf5_err_ref_path,
+                               "Cannot read HDF5 Object (type == Unknown )");
+        }
+    }
+}
+
+
+
+//---------------------------------------------------------------------------//
+/// H5Literate callback that collects the names of a group's children.
+/// (the schema walk opens children after H5Literate returns, so errors
+///  are never thrown through H5Literate)
+//---------------------------------------------------------------------------//
+herr_t
+h5l_iterate_child_names_op_func(hid_t, // hdf5_id -- unused
+                                const char *hdf5_path,
+                                const H5L_info_t *,// hdf5_info -- unused
+                                void *hdf5_operator_data)
+{
+    std::vector<std::string> *names =
+                        (std::vector<std::string>*)hdf5_operator_data;
+    names->push_back(std::string(hdf5_path));
+    return 0;
+}
+
+//---------------------------------------------------------------------------//
+void
+read_hdf5_dataset_into_conduit_schema(hid_t hdf5_dset_id,
+                                      const std::string &ref_path,
+                                      Schema &dest)
+{
+    hid_t h5_dspace_id = H5Dget_space(hdf5_dset_id);
+    CONDUIT_CHECK_HDF5_ERROR_WITH_FILE_AND_REF_PATH(h5_dspace_id,
+                                                    hdf5_dset_id,
+                                                    ref_path,
+                                           "Error reading HDF5 Dataspace: "
+                                           << hdf5_dset_id);
+
+    // check for empty case
+    if(H5Sget_simple_extent_type(h5_dspace_id) == H5S_NULL)
+    {
+        dest.set(DataType::empty());
+    }
+    else
+    {
+        hid_t h5_dtype_id  = H5Dget_type(hdf5_dset_id);
+
+        CONDUIT_CHECK_HDF5_ERROR_WITH_FILE_AND_REF_PATH(h5_dtype_id,
+                                                        hdf5_dset_id,
+                                                        ref_path,
+                                               "Error reading HDF5 Datatype: "
+                                               << hdf5_dset_id);
+
+        if( H5Tis_variable_str(h5_dtype_id) > 0 )
+        {
+            // the length of a variable length string is only known
+            // after it is read, so we read it
+            Node opts;
+            Node n_tmp;
+            read_hdf5_dataset_into_conduit_node(hdf5_dset_id,
+                                                ref_path,
+                                                false,
+                                                opts,
+                                                n_tmp);
+            dest.set(n_tmp.schema());
+        }
+        else
+        {
+            // scalars have rank 0, we treat them as one element
+            int rank = H5Sget_simple_extent_ndims(h5_dspace_id);
+            std::vector<hsize_t> dims(rank < 1 ? 1 : rank, 1);
+            if(rank > 0)
+            {
+                H5Sget_simple_extent_dims(h5_dspace_id, dims.data(), NULL);
+            }
+
+            DataType dt = hdf5_dtype_to_conduit_dtype(h5_dtype_id,
+                                                      dims.data(),
+                                                      (index_t)dims.size(),
+                                                      ref_path);
+            // reads always convert to the machine's endianness
+            if(!dt.endianness_matches_machine())
+            {
+                dt.set_endianness(Endianness::machine_default());
+            }
+            dest.set(dt);
+        }
+
+        CONDUIT_CHECK_HDF5_ERROR_WITH_FILE_AND_REF_PATH(H5Tclose(h5_dtype_id),
+                                                        hdf5_dset_id,
+                                                        ref_path,
+                                               "Error closing HDF5 Datatype: "
+                                               << h5_dtype_id);
+    }
+
+    CONDUIT_CHECK_HDF5_ERROR_WITH_FILE_AND_REF_PATH(H5Sclose(h5_dspace_id),
+                                                    hdf5_dset_id,
+                                                    ref_path,
+                                           "Error closing HDF5 Dataspace: "
+                                           << h5_dspace_id);
+}
+
+//---------------------------------------------------------------------------//
+void
+read_hdf5_group_into_conduit_schema(hid_t hdf5_group_id,
+                                    const std::string &ref_path,
+                                    h5_read_opdata *parent_od,
+                                    Schema &dest)
+{
+    // get info, we need to get the obj addr for cycle tracking
+    H5O_info_t h5_info_buf;
+#if H5_VERSION_GE(1, 12, 0) && !defined(H5_USE_18_API)
+    herr_t h5_status = H5Oget_info(hdf5_group_id,
+                                   &h5_info_buf,
+                                   H5O_INFO_ALL);
+#else
+    herr_t h5_status = H5Oget_info(hdf5_group_id,
+                                   &h5_info_buf);
+#endif
+
+    CONDUIT_CHECK_HDF5_ERROR_WITH_FILE_AND_REF_PATH(h5_status,
+                                                    hdf5_group_id,
+                                                    ref_path,
+                                           "Error fetching HDF5 object "
+                                           << "info from: "
+                                           << hdf5_group_id);
+
+    bool is_list = check_if_hdf5_group_has_conduit_list_attribute(
+                                                            hdf5_group_id,
+                                                            ref_path);
+    if(is_list)
+    {
+        dest.set(DataType::list());
+    }
+    else
+    {
+        dest.set(DataType::object());
+    }
+
+    // we use the same linked list as the node walk to detect cycles
+    struct h5_read_opdata  h5_od;
+    h5_od.recurs = parent_od == NULL ? 0 : parent_od->recurs + 1;
+    h5_od.prev   = parent_od;
+#if H5_VERSION_GE(1, 12, 0) && !defined(H5_USE_18_API)
+    h5_od.token = &h5_info_buf.token;
+#else
+    h5_od.addr = h5_info_buf.addr;
+#endif
+    h5_od.node = NULL;
+    h5_od.opts = NULL;
+    h5_od.ref_path = ref_path;
+    h5_od.metadata_only = true;
+    h5_od.error = nullptr;
 
-            H5Sclose(nodespace);
-            H5Sclose(dataspace);
+    std::vector<std::string> chld_names;
+    h5_status = H5Literate(hdf5_group_id,
+                           hdf5_group_index_type(hdf5_group_id, ref_path),
+                           H5_ITER_INC,
+                           NULL,
+                           h5l_iterate_child_names_op_func,
+                           (void *) &chld_names);
+
+    CONDUIT_CHECK_HDF5_ERROR_WITH_FILE_AND_REF_PATH(h5_status,
+                                                    hdf5_group_id,
+                                                    ref_path,
+                                           "Error calling H5Literate to "
+                                           << "list HDF5 group children: "
+                                           << hdf5_group_id);
+
+    for(size_t i=0; i < chld_names.size(); i++)
+    {
+        const std::string &chld_name = chld_names[i];
+
+        std::string chld_ref_path = ref_path;
+        if(chld_ref_path != std::string("/"))
+        {
+            chld_ref_path += std::string("/");
         }
+        chld_ref_path += chld_name;
 
-        if(opts.dtype().is_empty())
+        H5O_info_t h5_chld_info_buf;
+#if H5_VERSION_GE(1, 12, 0) && !defined(H5_USE_18_API)
+        h5_status = H5Oget_info_by_name(hdf5_group_id,
+                                        chld_name.c_str(),
+                                        &h5_chld_info_buf,
+                                        H5O_INFO_ALL,
+                                        H5P_DEFAULT);
+#else
+        h5_status = H5Oget_info_by_name(hdf5_group_id,
+                                        chld_name.c_str(),
+                                        &h5_chld_info_buf,
+                                        H5P_DEFAULT);
+#endif
+
+        CONDUIT_CHECK_HDF5_ERROR_WITH_FILE_AND_REF_PATH(h5_status,
+                                                        hdf5_group_id,
+                                                        ref_path,
+                                               "Error fetching HDF5 Object info: "
+                                               << " parent: " << hdf5_group_id
+                                               << " path:"    << chld_name);
+
+        if(h5_chld_info_buf.type == H5O_TYPE_GROUP)
         {
-            CONDUIT_CHECK_HDF5_ERROR_WITH_FILE_AND_REF_PATH(h5_status,
-                                                            hdf5_dset_id,
+#if H5_VERSION_GE(1, 12, 0) && !defined(H5_USE_18_API)
+            if( h5_group_check(&h5_od,
+                               hdf5_group_id,
+                               &h5_chld_info_buf.token) )
+#else
+            if( h5_group_check(&h5_od, h5_chld_info_buf.addr) )
+#endif
+            {
+                // skip cycles in the graph ...
+                continue;
+            }
+
+            hid_t h5_chld_id = H5Gopen(hdf5_group_id,
+                                       chld_name.c_str(),
+                                       H5P_DEFAULT);
+            CONDUIT_CHECK_HDF5_ERROR_WITH_FILE_AND_REF_PATH(h5_chld_id,
+                                                            hdf5_group_id,
                                                             ref_path,
-                                                            "Error reading HDF5 Dataset: "
-                                                                << hdf5_dset_id);
+                                                   "Error opening HDF5 "
+                                                   << "Group: "
+                                                   << " parent: "
+                                                   << hdf5_group_id
+                                                   << " path:"
+                                                   << chld_name);
+
+            Schema &chld_schema = is_list ? dest.append()
+                                          : dest.add_child(chld_name);
+
+            read_hdf5_group_into_conduit_schema(h5_chld_id,
+                                                chld_ref_path,
+                                                &h5_od,
+                                                chld_schema);
+
+            CONDUIT_CHECK_HDF5_ERROR_WITH_FILE_AND_REF_PATH(H5Gclose(h5_chld_id),
+                                                            hdf5_group_id,
+                                                            ref_path,
+                                                   "Error closing HDF5 "
+                                                   << "Group: "
+                                                   << h5_chld_id);
         }
-        else
+        else if(h5_chld_info_buf.type == H5O_TYPE_DATASET)
         {
-            CONDUIT_CHECK_HDF5_ERROR_WITH_FILE_AND_REF_PATH(h5_status,
-                                                            hdf5_dset_id,
+            hid_t h5_chld_id = H5Dopen(hdf5_group_id,
+                                       chld_name.c_str(),
+                                       H5P_DEFAULT);
+            CONDUIT_CHECK_HDF5_ERROR_WITH_FILE_AND_REF_PATH(h5_chld_id,
+                                                            hdf5_group_id,
                                                             ref_path,
-                                                            "Error reading HDF5 Dataset: "
-                                                            << hdf5_dset_id
-                                                            << " with options: "
-                                                            << opts.to_yaml()
-                                                            << "HDF5 dataset size: "
-                                                            << nelems);
-        }
-
-        CONDUIT_CHECK_HDF5_ERROR_WITH_FILE_AND_REF_PATH(H5Tclose(h5_dtype_id),
-                                                        hdf5_dset_id,
-                                                        ref_path,
-                                               "Error closing HDF5 Datatype: "
-                                               << h5_dtype_id);
+                                                   "Error opening HDF5 "
+                                                   << " Dataset: "
+                                                   << " parent: "
+                                                   << hdf5_group_id
+                                                   << " path:"
+                                                   << chld_name);
 
-    }
+            Schema &chld_schema = is_list ? dest.append()
+                                          : dest.add_child(chld_name);
 
-    CONDUIT_CHECK_HDF5_ERROR_WITH_FILE_AND_REF_PATH(H5Sclose(h5_dspace_id),
-                                                    hdf5_dset_id,
-                                                    ref_path,
-                                           "Error closing HDF5 Dataspace: "
-                                           << h5_dspace_id);
+            read_hdf5_dataset_into_conduit_schema(h5_chld_id,
+                                                  chld_ref_path,
+                                                  chld_schema);
 
+            CONDUIT_CHECK_HDF5_ERROR_WITH_FILE_AND_REF_PATH(H5Dclose(h5_chld_id),
+                                                            hdf5_group_id,
+                                                            ref_path,
+                                                   "Error closing HDF5 "
+                                                   << " Dataset: "
+                                                   << h5_chld_id);
+        }
+        // other object types are skipped, as in the node walk
+    }
 }
 
 //---------------------------------------------------------------------------//
 void
-read_hdf5_tree_into_conduit_node(hid_t hdf5_id,
-                                 const std::string &ref_path,
-                                 bool only_get_metadata,
-                                 const Node &opts,
-                                 Node &dest)
+read_hdf5_tree_into_conduit_schema(hid_t hdf5_id,
+                                   const std::string &ref_path,
+                                   Schema &dest)
 {
     H5O_info_t h5_info_buf;
 
@@ -3267,8 +4524,7 @@ read_hdf5_tree_into_conduit_node(hid_t hdf5_id,
     herr_t h5_status = H5Oget_info(hdf5_id,&h5_info_buf,H5O_INFO_ALL);
 #else
     herr_t h5_status = H5Oget_info(hdf5_id,&h5_info_buf);
-#endif 
-
+#endif
 
     CONDUIT_CHECK_HDF5_ERROR_WITH_FILE_AND_REF_PATH(h5_status,
                                                     hdf5_id,
@@ -3277,81 +4533,31 @@ read_hdf5_tree_into_conduit_node(hid_t hdf5_id,
                                            << "info from: "
                                            << hdf5_id);
 
-    switch (h5_info_buf.type)
+    if(h5_info_buf.type == H5O_TYPE_GROUP)
     {
-        // if hdf5_id + hdf5_path points to a group,
-        // use a H5Literate traversal
-        case H5O_TYPE_GROUP:
-        {
-            read_hdf5_group_into_conduit_node(hdf5_id,
+        read_hdf5_group_into_conduit_schema(hdf5_id,
+                                            ref_path,
+                                            NULL,
+                                            dest);
+    }
+    else if(h5_info_buf.type == H5O_TYPE_DATASET)
+    {
+        read_hdf5_dataset_into_conduit_schema(hdf5_id,
                                               ref_path,
-                                              only_get_metadata,
-                                              opts,
                                               dest);
-            break;
-        }
-        // if hdf5_id + hdf5_path points directly to a dataset
-        // skip the H5Literate traversal
-        case H5O_TYPE_DATASET:
-        {
-            read_hdf5_dataset_into_conduit_node(hdf5_id,
-                                                ref_path,
-                                                only_get_metadata,
-                                                opts,
-                                                dest);
-            break;
-        }
-        // unsupported types
-        case H5O_TYPE_UNKNOWN:
-        {
-            // we only construct these strings
-            // when an error occurs, to avoid overhead
-            // for healthy fetches
-            std::string hdf5_err_ref_path;
-            hdf5_ref_path_with_filename(hdf5_id,
-                                        ref_path,
-                                        hdf5_err_ref_path);
-            CONDUIT_HDF5_ERROR(hdf5_err_ref_path,
-                               "Cannot read HDF5 Object : "
-                                << "(type == H5O_TYPE_UNKNOWN )");
-            break;
-        }
-        case H5O_TYPE_NAMED_DATATYPE:
-        {
-            std::string hdf5_err_ref_path;
-            hdf5_ref_path_with_filename(hdf5_id,
-                                        ref_path,
-                                        hdf5_err_ref_path);
-            CONDUIT_HDF5_ERROR(hdf5_err_ref_path,
-                               "Cannot read HDF5 Object "
-                               << "(type == H5O_TYPE_NAMED_DATATYPE )");
-            break;
-        }
-        case H5O_TYPE_NTYPES:
-        {
-            std::string hdf5_err_ref_path;
-            hdf5_ref_path_with_filename(hdf5_id,
-                                        ref_path,
-                                        hdf5_err_ref_path);
-            CONDUIT_HDF5_ERROR(hdf5_err_ref_path,
-              "Cannot read HDF5 Object "
-               << "(type == H5O_TYPE_NTYPES [This is an invalid HDF5 type!]");
-            break;
-        }
-        default:
-        {
-            std::string hdf5_err_ref_path;
-            hdf5_ref_path_with_filename(hdf5_id,
-                                        ref_path,
-                                        hdf5_err_ref_path);
-            CONDUIT_HDF5_ERROR(hdf5_err_ref_path,
-                               "Cannot read HDF5 Object (type == Unknown )");
-        }
+    }
+    else
+    {
+        std::string hdf5_err_ref_path;
+        hdf5_ref_path_with_filename(hdf5_id,
+                                    ref_path,
+                                    hdf5_err_ref_path);
+        CONDUIT_HDF5_ERROR(hdf5_err_ref_path,
+                           "Cannot read schema of HDF5 Object "
+                           << "(type is not a group or dataset)");
     }
 }
 
-
-
 //---------------------------------------------------------------------------//
 hid_t
 create_hdf5_file_access_plist()
@@ -4190,6 +5396,107 @@ hdf5_read_info(hid_t hdf5_id,
 }
 
 
+//---------------------------------------------------------------------------//
+void
+hdf5_read_schema(hid_t hdf5_id,
+                 const std::string &hdf5_path,
+                 Schema &schema)
+{
+    // disable hdf5 error stack
+    HDF5ErrorStackSuppressor supress_hdf5_errors;
+
+    hid_t h5_child_obj  = H5Oopen(hdf5_id,
+                                  hdf5_path.c_str(),
+                                  H5P_DEFAULT);
+
+    CONDUIT_CHECK_HDF5_ERROR_WITH_FILE_AND_REF_PATH(h5_child_obj,
+                                                    hdf5_id,
+                                                    hdf5_path,
+                            "Failed to fetch HDF5 object from: "
+                             << hdf5_id << ":" << hdf5_path);
+
+    Schema s_read;
+    read_hdf5_tree_into_conduit_schema(h5_child_obj,
+                                       hdf5_path,
+                                       s_read);
+
+    CONDUIT_CHECK_HDF5_ERROR_WITH_FILE_AND_REF_PATH(H5Oclose(h5_child_obj),
+                                                    hdf5_id,
+                                                    hdf5_path,
+                             "Failed to close HDF5 Object: "
+                             << h5_child_obj);
+
+    // leaves are read with zero offsets, compact them to describe
+    // the layout hdf5_read would produce
+    s_read.compact_to(schema);
+
+    // restore hdf5 error stack
+}
+
+//---------------------------------------------------------------------------//
+void
+hdf5_read_schema(hid_t hdf5_id,
+                 Schema &schema)
+{
+    // disable hdf5 error stack
+    HDF5ErrorStackSuppressor supress_hdf5_errors;
+
+    Schema s_read;
+    read_hdf5_tree_into_conduit_schema(hdf5_id,
+                                       "",
+                                       s_read);
+    s_read.compact_to(schema);
+
+    // restore hdf5 error stack
+}
+
+//---------------------------------------------------------------------------//
+void
+hdf5_read_schema(const std::string &file_path,
+                 const std::string &hdf5_path,
+                 Schema &schema)
+{
+    // note: hdf5 error stack is suppressed in these calls
+
+    // open the hdf5 file for reading
+    hid_t h5_file_id = hdf5_open_file_for_read(file_path);
+
+    hdf5_read_schema(h5_file_id,
+                     hdf5_path,
+                     schema);
+
+    // close the hdf5 file
+    CONDUIT_CHECK_HDF5_ERROR(H5Fclose(h5_file_id),
+                             "Error closing HDF5 file: " << file_path);
+}
+
+//---------------------------------------------------------------------------//
+void
+hdf5_read_schema(const std::string &path,
+                 Schema &schema)
+{
+    // check for ":" split
+    std::string file_path;
+    std::string hdf5_path;
+
+    conduit::utils::split_file_path(path,
+                                    std::string(":"),
+                                    file_path,
+                                    hdf5_path);
+
+    // We will read the root if no hdf5_path is given.
+    if(hdf5_path.size() == 0)
+    {
+        hdf5_path = "/";
+    }
+
+    // note: hdf5 error stack is suppressed in this call
+    hdf5_read_schema(file_path,
+                     hdf5_path,
+                     schema);
+}
+
+
 //---------------------------------------------------------------------------//
 bool
 hdf5_has_path(hid_t hdf5_id,
@@ -377,6 +377,39 @@ void CONDUIT_RELAY_API hdf5_read_info(hid_t hdf5_id,
                                  const Node &opts,
                                  Node &node);
 
+//-----------------------------------------------------------------------------
+/// Read the schema (dtypes and extents) of the hdf5 tree at given path,
+/// without reading any data. The result is compact and matches the schema
+/// of the node hdf5_read would produce.
+///
+/// This methods supports a file system and hdf5 path, joined using a ":"
+///  ex: "/path/on/file/system.hdf5:/path/inside/hdf5/file"
+///
+/// Note: Variable length strings are read to find their length.
+//-----------------------------------------------------------------------------
+void CONDUIT_RELAY_API hdf5_read_schema(const std::string &path,
+                                        Schema &schema);
+
+//-----------------------------------------------------------------------------
+/// Read schema from given file system path and internal hdf5 path
+//-----------------------------------------------------------------------------
+void CONDUIT_RELAY_API hdf5_read_schema(const std::string &file_path,
+                                        const std::string &hdf5_path,
+                                        Schema &schema);
+
+//-----------------------------------------------------------------------------
+/// Read schema from hdf5 path relative to the hdf5 id
+//-----------------------------------------------------------------------------
+void CONDUIT_RELAY_API hdf5_read_schema(hid_t hdf5_id,
+                                        const std::string &hdf5_path,
+                                        Schema &schema);
+
+//-----------------------------------------------------------------------------
+/// Read schema from hdf5 id
+//-----------------------------------------------------------------------------
+void CONDUIT_RELAY_API hdf5_read_schema(hid_t hdf5_id,
+                                        Schema &schema);
+
 //-----------------------------------------------------------------------------
 /// Helpers for converting between hdf5 dtypes and conduit dtypes
 ///
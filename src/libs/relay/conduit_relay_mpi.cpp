@@ -12,6 +12,8 @@
 #include <algorithm>
 #include <iostream>
 #include <limits>
+#include <map>
+#include <mutex>
 
 //-----------------------------------------------------------------------------
 /// The CONDUIT_CHECK_MPI_ERROR macro is used to check return values for 
@@ -525,6 +527,49 @@ int safe_tag(int tag, MPI_Comm comm)
     return newtag;
 }
 
+//---------------------------------------------------------------------------//
+// Returns schema.to_binary(), where `schema` is `src_schema` or (if
+// `compacted`) its compact version. Results are cached using the source
+// schema's fingerprint, so steady state exchanges of data with an
+// unchanged schema skip schema encoding. Fingerprints can collide, so
+// a hit is only used if the cached source schema equals `src_schema`.
+//---------------------------------------------------------------------------//
+static std::vector<uint8>
+schema_to_binary_cached(const Schema &src_schema,
+                        bool compacted,
+                        const Schema &schema)
+{
+    // keep the cache small, it is cleared when full
+    static const size_t max_cache_entries = 64;
+    static std::mutex cache_mutex;
+    typedef std::pair<Schema, std::vector<uint8> > CacheEntry;
+    static std::map<std::pair<uint64,bool>, CacheEntry> cache;
+
+    std::pair<uint64,bool> key(src_schema.fingerprint(),compacted);
+    {
+        std::lock_guard<std::mutex> lock(cache_mutex);
+        std::map<std::pair<uint64,bool>, CacheEntry>::const_iterator itr;
+        itr = cache.find(key);
+        if(itr != cache.end() && itr->second.first.equals(src_schema))
+        {
+            return itr->second.second;
+        }
+    }
+
+    std::vector<uint8> res;
+    schema.to_binary(res);
+
+    std::lock_guard<std::mutex> lock(cache_mutex);
+    if(cache.size() >= max_cache_entries)
+    {
+        cache.clear();
+    }
+    CacheEntry &entry = cache[key];
+    entry.first  = src_schema;
+    entry.second = res;
+    return res;
+}
+
 //---------------------------------------------------------------------------//
 int 
 send_using_schema(const Node &node, int dest, int tag, MPI_Comm comm)
@@ -541,11 +586,14 @@ send_using_schema(const Node &node, int dest, int tag, MPI_Comm comm)
         node.schema().compact_to(s_data_compact);
     }
     
-    std::string snd_schema_json = s_data_compact.to_json();
+    std::vector<uint8> snd_schema_bin = schema_to_binary_cached(node.schema(),
+                                                                !(node.is_compact() &&
+                                                                  node.is_contiguous()),
+                                                                s_data_compact);
         
     Schema s_msg;
     s_msg["schema_len"].set(DataType::int64());
-    s_msg["schema"].set(DataType::char8_str(snd_schema_json.size()+1));
+    s_msg["schema"].set(DataType::uint8(snd_schema_bin.size()));
     s_msg["data"].set(s_data_compact);
     
     // create a compact schema to use
@@ -554,8 +602,8 @@ send_using_schema(const Node &node, int dest, int tag, MPI_Comm comm)
     
     Node n_msg(s_msg_compact);
     // these sets won't realloc since schemas are compatible
-    n_msg["schema_len"].set((int64)snd_schema_json.length());
-    n_msg["schema"].set(snd_schema_json);
+    n_msg["schema_len"].set((int64)snd_schema_bin.size());
+    n_msg["schema"].set(snd_schema_bin);
     n_msg["data"].update(node);
 
     
@@ -608,18 +656,15 @@ recv_using_schema(Node &node, int src, int tag, MPI_Comm comm)
 
     Node n_msg;
     // length of the schema is sent as a 64-bit signed int
-    // NOTE: we aren't using this value  ... 
     n_msg["schema_len"].set_external((int64*)n_buff_ptr);
     n_buff_ptr +=8;
-    // wrap the schema string
-    n_msg["schema"].set_external_char8_str((char*)(n_buff_ptr));
-    // create the schema
+    index_t schema_len = (index_t)n_msg["schema_len"].as_int64();
+    // create the schema from its binary encoding
     Schema rcv_schema;
-    Generator gen(n_msg["schema"].as_char8_str());
-    gen.walk(rcv_schema);
+    rcv_schema.from_binary(n_buff_ptr,schema_len);
 
     // advance by the schema length
-    n_buff_ptr += n_msg["schema"].total_bytes_compact();
+    n_buff_ptr += schema_len;
     
     // apply the schema to the data
     n_msg["data"].set_external(rcv_schema,n_buff_ptr);
@@ -658,18 +703,15 @@ recv_using_schema(Node &node, MPI_Comm comm)
 
     Node n_msg;
     // length of the schema is sent as a 64-bit signed int
-    // NOTE: we aren't using this value  ... 
     n_msg["schema_len"].set_external((int64*)n_buff_ptr);
     n_buff_ptr +=8;
-    // wrap the schema string
-    n_msg["schema"].set_external_char8_str((char*)(n_buff_ptr));
-    // create the schema
+    index_t schema_len = (index_t)n_msg["schema_len"].as_int64();
+    // create the schema from its binary encoding
     Schema rcv_schema;
-    Generator gen(n_msg["schema"].as_char8_str());
-    gen.walk(rcv_schema);
+    rcv_schema.from_binary(n_buff_ptr,schema_len);
 
     // advance by the schema length
-    n_buff_ptr += n_msg["schema"].total_bytes_compact();
+    n_buff_ptr += schema_len;
     
     // apply the schema to the data
     n_msg["data"].set_external(rcv_schema,n_buff_ptr);
@@ -680,6 +722,51 @@ recv_using_schema(Node &node, MPI_Comm comm)
     return mpi_error;
 }
 
+//---------------------------------------------------------------------------//
+// creates an mpi datatype (of absolute addresses, use with MPI_BOTTOM) that
+// describes the pieces from Node::serialize_iov. Returns false if the
+// pieces cannot be described with int sized counts.
+//---------------------------------------------------------------------------//
+static bool
+create_iov_mpi_dtype(const std::vector<std::pair<const void*,index_t> > &iov,
+                     MPI_Datatype &iov_dtype)
+{
+    if(iov.empty() ||
+       !conduit::utils::value_fits<size_t,int>(iov.size()))
+    {
+        return false;
+    }
+
+    std::vector<int>      block_lens(iov.size());
+    std::vector<MPI_Aint> block_displs(iov.size());
+    for(size_t i = 0; i < iov.size(); i++)
+    {
+        if(!conduit::utils::value_fits<index_t,int>(iov[i].second))
+        {
+            return false;
+        }
+        block_lens[i] = static_cast<int>(iov[i].second);
+        MPI_Get_address(const_cast<void*>(iov[i].first), &block_displs[i]);
+    }
+
+    if(MPI_Type_create_hindexed(static_cast<int>(iov.size()),
+                                &block_lens[0],
+                                &block_displs[0],
+                                MPI_BYTE,
+                                &iov_dtype) != MPI_SUCCESS)
+    {
+        return false;
+    }
+
+    if(MPI_Type_commit(&iov_dtype) != MPI_SUCCESS)
+    {
+        MPI_Type_free(&iov_dtype);
+        return false;
+    }
+
+    return true;
+}
+
 //---------------------------------------------------------------------------//
 int 
 send(const Node &node, int dest, int tag, MPI_Comm comm)
@@ -694,8 +781,30 @@ send(const Node &node, int dest, int tag, MPI_Comm comm)
     if( snd_ptr == NULL ||
         ! node.is_compact())
     {
-         node.compact_to(snd_compact);
-         snd_ptr = snd_compact.data_ptr();
+        // send the leaves in place using a derived datatype, only
+        // non compact leaves are copied (into a staging buffer)
+        std::vector<std::pair<const void*,index_t> > iov;
+        std::vector<uint8> staging;
+        node.serialize_iov(iov,staging);
+
+        MPI_Datatype iov_dtype;
+        if(create_iov_mpi_dtype(iov,iov_dtype))
+        {
+            int mpi_error = MPI_Send(MPI_BOTTOM,
+                                     1,
+                                     iov_dtype,
+                                     dest,
+                                     tag,
+                                     comm);
+            MPI_Type_free(&iov_dtype);
+
+            CONDUIT_CHECK_MPI_ERROR(mpi_error);
+
+            return mpi_error;
+        }
+
+        node.compact_to(snd_compact);
+        snd_ptr = snd_compact.data_ptr();
     }
 
     if(!conduit::utils::value_fits<index_t,int>(snd_size))
@@ -1468,9 +1577,11 @@ gather_using_schema(Node &send_node,
     int m_size = mpi::size(mpi_comm);
     int m_rank = mpi::rank(mpi_comm);
 
-    std::string schema_str = n_snd_compact.schema().to_json();
+    std::vector<uint8> schema_bin = schema_to_binary_cached(send_node.schema(),
+                                                            true,
+                                                            n_snd_compact.schema());
 
-    int schema_len = static_cast<int>(schema_str.length() + 1);
+    int schema_len = static_cast<int>(schema_bin.size());
     int data_len   = static_cast<int>(n_snd_compact.total_bytes_compact());
     
     // to do the conduit gatherv, first need a gather to get the 
@@ -1553,7 +1664,7 @@ gather_using_schema(Node &send_node,
         schema_rcv_buff = n_rcv_tmp["schemas/data"].value();
     }
 
-    mpi_error = MPI_Gatherv( const_cast <char*>(schema_str.c_str()),
+    mpi_error = MPI_Gatherv( schema_bin.data(),
                              schema_len,
                              MPI_BYTE,
                              schema_rcv_buff,
@@ -1565,7 +1676,7 @@ gather_using_schema(Node &send_node,
 
     CONDUIT_CHECK_MPI_ERROR(mpi_error);
 
-    // build all schemas from JSON, compact them.
+    // build all schemas from their binary encodings, compact them.
     Schema rcv_schema;
     if( m_rank == root )
     {
@@ -1576,7 +1687,8 @@ gather_using_schema(Node &send_node,
         for(int i=0;i < m_size; i++)
         {
             Schema &s = s_tmp.append();
-            s.set(&schema_rcv_buff[schema_rcv_displs[i]]);
+            s.from_binary(&schema_rcv_buff[schema_rcv_displs[i]],
+                          schema_rcv_counts[i]);
         }
         
         s_tmp.compact_to(rcv_schema);
@@ -1617,9 +1729,11 @@ all_gather_using_schema(Node &send_node,
 
     int m_size = mpi::size(mpi_comm);
 
-    std::string schema_str = n_snd_compact.schema().to_json();
+    std::vector<uint8> schema_bin = schema_to_binary_cached(send_node.schema(),
+                                                            true,
+                                                            n_snd_compact.schema());
 
-    int schema_len = static_cast<int>(schema_str.length() + 1);
+    int schema_len = static_cast<int>(schema_bin.size());
     int data_len   = static_cast<int>(n_snd_compact.total_bytes_compact());
     
     // to do the conduit gatherv, first need a gather to get the 
@@ -1697,7 +1811,7 @@ all_gather_using_schema(Node &send_node,
     n_rcv_tmp["schemas/data"].set(DataType::c_char(schema_curr_displ));
     schema_rcv_buff = n_rcv_tmp["schemas/data"].value();
 
-    mpi_error = MPI_Allgatherv( const_cast <char*>(schema_str.c_str()),
+    mpi_error = MPI_Allgatherv( schema_bin.data(),
                                 schema_len,
                                 MPI_BYTE,
                                 schema_rcv_buff,
@@ -1708,7 +1822,7 @@ all_gather_using_schema(Node &send_node,
 
     CONDUIT_CHECK_MPI_ERROR(mpi_error);
 
-    // build all schemas from JSON, compact them.
+    // build all schemas from their binary encodings, compact them.
     Schema rcv_schema;
     //TODO: should we make it easer to create a compact schema?
     // TODO: Revisit, I think we can do this better
@@ -1716,7 +1830,8 @@ all_gather_using_schema(Node &send_node,
     for(int s_idx=0; s_idx < m_size; s_idx++)
     {
         Schema &s_new = s_tmp.append();
-        s_new.set(&schema_rcv_buff[schema_rcv_displs[s_idx]]);
+        s_new.from_binary(&schema_rcv_buff[schema_rcv_displs[s_idx]],
+                          schema_rcv_counts[s_idx]);
     }
     
     // TODO can we support copy out w/out realloc
@@ -1834,7 +1949,9 @@ broadcast_using_schema(Node &node,
            node.is_compact() && 
            node.is_contiguous())
         {
-            bcast_buffers["schema"] = node.schema().to_json();
+            bcast_buffers["schema"].set(schema_to_binary_cached(node.schema(),
+                                                                false,
+                                                                node.schema()));
         }
         else
         {
@@ -1842,7 +1959,9 @@ broadcast_using_schema(Node &node,
             node.compact_to(bcast_data_compact);
             
             bcast_data_ptr  = bcast_data_compact.data_ptr();
-            bcast_buffers["schema"] =  bcast_data_compact.schema().to_json();
+            bcast_buffers["schema"].set(schema_to_binary_cached(node.schema(),
+                                                                true,
+                                                                bcast_data_compact.schema()));
         }
      
 
@@ -1864,13 +1983,13 @@ broadcast_using_schema(Node &node,
     // alloc for rcv for schema
     if(rank != root)
     {
-        bcast_buffers["schema"].set(DataType::char8_str(bcast_schema_size));
+        bcast_buffers["schema"].set(DataType::uint8(bcast_schema_size));
     }
 
     // broadcast the schema 
     mpi_error = MPI_Bcast(bcast_buffers["schema"].data_ptr(),
                           bcast_schema_size,
-                          MPI_CHAR,
+                          MPI_BYTE,
                           root,
                           comm);
 
@@ -1882,8 +2001,8 @@ broadcast_using_schema(Node &node,
     if(rank != root)
     {
         Schema bcast_schema;
-        Generator gen(bcast_buffers["schema"].as_char8_str());
-        gen.walk(bcast_schema);
+        bcast_schema.from_binary(bcast_buffers["schema"].data_ptr(),
+                                 bcast_schema_size);
         
         // only check compat for leaves
         // there are more zero copy cases possible here, but
@@ -2103,11 +2222,14 @@ communicate_using_schema::execute_internal()
                 node.schema().compact_to(s_data_compact);
             }
     
-            std::string snd_schema_json = s_data_compact.to_json();
+            std::vector<uint8> snd_schema_bin = schema_to_binary_cached(node.schema(),
+                                                                        !(node.is_compact() &&
+                                                                          node.is_contiguous()),
+                                                                        s_data_compact);
         
             Schema s_msg;
             s_msg["schema_len"].set(DataType::int64());
-            s_msg["schema"].set(DataType::char8_str(snd_schema_json.size()+1));
+            s_msg["schema"].set(DataType::uint8(snd_schema_bin.size()));
             s_msg["data"].set(s_data_compact);
     
             // create a compact schema to use
@@ -2118,8 +2240,8 @@ communicate_using_schema::execute_internal()
             operations[i].free[1] = true;
             Node &n_msg = *operations[i].node[1];
             // these sets won't realloc since schemas are compatible
-            n_msg["schema_len"].set((int64)snd_schema_json.length());
-            n_msg["schema"].set(snd_schema_json);
+            n_msg["schema_len"].set((int64)snd_schema_bin.size());
+            n_msg["schema"].set(snd_schema_bin);
             n_msg["data"].update(node);
 
             // Send the serialized node data.
@@ -2244,18 +2366,15 @@ communicate_using_schema::execute_internal()
 
             Node n_msg;
             // length of the schema is sent as a 64-bit signed int
-            // NOTE: we aren't using this value  ... 
             n_msg["schema_len"].set_external((int64*)n_buff_ptr);
             n_buff_ptr +=8;
-            // wrap the schema string
-            n_msg["schema"].set_external_char8_str((char*)(n_buff_ptr));
-            // create the schema
+            index_t schema_len = (index_t)n_msg["schema_len"].as_int64();
+            // create the schema from its binary encoding
             Schema rcv_schema;
-            Generator gen(n_msg["schema"].as_char8_str());
-            gen.walk(rcv_schema);
+            rcv_schema.from_binary(n_buff_ptr,schema_len);
 
             // advance by the schema length
-            n_buff_ptr += n_msg["schema"].total_bytes_compact();
+            n_buff_ptr += schema_len;
     
             // apply the schema to the data
             n_msg["data"].set_external(rcv_schema,n_buff_ptr);
@@ -532,6 +532,50 @@ PyRelay_IOHandle_has_path(PyRelay_IOHandle *self,
         Py_RETURN_FALSE;
 }
 
+//-----------------------------------------------------------------------------
+// returns the schema as a json string, since the conduit python capsule
+// api only provides access to Nodes
+static PyObject *
+PyRelay_IOHandle_read_schema(PyRelay_IOHandle *self,
+                             PyObject *args,
+                             PyObject *kwargs)
+{
+    static const char *kwlist[] = {"path", NULL};
+    char *path = NULL;
+
+    if (!PyArg_ParseTupleAndKeywords(args,
+                                     kwargs,
+                                     "|s",
+                                     const_cast<char**>(kwlist),
+                                     &path))
+    {
+        return NULL;
+    }
+
+    Schema schema;
+
+    try
+    {
+        if(path == NULL)
+        {
+            self->handle->read_schema(schema);
+        }
+        else
+        {
+            self->handle->read_schema(std::string(path),
+                                      schema);
+        }
+    }
+    catch(conduit::Error &e)
+    {
+        PyErr_SetString(PyExc_IOError,
+                        e.message().c_str());
+        return NULL;
+    }
+
+    return PyString_FromString(schema.to_json().c_str());
+}
+
 //-----------------------------------------------------------------------------
 static PyObject *
 PyRelay_IOHandle_remove(PyRelay_IOHandle *self,
@@ -566,6 +610,24 @@ PyRelay_IOHandle_remove(PyRelay_IOHandle *self,
     Py_RETURN_NONE; 
 }
 
+//-----------------------------------------------------------------------------
+static PyObject *
+PyRelay_IOHandle_flush(PyRelay_IOHandle *self)
+{
+    try
+    {
+        self->handle->flush();
+    }
+    catch(conduit::Error &e)
+    {
+        PyErr_SetString(PyExc_IOError,
+                        e.message().c_str());
+        return NULL;
+    }
+
+    Py_RETURN_NONE; 
+}
+
 //-----------------------------------------------------------------------------
 static PyObject *
 PyRelay_IOHandle_close(PyRelay_IOHandle *self)
@@ -618,6 +680,14 @@ static PyMethodDef PyRelay_IOHandle_METHODS[] = {
      (PyCFunction)PyRelay_IOHandle_has_path,
      METH_VARARGS | METH_KEYWORDS,
      "Checks if a path exists"},
+    {"read_schema",
+     (PyCFunction)PyRelay_IOHandle_read_schema,
+     METH_VARARGS | METH_KEYWORDS,
+     "Returns the schema (as json) of a path, without reading data"},
+    {"flush",
+     (PyCFunction)PyRelay_IOHandle_flush,
+      METH_NOARGS,
+     "Waits for pending async writes"},
     {"close",
      (PyCFunction)PyRelay_IOHandle_close,
       METH_NOARGS,
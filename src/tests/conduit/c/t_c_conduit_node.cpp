@@ -572,6 +572,29 @@ TEST(c_conduit_node, c_fetch_existing)
     conduit_node_destroy(n);
 }
 
+//-----------------------------------------------------------------------------
+TEST(c_conduit_node, c_fetch_compiled_path)
+{
+    conduit_node *n = conduit_node_create();
+    conduit_path *p = conduit_path_create("normal/path");
+
+    EXPECT_EQ(conduit_path_number_of_segments(p),2);
+    EXPECT_FALSE(conduit_node_has_compiled_path(n,p));
+
+    conduit_node *n_1 = conduit_node_fetch_compiled_path(n,p);
+    conduit_node_set_int(n_1,10);
+
+    EXPECT_TRUE(conduit_node_has_compiled_path(n,p));
+
+    conduit_node *n_2 = conduit_node_fetch_existing_compiled_path(n,p);
+    EXPECT_EQ(n_1,n_2);
+    EXPECT_EQ(n_2,conduit_node_fetch_existing(n,"normal/path"));
+    EXPECT_EQ(conduit_node_as_int(n_2),10);
+
+    conduit_path_destroy(p);
+    conduit_node_destroy(n);
+}
+
 //-----------------------------------------------------------------------------
 TEST(c_conduit_node, c_reset)
 {
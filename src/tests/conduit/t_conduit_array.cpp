@@ -10,6 +10,7 @@
 
 #include "conduit.hpp"
 
+#include <cmath>
 #include <iostream>
 #include "gtest/gtest.h"
 
@@ -955,8 +956,190 @@ TEST(conduit_array, summary_stats)
     EXPECT_EQ(va_float64.sum(),0.0);
     EXPECT_EQ(va_float64.count(0.0),1);
 
+    int64 i_min, i_max;
+    va_int64.minmax(i_min,i_max);
+    EXPECT_EQ(i_min,-1);
+    EXPECT_EQ(i_max,1);
+    EXPECT_EQ(va_int64.kahan_sum(),0);
+
+    float64 f_min, f_max;
+    va_float64.minmax(f_min,f_max);
+    EXPECT_EQ(f_min,-1.0);
+    EXPECT_EQ(f_max,1.0);
+    EXPECT_EQ(va_float64.kahan_sum(),0.0);
 }
 
+//-----------------------------------------------------------------------------
+TEST(conduit_array, summary_stats_strided)
+{
+    // interleaved values, stats over every other element
+    // (odd lengths exercise the kernel remainder loops)
+    std::vector<float32> v_float32(2 * 37, 100.0f);
+    std::vector<int32>   v_int32(2 * 37, 100);
+    for(int i=0; i < 37; i++)
+    {
+        v_float32[2*i] = (float32) (i - 18);
+        v_int32[2*i]   = i - 18;
+    }
+
+    float32_array va_float32(&v_float32[0],
+                             DataType::float32(37,0,2*sizeof(float32)));
+    int32_array   va_int32(&v_int32[0],
+                           DataType::int32(37,0,2*sizeof(int32)));
+
+    EXPECT_EQ(va_float32.min(),-18.0f);
+    EXPECT_EQ(va_float32.max(),18.0f);
+    EXPECT_EQ(va_float32.sum(),0.0f);
+    EXPECT_EQ(va_float32.kahan_sum(),0.0f);
+    EXPECT_EQ(va_float32.mean(),0.0);
+    EXPECT_EQ(va_float32.count(100.0f),0);
+    EXPECT_EQ(va_float32.count(5.0f),1);
+
+    int32 i_min, i_max;
+    va_int32.minmax(i_min,i_max);
+    EXPECT_EQ(i_min,-18);
+    EXPECT_EQ(i_max,18);
+    EXPECT_EQ(va_int32.sum(),0);
+    EXPECT_EQ(va_int32.count(100),0);
+
+    // offset into the other set of values
+    int32_array va_int32_off(&v_int32[0],
+                             DataType::int32(37,sizeof(int32),2*sizeof(int32)));
+    EXPECT_EQ(va_int32_off.min(),100);
+    EXPECT_EQ(va_int32_off.max(),100);
+    EXPECT_EQ(va_int32_off.sum(),3700);
+    EXPECT_EQ(va_int32_off.count(100),37);
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_array, summary_stats_kahan_sum)
+{
+    // 1 followed by many values that are (mostly) lost to round off
+    // in a plain float32 sum
+    index_t num_vals = 10001;
+    Node n;
+    n.set(DataType::float32(num_vals));
+    float32_array vals = n.value();
+    vals.fill(1.0e-8f);
+    vals[0] = 1.0f;
+
+    float64 expected = 1.0 + 1.0e-8 * (num_vals - 1);
+    float64 sum_err   = std::abs(vals.sum() - expected);
+    float64 kahan_err = std::abs(vals.kahan_sum() - expected);
+
+    EXPECT_NEAR(vals.kahan_sum(),expected,1.0e-7);
+    EXPECT_LT(kahan_err,sum_err);
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_array, summary_stats_long)
+{
+    index_t num_vals = 1 << 15;
+    Node n;
+    n.set(DataType::float64(num_vals));
+    float64_array vals = n.value();
+    for(index_t i=0; i < num_vals; i++)
+    {
+        vals[i] = (float64)(i % 1000) - 500.0;
+    }
+
+    float64 mm_min, mm_max;
+    vals.minmax(mm_min,mm_max);
+
+    EXPECT_EQ(vals.min(),-500.0);
+    EXPECT_EQ(vals.max(),499.0);
+    EXPECT_EQ(mm_min,-500.0);
+    EXPECT_EQ(mm_max,499.0);
+    EXPECT_EQ(vals.sum(),vals.kahan_sum());
+}
+
+
+//-----------------------------------------------------------------------------
+TEST(conduit_array, gather_scatter)
+{
+    std::vector<float64> src_vals = {0.0, 10.0, 20.0, 30.0, 40.0};
+    float64_array src(src_vals.data(),DataType::float64(5));
+
+    // int32 indices
+    std::vector<int32> ids = {4, 0, 2};
+    int32_array ids_arr(ids.data(),DataType::int32(3));
+    index_t_accessor ids_acc(ids.data(),DataType::int32(3));
+
+    Node n_dest;
+    n_dest.set(DataType::float64(3));
+    float64_array dest = n_dest.value();
+    dest.gather(src,ids_acc);
+    EXPECT_EQ(dest[0],40.0);
+    EXPECT_EQ(dest[1],0.0);
+    EXPECT_EQ(dest[2],20.0);
+
+    // scatter back into a strided array
+    std::vector<float64> res_vals(10,-1.0);
+    float64_array res(res_vals.data(),
+                      DataType::float64(5,0,2*sizeof(float64)));
+    dest.scatter(res,ids_acc);
+    EXPECT_EQ(res_vals[8],40.0);
+    EXPECT_EQ(res_vals[0],0.0);
+    EXPECT_EQ(res_vals[4],20.0);
+    EXPECT_EQ(res_vals[2],-1.0);
+    EXPECT_EQ(res_vals[1],-1.0);
+
+    // index_t indices, gather from strided
+    std::vector<index_t> ids_idx = {1, 3};
+    index_t_accessor ids_idx_acc(ids_idx.data(),DataType::index_t(2));
+    dest.gather(res,ids_idx_acc);
+    EXPECT_EQ(dest[0],-1.0);
+    EXPECT_EQ(dest[1],-1.0);
+
+    // out of range indices
+    std::vector<int32> bad_ids = {0, 5};
+    index_t_accessor bad_ids_acc(bad_ids.data(),DataType::int32(2));
+    EXPECT_THROW(dest.gather(src,bad_ids_acc),conduit::Error);
+    EXPECT_THROW(dest.scatter(src,bad_ids_acc),conduit::Error);
+
+    // too many indices for dest
+    std::vector<int32> many_ids = {0, 1, 2, 3};
+    index_t_accessor many_ids_acc(many_ids.data(),DataType::int32(4));
+    EXPECT_THROW(dest.gather(src,many_ids_acc),conduit::Error);
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_array, set_converting_long)
+{
+    index_t num_vals = 1 << 15;
+    Node n_src;
+    n_src.set(DataType::int32(num_vals));
+    int32_array src = n_src.value();
+    for(index_t i=0; i < num_vals; i++)
+    {
+        src[i] = (int32) i;
+    }
+
+    Node n_dest;
+    n_dest.set(DataType::int64(num_vals));
+    int64_array dest = n_dest.value();
+    dest.set(src);
+
+    EXPECT_EQ(dest[0],0);
+    EXPECT_EQ(dest[num_vals/2],num_vals/2);
+    EXPECT_EQ(dest[num_vals-1],num_vals-1);
+
+    Node n_res;
+    n_src.to_data_type(DataType::FLOAT64_ID,n_res);
+    EXPECT_EQ(n_res.as_float64_array()[num_vals-1],(float64)(num_vals-1));
+
+    // strided source
+    Node n_strided;
+    n_strided.set_external(DataType::int32(num_vals/2,0,2*sizeof(int32)),
+                           n_src.data_ptr());
+    int32_array src_strided = n_strided.value();
+    Node n_dest_strided;
+    n_dest_strided.set(DataType::int64(num_vals/2));
+    int64_array dest_strided = n_dest_strided.value();
+    dest_strided.set(src_strided);
+    EXPECT_EQ(dest_strided[1],2);
+    EXPECT_EQ(dest_strided[num_vals/2-1],num_vals-2);
+}
 
 //-----------------------------------------------------------------------------
 TEST(conduit_array, summary_print)
@@ -271,6 +271,55 @@ TEST(conduit_data_accessor, fill)
 
 
 
+//-----------------------------------------------------------------------------
+TEST(conduit_data_accessor, fill_dest)
+{
+    Node n;
+    n.set(DataType::int32(8));
+    int32_array arr = n.value();
+    for(index_t i=0;i<8;i++)
+    {
+        arr[i] = (int32)(i * 10);
+    }
+
+    // contiguous, converting to int64
+    int64_accessor acc = n.value();
+    std::vector<int64> dest(8,-1);
+    acc.fill(dest.data(),0,8);
+    for(index_t i=0;i<8;i++)
+    {
+        EXPECT_EQ(dest[i],i * 10);
+    }
+
+    // sub range
+    dest.assign(8,-1);
+    acc.fill(dest.data(),2,5);
+    EXPECT_EQ(dest[0],20);
+    EXPECT_EQ(dest[2],40);
+    EXPECT_EQ(dest[3],-1);
+
+    // strided, every other value
+    float64_accessor acc_strided(n.data_ptr(),
+                                 DataType::int32(4,0,2*sizeof(int32)));
+    std::vector<float64> f_dest(4,-1.0);
+    acc_strided.fill(f_dest.data(),0,4);
+    EXPECT_EQ(f_dest[0],0.0);
+    EXPECT_EQ(f_dest[1],20.0);
+    EXPECT_EQ(f_dest[3],60.0);
+
+    // same type (memcpy)
+    int32_accessor acc_i32 = n.value();
+    std::vector<int32> i_dest(8,-1);
+    acc_i32.fill(i_dest.data(),0,8);
+    EXPECT_EQ(i_dest[7],70);
+
+    // empty range is a no-op
+    acc.fill(dest.data(),8,8);
+
+    EXPECT_THROW(acc.fill(dest.data(),0,9),conduit::Error);
+    EXPECT_THROW(acc.fill(dest.data(),4,2),conduit::Error);
+}
+
 //-----------------------------------------------------------------------------
 TEST(conduit_data_accessor, to_string)
 {
@@ -291,3 +340,139 @@ TEST(conduit_data_accessor, to_string)
 
 
 
+//-----------------------------------------------------------------------------
+TEST(conduit_data_accessor, visit)
+{
+    Node n;
+    n.set(DataType::int16(5));
+    int16_array arr = n.value();
+    for(index_t i=0;i<5;i++)
+    {
+        arr[i] = (int16)(i + 1);
+    }
+
+    index_t_accessor acc = n.value();
+
+    bool contiguous = false;
+    index_t res = acc.visit([&](const auto &vals)
+    {
+        contiguous = vals.is_contiguous;
+        index_t sum = 0;
+        for(index_t i = 0; i < vals.number_of_elements(); i++)
+        {
+            sum += vals[i];
+        }
+        return sum;
+    });
+
+    EXPECT_TRUE(contiguous);
+    EXPECT_EQ(res,15);
+    EXPECT_EQ(acc.sum(),15);
+    EXPECT_EQ(acc.min(),1);
+    EXPECT_EQ(acc.max(),5);
+    EXPECT_EQ(acc.count(3),1);
+
+    // strided view of every other value
+    int16_accessor acc_strided(n.data_ptr(),
+                               DataType::int16(2,sizeof(int16),2*sizeof(int16)));
+    res = acc_strided.visit([&](const auto &vals)
+    {
+        contiguous = vals.is_contiguous;
+        index_t sum = 0;
+        for(index_t i = 0; i < vals.number_of_elements(); i++)
+        {
+            sum += vals[i];
+        }
+        return sum;
+    });
+
+    EXPECT_FALSE(contiguous);
+    EXPECT_EQ(res,6);
+    EXPECT_EQ(acc_strided.sum(),6);
+    EXPECT_EQ(acc_strided.mean(),3.0);
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_data_accessor, dispatch_array)
+{
+    Node n;
+    n.set(DataType::float32(4));
+    float32_array arr = n.value();
+    arr.fill(2.0f);
+
+    // non-const node: views allow modifying values
+    dispatch_array(n, [](const auto &vals)
+    {
+        for(index_t i = 0; i < vals.number_of_elements(); i++)
+        {
+            vals[i] *= 2;
+        }
+    });
+
+    EXPECT_EQ(arr[0],4.0f);
+    EXPECT_EQ(arr[3],4.0f);
+
+    const Node &n_const = n;
+    float64 res = dispatch_array(n_const, [](const auto &vals)
+    {
+        float64 sum = 0;
+        for(index_t i = 0; i < vals.number_of_elements(); i++)
+        {
+            sum += vals[i];
+        }
+        return sum;
+    });
+    EXPECT_EQ(res,16.0);
+
+    // empty nodes are visited as empty views
+    Node n_empty;
+    index_t num_ele = dispatch_array(n_empty, [](const auto &vals)
+    {
+        return vals.number_of_elements();
+    });
+    EXPECT_EQ(num_ele,0);
+
+    // non numeric types are an error
+    Node n_str;
+    n_str.set("mystring");
+    EXPECT_THROW(dispatch_array(n_str, [](const auto &vals)
+                                {
+                                    return vals.number_of_elements();
+                                }),
+                 conduit::Error);
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_data_accessor, visit_matches_element_access)
+{
+    index_t num_vals = 1 << 15;
+    Node n;
+    n.set(DataType::int32(num_vals));
+    int32_array arr = n.value();
+    for(index_t i=0; i < num_vals; i++)
+    {
+        arr[i] = (int32)(i % 8);
+    }
+
+    index_t_accessor acc = n.value();
+
+    index_t res_element = 0;
+    for(index_t i=0; i < acc.number_of_elements(); i++)
+    {
+        res_element += acc[i];
+    }
+
+    index_t res_visit = acc.visit([](const auto &vals)
+    {
+        index_t res = 0;
+        for(index_t i = 0; i < vals.number_of_elements(); i++)
+        {
+            res += vals[i];
+        }
+        return res;
+    });
+
+    EXPECT_EQ(res_element,(num_vals / 8) * 28);
+    EXPECT_EQ(res_element,res_visit);
+}
+
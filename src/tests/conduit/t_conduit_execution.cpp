@@ -0,0 +1,369 @@
+// Copyright (c) Lawrence Livermore National Security, LLC and other Conduit
+// Project developers. See top-level LICENSE AND COPYRIGHT files for dates and
+// other details. No copyright assignment is required to contribute to Conduit.
+
+//-----------------------------------------------------------------------------
+///
+/// file: t_conduit_execution.cpp
+///
+//-----------------------------------------------------------------------------
+
+#include "conduit.hpp"
+#include "conduit_execution.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <iostream>
+#include <thread>
+#include <vector>
+#include "gtest/gtest.h"
+
+using namespace conduit;
+namespace task = conduit::execution::task;
+
+//-----------------------------------------------------------------------------
+template <typename Exec>
+void
+check_for_all(index_t n, index_t grain)
+{
+    std::vector<int> vals(n, 0);
+    conduit::execution::for_all<Exec>(0, n, [&](index_t i)
+    {
+        vals[i] += (int)(i % 7) + 1;
+    }, grain);
+
+    for(index_t i = 0; i < n; i++)
+    {
+        EXPECT_EQ(vals[i], (int)(i % 7) + 1);
+    }
+}
+
+//-----------------------------------------------------------------------------
+template <typename Exec>
+void
+check_reduce_chunks(index_t n, index_t grain)
+{
+    std::vector<int64> vals(n);
+    for(index_t i = 0; i < n; i++)
+        vals[i] = i;
+
+    int64 res = conduit::execution::reduce_chunks<Exec>(0, n, (int64)10,
+        [&](index_t b, index_t e)
+        {
+            int64 s = 0;
+            for(index_t i = b; i < e; i++)
+                s += vals[i];
+            return s;
+        },
+        [](int64 lhs, int64 rhs) { return lhs + rhs; },
+        grain);
+
+    EXPECT_EQ(res, (int64)10 + ((int64)n * (n - 1)) / 2);
+}
+
+//-----------------------------------------------------------------------------
+template <typename Exec>
+void
+check_scan_chunks(index_t n, index_t grain)
+{
+    std::vector<index_t> sizes(n);
+    for(index_t i = 0; i < n; i++)
+        sizes[i] = (i % 5) + 1;
+
+    // exclusive scan of sizes
+    std::vector<index_t> offsets(n, -1);
+    index_t total = conduit::execution::scan_chunks<Exec>(0, n, (index_t)0,
+        [&](index_t b, index_t e)
+        {
+            index_t s = 0;
+            for(index_t i = b; i < e; i++)
+                s += sizes[i];
+            return s;
+        },
+        [&](index_t b, index_t e, index_t start)
+        {
+            for(index_t i = b; i < e; i++)
+            {
+                offsets[i] = start;
+                start += sizes[i];
+            }
+            return start;
+        },
+        [](index_t lhs, index_t rhs) { return lhs + rhs; },
+        grain);
+
+    index_t expected = 0;
+    for(index_t i = 0; i < n; i++)
+    {
+        EXPECT_EQ(offsets[i], expected);
+        expected += sizes[i];
+    }
+    EXPECT_EQ(total, expected);
+}
+
+//-----------------------------------------------------------------------------
+template <typename Exec>
+void
+check_sort(index_t n)
+{
+    std::vector<int32> vals(n);
+    uint32 state = 12345;
+    for(index_t i = 0; i < n; i++)
+    {
+        state = state * 1664525u + 1013904223u;
+        vals[i] = (int32)(state >> 8);
+    }
+
+    std::vector<int32> expected(vals);
+    std::sort(expected.begin(), expected.end());
+
+    std::vector<int32> asc(vals);
+    conduit::execution::sort<Exec>(asc.begin(), asc.end());
+    EXPECT_EQ(asc, expected);
+
+    std::vector<int32> desc(vals);
+    conduit::execution::sort<Exec>(desc.begin(), desc.end(),
+                                   [](int32 lhs, int32 rhs)
+                                   { return lhs > rhs; });
+    std::reverse(expected.begin(), expected.end());
+    EXPECT_EQ(desc, expected);
+}
+
+//-----------------------------------------------------------------------------
+template <typename Exec>
+void
+check_algorithms(index_t n)
+{
+    std::vector<int32> sizes(n);
+    for(index_t i = 0; i < n; i++)
+        sizes[i] = (int32)((i * 7) % 11);
+
+    // reduce
+    int64 sum = conduit::execution::reduce<Exec>(0, n, (int64)5,
+                    [&](index_t i) { return (int64)sizes[i]; });
+    int64 max_val = conduit::execution::reduce<Exec>(0, n, (int64)-1,
+                        [&](index_t i) { return (int64)sizes[i]; },
+                        [](int64 lhs, int64 rhs) { return std::max(lhs, rhs); });
+    int64 expected_sum = 5;
+    int64 expected_max = -1;
+    for(index_t i = 0; i < n; i++)
+    {
+        expected_sum += sizes[i];
+        expected_max = std::max(expected_max, (int64)sizes[i]);
+    }
+    EXPECT_EQ(sum, expected_sum);
+    EXPECT_EQ(max_val, expected_max);
+
+    // scans, to a different type and in place
+    std::vector<index_t> offsets(n, -1);
+    index_t total = conduit::execution::exclusive_scan<Exec>(sizes, offsets,
+                                                             n, (index_t)0);
+    std::vector<index_t> ends(n, -1);
+    index_t inc_total = conduit::execution::inclusive_scan<Exec>(sizes, ends,
+                                                                 n, (index_t)0);
+    std::vector<int32> in_place(sizes);
+    conduit::execution::inclusive_scan<Exec>(in_place, in_place.data(),
+                                             n, (int32)10);
+    index_t expected = 0;
+    for(index_t i = 0; i < n; i++)
+    {
+        EXPECT_EQ(offsets[i], expected);
+        expected += sizes[i];
+        EXPECT_EQ(ends[i], expected);
+        EXPECT_EQ(in_place[i], (int32)(expected + 10));
+    }
+    EXPECT_EQ(total, expected);
+    EXPECT_EQ(inc_total, expected);
+
+    // count_if and histogram
+    index_t num_zeros = conduit::execution::count_if<Exec>(0, n,
+                            [&](index_t i) { return sizes[i] == 0; });
+    // the last bin is left out
+    std::vector<index_t> hist = conduit::execution::histogram<Exec>(0, n, 10,
+                                    [&](index_t i) { return sizes[i]; });
+    ASSERT_EQ(hist.size(), 10u);
+    std::vector<index_t> expected_hist(11, 0);
+    for(index_t i = 0; i < n; i++)
+        expected_hist[sizes[i]]++;
+    EXPECT_EQ(num_zeros, expected_hist[0]);
+    for(size_t b = 0; b < hist.size(); b++)
+        EXPECT_EQ(hist[b], expected_hist[b]);
+}
+
+//-----------------------------------------------------------------------------
+template <typename Exec>
+void
+check_all()
+{
+    const index_t sizes[] = {0, 1, 17, 1000, 100003};
+    for(index_t n : sizes)
+    {
+        check_for_all<Exec>(n, 0);
+        check_for_all<Exec>(n, 64);
+        check_reduce_chunks<Exec>(n, 0);
+        check_reduce_chunks<Exec>(n, 100);
+        check_scan_chunks<Exec>(n, 0);
+        check_scan_chunks<Exec>(n, 3);
+        check_sort<Exec>(n);
+        check_algorithms<Exec>(n);
+    }
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_execution, serial)
+{
+    check_all<conduit::execution::SerialExec>();
+}
+
+#if defined(CONDUIT_USE_OPENMP)
+//-----------------------------------------------------------------------------
+TEST(conduit_execution, openmp)
+{
+    check_all<conduit::execution::OpenMPExec>();
+}
+#endif
+
+//-----------------------------------------------------------------------------
+TEST(conduit_execution, task_thread_pool)
+{
+    // default: a single thread
+    EXPECT_FALSE(task::has_task_executor());
+    EXPECT_EQ(task::number_of_workers(), 1);
+    check_all<conduit::execution::TaskExec>();
+
+    task::set_number_of_threads(4);
+    EXPECT_EQ(task::number_of_workers(), 4);
+    check_all<conduit::execution::TaskExec>();
+
+    // tasks are run on more than one thread
+    std::vector<std::thread::id> ids(64);
+    task::run_tasks(64, [&](index_t i)
+    {
+        // give the other threads a chance to claim tasks
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        ids[i] = std::this_thread::get_id();
+    });
+    std::sort(ids.begin(), ids.end());
+    EXPECT_GT(std::unique(ids.begin(), ids.end()) - ids.begin(), 1);
+
+    task::set_number_of_threads(1);
+    EXPECT_EQ(task::number_of_workers(), 1);
+
+    EXPECT_THROW(task::set_number_of_threads(0), conduit::Error);
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_execution, task_exceptions_and_nesting)
+{
+    task::set_number_of_threads(4);
+
+    // the first exception is passed back to the caller,
+    // all other tasks still run
+    std::atomic<int> num_run(0);
+    EXPECT_THROW(task::run_tasks(100, [&](index_t i)
+    {
+        num_run++;
+        if(i == 42)
+        {
+            CONDUIT_ERROR("task " << i << " failed");
+        }
+    }), conduit::Error);
+    EXPECT_EQ(num_run.load(), 100);
+
+    // the pool is still usable
+    check_reduce_chunks<conduit::execution::TaskExec>(100003, 0);
+
+    // nested calls run serially on the calling task's thread
+    std::atomic<int> num_nested(0);
+    task::run_tasks(8, [&](index_t)
+    {
+        std::thread::id outer = std::this_thread::get_id();
+        task::run_tasks(8, [&](index_t)
+        {
+            EXPECT_EQ(std::this_thread::get_id(), outer);
+            num_nested++;
+        });
+    });
+    EXPECT_EQ(num_nested.load(), 64);
+
+    task::set_number_of_threads(1);
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_execution, task_custom_executor)
+{
+    // an executor that runs tasks in reverse order on the calling thread
+    int num_calls = 0;
+    index_t num_tasks_run = 0;
+    task::set_task_executor([&](index_t num_tasks,
+                                const std::function<void(index_t)> &func)
+    {
+        num_calls++;
+        for(index_t i = num_tasks - 1; i >= 0; i--)
+        {
+            func(i);
+            num_tasks_run++;
+        }
+    }, 4);
+
+    EXPECT_TRUE(task::has_task_executor());
+    EXPECT_EQ(task::number_of_workers(), 4);
+
+    check_all<conduit::execution::TaskExec>();
+    EXPECT_GT(num_calls, 0);
+    EXPECT_GT(num_tasks_run, 0);
+
+    // nested calls do not go back to the executor
+    int calls_before = num_calls;
+    task::run_tasks(4, [&](index_t)
+    {
+        task::run_tasks(4, [&](index_t) {});
+    });
+    EXPECT_EQ(num_calls, calls_before + 1);
+
+    task::reset_task_executor();
+    EXPECT_FALSE(task::has_task_executor());
+    EXPECT_EQ(task::number_of_workers(), 1);
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_execution, task_reduce_and_scan_match_serial)
+{
+    index_t n = 1 << 15;
+    std::vector<float64> vals(n);
+    for(index_t i = 0; i < n; i++)
+        vals[i] = (float64)(i % 1000);
+
+    auto chunk_sum = [&](index_t b, index_t e)
+    {
+        float64 s = 0.0;
+        for(index_t i = b; i < e; i++)
+            s += vals[i];
+        return s;
+    };
+    auto plus = [](float64 lhs, float64 rhs) { return lhs + rhs; };
+
+    float64 serial_sum =
+        conduit::execution::reduce_chunks<conduit::execution::SerialExec>(
+            0, n, 0.0, chunk_sum, plus);
+
+    std::vector<index_t> serial_offsets(n);
+    conduit::execution::exclusive_scan<conduit::execution::SerialExec>(
+        vals, serial_offsets, n, (index_t)0);
+
+    task::set_number_of_threads(4);
+    float64 task_sum =
+        conduit::execution::reduce_chunks<conduit::execution::TaskExec>(
+            0, n, 0.0, chunk_sum, plus);
+
+    std::vector<index_t> task_offsets(n);
+    conduit::execution::exclusive_scan<conduit::execution::TaskExec>(
+        vals, task_offsets, n, (index_t)0);
+    task::set_number_of_threads(1);
+
+    // values are small integers, so the sums are exact
+    EXPECT_EQ(serial_sum, task_sum);
+    EXPECT_EQ(serial_offsets, task_offsets);
+}
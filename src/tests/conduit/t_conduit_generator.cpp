@@ -10,6 +10,7 @@
 
 #include "conduit.hpp"
 
+#include <cmath>
 #include <iostream>
 #include "gtest/gtest.h"
 
@@ -904,3 +905,201 @@ TEST(conduit_generator, yaml_external_gen)
 
 }
 
+
+//-----------------------------------------------------------------------------
+// parses txt with the streaming and document tree paths and checks
+// that both create the same node
+void
+check_stream_matches_dom(const std::string &txt,
+                         const std::string &protocol)
+{
+    Node n_stream;
+    Generator g_stream(txt,protocol);
+    g_stream.walk(n_stream);
+
+    Node n_dom;
+    Generator g_dom(txt,protocol);
+    g_dom.set_streaming(false);
+    g_dom.walk(n_dom);
+
+    EXPECT_EQ(n_stream.schema().to_json(),n_dom.schema().to_json()) << txt;
+    EXPECT_EQ(n_stream.to_json(),n_dom.to_json()) << txt;
+
+    Node info;
+    EXPECT_FALSE(n_stream.diff(n_dom,info)) << txt;
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_generator, stream_json)
+{
+    Generator g("{}","json");
+    EXPECT_TRUE(g.streaming());
+
+    Node n;
+    g.set_schema("{\"a\": [1, 2, 3], \"b\": [1, 2.5, \"nan\"], \"c\": \"txt\"}");
+    g.walk(n);
+    EXPECT_EQ(n["a"].dtype().id(),DataType::INT64_ID);
+    EXPECT_EQ(n["a"].dtype().number_of_elements(),3);
+    EXPECT_EQ(n["a"].as_int64_ptr()[2],3);
+    EXPECT_EQ(n["b"].dtype().id(),DataType::FLOAT64_ID);
+    EXPECT_EQ(n["b"].as_float64_ptr()[1],2.5);
+    EXPECT_TRUE(std::isnan(n["b"].as_float64_ptr()[2]));
+    EXPECT_EQ(n["c"].as_string(),"txt");
+
+    const char *cases[] =
+    {
+        "{}",
+        "[]",
+        "42",
+        "-7",
+        "3.25",
+        "{\"a\": {\"b\": {\"c\": 1}}, \"d\": []}",
+        "{\"a\": [1, 2, 3.5, -4e3, 5E-2, 0.1, 1e-300, 1e300]}",
+        "{\"a\": [9223372036854775807, -9223372036854775808]}",
+        "{\"a\": 18446744073709551615, \"b\": 18446744073709551616}",
+        "{\"a\": 12345678901234567890123, \"b\": 0.12345678901234567890123}",
+        "{\"a\": [1, \"two\", 3], \"b\": [1.5, {\"c\": 2}], \"d\": [\"nan\", 2]}",
+        "{\"a\": [[1, 2], [3.5, 4], [], [[5]]], \"b\": [{}, []]}",
+        "{\"a\": [true, false, null], \"b\": true, \"c\": null}",
+        "{\"a\": [1, true], \"b\": [2, null], \"c\": [\"inf\", \"-inf\", 1]}",
+        "{\"a\": \"tab\\there \\\"quoted\\\" \\\\ \\/ \\u00e9 \\ud83d\\ude00\"}",
+        "{\"a\": [1, 2], // comment\n \"b\": 3 // another\n}",
+        "{\"a\": nan, \"b\": [1, inf, 2], \"c\": [nan, \"x\"], \"d\": unquoted}",
+        " \n\t{ \"a\" :\n [ 1 ,2 ] } \n",
+    };
+
+    for(size_t i = 0; i < sizeof(cases) / sizeof(cases[0]); i++)
+    {
+        check_stream_matches_dom(cases[i],"json");
+    }
+
+    // round trip generated json
+    Node n_src;
+    n_src["a/b"].set(DataType::float64(100));
+    n_src["a/c"].set(DataType::int32(50));
+    n_src["d"] = "string value";
+    n_src["e"].append().set(1.0);
+    float64_array a_b = n_src["a/b"].value();
+    for(index_t i = 0; i < 100; i++)
+    {
+        a_b[i] = 1.0 / (i + 1.0);
+    }
+    check_stream_matches_dom(n_src.to_json(),"json");
+    check_stream_matches_dom(n_src.to_json(),"yaml");
+    check_stream_matches_dom(n_src.to_yaml(),"yaml");
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_generator, stream_yaml)
+{
+    const char *cases[] =
+    {
+        "a: 1",
+        "- 1\n- 2\n- 3.5\n",
+        "a: [1, 2, 3]\nb: [1, 2.5, nan]\nc: txt\n",
+        "a:\n  b:\n    c: 1\n  d: []\n  e: {}\n",
+        "a: [1, two, 3]\nb: [1.5, {c: 2}]\nd: [[1, 2], [3.5, 4], []]\n",
+        "a: true\nb: null\nc: \"5\"\nd: ''\n",
+        "a: &anchor [1, 2, 3]\nb: *anchor\n",
+        "a: &obj {x: 1, y: [4, 5]}\nb: *obj\n",
+        "a: &val 7\nb: [1, *val, 3]\nc: *val\n",
+        "a: &txt hello\nb: [*txt, 1]\n",
+        "a: 1\n---\nb: 2\n",
+    };
+
+    for(size_t i = 0; i < sizeof(cases) / sizeof(cases[0]); i++)
+    {
+        check_stream_matches_dom(cases[i],"yaml");
+    }
+
+    Node n;
+    Generator g("a: &anchor [1, 2, 3]\nb: *anchor\n","yaml");
+    g.walk(n);
+    EXPECT_EQ(n["b"].dtype().id(),DataType::INT64_ID);
+    EXPECT_EQ(n["b"].as_int64_ptr()[1],2);
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_generator, stream_parsing_errors)
+{
+    const char *json_cases[] =
+    {
+        "",
+        "{",
+        "[1, 2",
+        "{\"a\" 1}",
+        "{\"a\": 1,}",
+        "[1 2]",
+        "{\"a\": 1} 2",
+        "{\"a\": \"unterminated}",
+        "{\"a\": \"bad \\q escape\"}",
+        "[1.]",
+        "[-]",
+        "{\"a\": 1, \"a\": 2}",
+    };
+
+    for(size_t i = 0; i < sizeof(json_cases) / sizeof(json_cases[0]); i++)
+    {
+        Generator g(json_cases[i],"json");
+        Node n;
+        n["keep"] = 1;
+        EXPECT_THROW(g.walk(n),conduit::Error) << json_cases[i];
+        // node is cleared on errors
+        EXPECT_TRUE(n.dtype().is_empty());
+    }
+
+    const char *yaml_cases[] =
+    {
+        "",
+        "a: 10\ns",
+        "[ 10,\ns",
+        "a: 1\na: 2\n",
+        "a: *undefined\n",
+        "? [1, 2]\n: 3\n",
+    };
+
+    for(size_t i = 0; i < sizeof(yaml_cases) / sizeof(yaml_cases[0]); i++)
+    {
+        Generator g(yaml_cases[i],"yaml");
+        Node n;
+        EXPECT_THROW(g.walk(n),conduit::Error) << yaml_cases[i];
+    }
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_generator, stream_parse_large_arrays)
+{
+    // inline numeric arrays, parsed with and without a document tree
+    const index_t num_vals = 10000;
+    Node n_src;
+    n_src["ints"].set(DataType::int64(num_vals));
+    n_src["floats"].set(DataType::float64(num_vals));
+    int64_array   ints   = n_src["ints"].value();
+    float64_array floats = n_src["floats"].value();
+    for(index_t i = 0; i < num_vals; i++)
+    {
+        ints[i]   = i * 7919 - num_vals;
+        floats[i] = std::sin((float64)i) * 1000.0;
+    }
+
+    const std::string protocols[] = {"json", "yaml"};
+    for(int p = 0; p < 2; p++)
+    {
+        const std::string &protocol = protocols[p];
+        std::string txt = protocol == "json" ? n_src.to_json()
+                                             : n_src.to_yaml();
+
+        Node n_stream;
+        Generator g_stream(txt,protocol);
+        g_stream.walk(n_stream);
+
+        Node n_dom;
+        Generator g_dom(txt,protocol);
+        g_dom.set_streaming(false);
+        g_dom.walk(n_dom);
+
+        Node info;
+        EXPECT_FALSE(n_stream.diff(n_dom,info));
+        EXPECT_FALSE(n_stream.diff(n_src,info));
+    }
+}
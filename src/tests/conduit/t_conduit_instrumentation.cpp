@@ -0,0 +1,127 @@
+// Copyright (c) Lawrence Livermore National Security, LLC and other Conduit
+// Project developers. See top-level LICENSE AND COPYRIGHT files for dates and
+// other details. No copyright assignment is required to contribute to Conduit.
+
+//-----------------------------------------------------------------------------
+///
+/// file: t_conduit_instrumentation.cpp
+///
+//-----------------------------------------------------------------------------
+
+#include "conduit.hpp"
+#include "conduit_instrumentation.hpp"
+
+#include <iostream>
+#include "gtest/gtest.h"
+
+using namespace conduit;
+
+//-----------------------------------------------------------------------------
+TEST(conduit_instrumentation, disabled)
+{
+    instrumentation::disable();
+    instrumentation::reset();
+
+    Node n;
+    n["a"].set(DataType::float64(100));
+    n["b"].set(DataType::int32(10));
+    Node n_c;
+    n.compact_to(n_c);
+
+    Node info;
+    instrumentation::snapshot(info);
+    info.print();
+
+    EXPECT_EQ(info["enabled"].as_string(),"false");
+    EXPECT_EQ(info["allocators"].number_of_children(),0);
+    EXPECT_EQ(info["memcpy/calls"].to_uint64(),0);
+    EXPECT_EQ(info["compact_to/calls"].to_uint64(),0);
+    EXPECT_EQ(info["parse/calls"].to_uint64(),0);
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_instrumentation, allocations)
+{
+    instrumentation::enable();
+    instrumentation::reset();
+
+    {
+        Node n;
+        n.set(DataType::float64(100));
+    }
+
+    Node info;
+    instrumentation::snapshot(info);
+    info.print();
+
+    EXPECT_EQ(info["enabled"].as_string(),"true");
+    EXPECT_TRUE(info.has_path("allocators/0"));
+    const Node &alloc = info["allocators/0"];
+    EXPECT_EQ(alloc["allocations"].to_uint64(),1);
+    EXPECT_EQ(alloc["bytes_allocated"].to_uint64(),800);
+    EXPECT_EQ(alloc["frees"].to_uint64(),1);
+    EXPECT_EQ(alloc["bytes_freed"].to_uint64(),800);
+
+    instrumentation::reset();
+    instrumentation::snapshot(info);
+    EXPECT_EQ(info["allocators"].number_of_children(),0);
+
+    instrumentation::disable();
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_instrumentation, copies_and_conversions)
+{
+    Node n;
+    n["a"].set(DataType::float64(100));
+    n["b"].set(DataType::int32(10));
+
+    instrumentation::enable();
+    instrumentation::reset();
+
+    Node n_c;
+    n.compact_to(n_c);
+
+    Node n_f32;
+    n["a"].to_float32_array(n_f32);
+
+    Node info;
+    instrumentation::snapshot(info);
+    info.print();
+
+    EXPECT_EQ(info["compact_to/calls"].to_uint64(),1);
+    EXPECT_EQ(info["compact_to/bytes"].to_uint64(),840);
+    // compact_to copies each leaf
+    EXPECT_GE(info["memcpy/calls"].to_uint64(),2);
+    EXPECT_GE(info["memcpy/bytes"].to_uint64(),840);
+    EXPECT_EQ(info["conversions/calls"].to_uint64(),1);
+    EXPECT_EQ(info["conversions/elements"].to_uint64(),100);
+
+    instrumentation::disable();
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_instrumentation, parse)
+{
+    instrumentation::enable();
+    instrumentation::reset();
+
+    std::string yaml_txt = "a: 10\nb: \"here\"\n";
+    Generator g(yaml_txt,"yaml");
+    Node n;
+    g.walk(n);
+
+    std::string json_txt = "{\"a\": 10, \"b\": \"here\"}";
+    n.parse(json_txt,"json");
+
+    Node info;
+    instrumentation::snapshot(info);
+    info.print();
+
+    EXPECT_EQ(info["parse/calls"].to_uint64(),2);
+    EXPECT_EQ(info["parse/bytes"].to_uint64(),
+              yaml_txt.size() + json_txt.size());
+    EXPECT_GE(info["parse/seconds"].to_float64(),0.0);
+
+    instrumentation::disable();
+}
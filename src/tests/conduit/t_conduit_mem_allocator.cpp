@@ -11,6 +11,7 @@
 #include "conduit.hpp"
 
 #include <iostream>
+#include <set>
 #include "gtest/gtest.h"
 
 
@@ -251,3 +252,99 @@ TEST(conduit_memory_allocator, test_strange)
     EXPECT_EQ(buff[1],0);
     EXPECT_EQ(buff[2],1);
 }
+
+//-----------------------------------------------------------------------------
+TEST(conduit_memory_allocator, test_set_reuse)
+{
+    conduit::utils::set_memcpy_handler(conduit::utils::default_memcpy_handler);
+    conduit::utils::set_memset_handler(conduit::utils::default_memset_handler);
+
+    conduit::Node n;
+    n.set(conduit::DataType::float64(100));
+    conduit::float64_array f64_vals = n.value();
+    f64_vals.fill(1.0);
+    const void *data_ptr = n.data_ptr();
+
+    // same number of bytes, different type: reused and zeroed
+    n.set(conduit::DataType::int64(100));
+    EXPECT_EQ(n.data_ptr(),data_ptr);
+    EXPECT_EQ(n.as_int64_array().sum(),0);
+
+    // fits and uses more than half of the buffer: reused
+    std::vector<conduit::float32> f32_vals(150,2.0f);
+    n.set(f32_vals);
+    EXPECT_EQ(n.data_ptr(),data_ptr);
+    EXPECT_EQ(n.dtype().number_of_elements(),150);
+    EXPECT_EQ(n.as_float32_ptr()[149],2.0f);
+    EXPECT_EQ(n.allocated_bytes(),800);
+
+    // too small or too large: new buffers
+    n.set(conduit::DataType::float64(10));
+    EXPECT_EQ(n.allocated_bytes(),80);
+    n.set(conduit::DataType::float64(20));
+    EXPECT_EQ(n.allocated_bytes(),160);
+
+    // external data is never reused
+    std::vector<conduit::int32> ext_vals(10,1);
+    n.set_external(ext_vals);
+    n.set(conduit::DataType::float32(10));
+    EXPECT_NE(n.data_ptr(),(void*)ext_vals.data());
+    EXPECT_EQ(ext_vals[0],1);
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_memory_allocator, test_pool_allocator)
+{
+    conduit::utils::set_memcpy_handler(conduit::utils::default_memcpy_handler);
+    conduit::utils::set_memset_handler(conduit::utils::default_memset_handler);
+
+    conduit::index_t pool_id = conduit::utils::pool_allocator_id();
+    EXPECT_EQ(pool_id,conduit::utils::pool_allocator_id());
+    EXPECT_TRUE(pool_id > 0);
+    conduit::utils::pool_trim();
+    EXPECT_EQ(conduit::utils::pool_cached_bytes(),0);
+
+    conduit::Node n;
+    n.set_allocator(pool_id);
+    std::set<const void*> ptrs;
+    for(int step = 0; step < 5; step++)
+    {
+        n.reset();
+        n["fields/p/values"].set(conduit::DataType::float64(1000));
+        n["fields/q/values"].set(conduit::DataType::float64(1000));
+        n["fields/r/values"].set(conduit::DataType::int32(3));
+        // recycled blocks are zeroed
+        EXPECT_EQ(n["fields/p/values"].as_float64_array().sum(),0.0);
+        n["fields/p/values"].as_float64_array().fill(1.0);
+        n["fields/q/values"].as_float64_array().fill(1.0);
+        ptrs.insert(n["fields/p/values"].data_ptr());
+        ptrs.insert(n["fields/q/values"].data_ptr());
+        ptrs.insert(n["fields/r/values"].data_ptr());
+    }
+    // after the first step, the same blocks are reused
+    EXPECT_EQ(ptrs.size(),3);
+
+    n.reset();
+    EXPECT_TRUE(conduit::utils::pool_cached_bytes() >= 2 * 8000 + 12);
+
+    // with no room in the cache, freed blocks go back to the system
+    conduit::utils::set_pool_max_cached_bytes(0);
+    EXPECT_EQ(conduit::utils::pool_cached_bytes(),0);
+    n["values"].set(conduit::DataType::float64(1000));
+    n.reset();
+    EXPECT_EQ(conduit::utils::pool_cached_bytes(),0);
+    conduit::utils::set_pool_max_cached_bytes(1 << 30);
+    EXPECT_EQ(conduit::utils::pool_max_cached_bytes(),1 << 30);
+
+    // large and odd sizes
+    void *ptr = conduit::utils::pool_allocate(3,100000);
+    EXPECT_TRUE(ptr != NULL);
+    memset(ptr,1,300000);
+    conduit::utils::pool_free(ptr);
+    EXPECT_EQ(conduit::utils::pool_allocate(1,300000),ptr);
+    EXPECT_EQ(((conduit::uint8*)ptr)[299999],0);
+    conduit::utils::pool_free(ptr);
+    conduit::utils::pool_free(NULL);
+    conduit::utils::pool_trim();
+    EXPECT_EQ(conduit::utils::pool_cached_bytes(),0);
+}
@@ -11,6 +11,7 @@
 #include "conduit.hpp"
 
 #include <iostream>
+#include <sstream>
 #include "gtest/gtest.h"
 using namespace conduit;
 
@@ -1381,3 +1382,230 @@ TEST(conduit_node, move_schema_parent)
     EXPECT_EQ(path_name, "path");
     EXPECT_EQ(path_schema_parent_existence, "path schema parent exists");
 }
+
+//-----------------------------------------------------------------------------
+void
+build_arena_test_tree(Node &n, int num_fields)
+{
+    for(int i=0; i < num_fields; i++)
+    {
+        std::ostringstream oss;
+        oss << "fields/f" << i;
+        Node &f = n[oss.str()];
+        f["association"] = "element";
+        f["topology"]    = "topo";
+        f["values"].set(DataType::float64(4));
+        f["list"].append() = i;
+        f["list"].append() = i + 1;
+    }
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_node, tree_arena)
+{
+    Node n;
+    EXPECT_FALSE(n.is_arena_enabled());
+
+    n["a"] = 10;
+    n.enable_arena();
+    // enabling resets the node
+    EXPECT_TRUE(n.dtype().is_empty());
+    EXPECT_TRUE(n.is_arena_enabled());
+
+    build_arena_test_tree(n,100);
+    EXPECT_TRUE(n["fields/f10"].is_arena_enabled());
+    EXPECT_EQ(n["fields"].number_of_children(),100);
+    EXPECT_EQ(n["fields/f99/list"][1].to_int(),100);
+
+    Node info;
+    n.arena_info(info);
+    info.print();
+    index_t num_slabs  = info["number_of_slabs"].to_index_t();
+    index_t used_bytes = info["used_bytes"].to_index_t();
+    EXPECT_TRUE(num_slabs > 0);
+    EXPECT_TRUE(info["number_of_allocations"].to_index_t() > 0);
+
+    // a heap copy of an arena tree and vice versa
+    Node n_heap(n);
+    EXPECT_FALSE(n_heap.is_arena_enabled());
+    Node info_diff;
+    EXPECT_FALSE(n.diff(n_heap,info_diff));
+
+    // removing children returns them to the arena
+    n["fields"].remove_child("f0");
+    n["fields"].remove(0);
+    EXPECT_EQ(n["fields"].number_of_children(),98);
+    EXPECT_FALSE(n.has_path("fields/f1"));
+
+    // reset returns everything, the slabs are reused
+    n.reset();
+    n.arena_info(info);
+    EXPECT_EQ(info["number_of_allocations"].to_index_t(),0);
+    EXPECT_EQ(info["used_bytes"].to_index_t(),0);
+
+    n.set(n_heap);
+    EXPECT_FALSE(n.diff(n_heap,info_diff));
+    n.arena_info(info);
+    EXPECT_EQ(info["number_of_slabs"].to_index_t(),num_slabs);
+    EXPECT_EQ(info["used_bytes"].to_index_t(),used_bytes);
+
+    // json parsing (generator) also uses the arena
+    Node n_parse;
+    n_parse.enable_arena();
+    n_parse.parse(n_heap.to_json("conduit_json"),"conduit_json");
+    EXPECT_FALSE(n_parse.diff(n_heap,info_diff));
+    n_parse.arena_info(info);
+    EXPECT_TRUE(info["number_of_allocations"].to_index_t() > 0);
+
+    // only root nodes support arena mode
+    EXPECT_THROW(n["fields"].enable_arena(),Error);
+    EXPECT_THROW(n["fields"].disable_arena(),Error);
+
+    n.disable_arena();
+    EXPECT_FALSE(n.is_arena_enabled());
+    EXPECT_TRUE(n.dtype().is_empty());
+    n.arena_info(info);
+    EXPECT_TRUE(info.dtype().is_empty());
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_node, tree_arena_swap)
+{
+    // children keep their arena alive after the root is gone
+    Node n_heap;
+    n_heap["here"] = 1;
+    {
+        Node n_arena;
+        n_arena.enable_arena();
+        build_arena_test_tree(n_arena,10);
+        n_heap["fields"].swap(n_arena["fields"]);
+        EXPECT_FALSE(n_arena.has_path("fields/f0"));
+    }
+
+    EXPECT_EQ(n_heap["fields"].number_of_children(),10);
+    EXPECT_EQ(n_heap["fields/f9/list"][0].to_int(),9);
+    n_heap["fields/f9/extra"] = 42;
+    EXPECT_EQ(n_heap["fields/f9/extra"].to_int(),42);
+    n_heap.remove("fields/f9");
+    EXPECT_EQ(n_heap["fields"].number_of_children(),9);
+
+    // swap of two roots
+    Node n_a, n_b;
+    n_a.enable_arena();
+    build_arena_test_tree(n_a,5);
+    build_arena_test_tree(n_b,3);
+    n_a.swap(n_b);
+    EXPECT_EQ(n_a["fields"].number_of_children(),3);
+    EXPECT_EQ(n_b["fields"].number_of_children(),5);
+    build_arena_test_tree(n_a,7);
+    EXPECT_EQ(n_a["fields"].number_of_children(),7);
+    n_a.reset();
+    n_b.reset();
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_node, copy_on_write)
+{
+    Node n_src;
+    n_src["coords/x"].set(DataType::float64(1000));
+    n_src["coords/y"].set(DataType::float64(1000));
+    n_src["name"] = "mesh";
+    float64_array x_vals = n_src["coords/x"].value();
+    for(index_t i=0; i < 1000; i++)
+    {
+        x_vals[i] = (float64) i;
+    }
+    const Node &n_src_const = n_src;
+    const void *src_x_ptr = n_src_const["coords/x"].data_ptr();
+
+    Node n_cow;
+    n_cow.enable_copy_on_write();
+    EXPECT_TRUE(n_cow.is_copy_on_write_enabled());
+    n_cow.set(n_src);
+    const Node &n_cow_const = n_cow;
+
+    // leaves share the source's buffers
+    EXPECT_TRUE(n_cow["coords"].is_copy_on_write_enabled());
+    EXPECT_TRUE(n_cow_const["coords/x"].is_data_shared());
+    EXPECT_TRUE(n_src_const["coords/x"].is_data_shared());
+    EXPECT_EQ(n_cow_const["coords/x"].data_ptr(),src_x_ptr);
+    EXPECT_EQ(n_cow_const["name"].as_string(),"mesh");
+    Node info_diff;
+    EXPECT_FALSE(n_cow.diff(n_src,info_diff));
+
+    Node n_info;
+    n_cow.info(n_info);
+    EXPECT_EQ(n_info["mem_spaces"].child(0)["type"].as_string(),"shared");
+    EXPECT_EQ(n_info["mem_spaces"].child(0)["references"].to_index_t(),2);
+
+    // writing to the copy copies the buffer first
+    float64 *cow_x_ptr = n_cow["coords/x"].as_float64_ptr();
+    EXPECT_NE((const void*)cow_x_ptr,src_x_ptr);
+    EXPECT_FALSE(n_cow_const["coords/x"].is_data_shared());
+    cow_x_ptr[0] = -1.0;
+    EXPECT_EQ(n_src_const["coords/x"].as_float64_ptr()[0],0.0);
+    EXPECT_EQ(n_cow_const["coords/x"].as_float64_ptr()[10],10.0);
+
+    // the source is the last user of its buffer, and takes it back
+    EXPECT_TRUE(n_src_const["coords/x"].is_data_shared());
+    EXPECT_EQ((const void*)n_src["coords/x"].as_float64_ptr(),src_x_ptr);
+    EXPECT_FALSE(n_src_const["coords/x"].is_data_shared());
+
+    // writing to the source copies, the copy keeps the old values
+    n_src["coords/y"].as_float64_array().fill(1.0);
+    EXPECT_EQ(n_cow_const["coords/y"].as_float64_ptr()[0],0.0);
+    // compatible sets copy
+    n_cow["name"].set("grid");
+    EXPECT_EQ(n_src_const["name"].as_string(),"mesh");
+    // scalar value casts to pointers copy
+    n_cow["coords/y"].set(n_src["coords/y"]);
+    EXPECT_TRUE(n_cow_const["coords/y"].is_data_shared());
+    float64 *cow_y_ptr = n_cow["coords/y"].value();
+    cow_y_ptr[0] = 2.0;
+    EXPECT_EQ(n_src_const["coords/y"].as_float64_ptr()[0],1.0);
+
+    // the copy outlives the source
+    Node n_keep;
+    n_keep.enable_copy_on_write();
+    n_keep.set(n_cow);
+    n_cow.reset();
+    EXPECT_EQ(n_keep["coords/x"].as_float64_ptr()[0],-1.0);
+    EXPECT_EQ(n_keep["coords/x"].as_float64_ptr()[999],999.0);
+
+    // update in copy-on-write mode shares too
+    Node n_upd;
+    n_upd.enable_copy_on_write();
+    n_upd["coords/x"].set(DataType::float64(1000));
+    n_upd.update(n_src);
+    EXPECT_TRUE(n_src_const["coords/x"].is_data_shared());
+    EXPECT_EQ(n_upd["coords/x"].as_float64_ptr()[999],999.0);
+
+    // external leaves and leaves from compacted trees are still copied
+    std::vector<float64> ext_vals(10,3.0);
+    Node n_ext;
+    n_ext["ext"].set_external(ext_vals);
+    Node n_cmp;
+    n_src.compact_to(n_cmp);
+    Node n_cow2;
+    n_cow2.enable_copy_on_write();
+    n_cow2["a"].set(n_ext);
+    n_cow2["b"].set(n_cmp);
+    EXPECT_FALSE(n_cow2["a/ext"].is_data_shared());
+    EXPECT_FALSE(n_cow2["b/coords/x"].is_data_shared());
+
+    // external views of a shared buffer get their own copy
+    Node n_src_cpy;
+    n_src_cpy.enable_copy_on_write();
+    n_src_cpy.set(n_src);
+    Node n_view;
+    n_view.set_external(n_src_cpy);
+    EXPECT_FALSE(n_src_cpy["coords/x"].is_data_shared());
+    n_view["coords/x"].as_float64_ptr()[0] = 42.0;
+    EXPECT_EQ(n_src_cpy["coords/x"].as_float64_ptr()[0],42.0);
+    EXPECT_EQ(n_src["coords/x"].as_float64_ptr()[0],0.0);
+
+    // without the mode, set copies
+    Node n_copy;
+    n_copy.set(n_src);
+    EXPECT_FALSE(n_copy["coords/x"].is_data_shared());
+}
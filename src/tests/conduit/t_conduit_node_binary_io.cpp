@@ -124,3 +124,60 @@ TEST(conduit_node_binary_io, mmap_simple)
     delete [] data;
   
 }
+
+//-----------------------------------------------------------------------------
+TEST(conduit_node_binary_io, load_mmap)
+{
+    Node nsrc;
+    nsrc["a"].set(DataType::float64(1000));
+    nsrc["b/c"] = "a string";
+    nsrc["b/d"].set(DataType::int32(10));
+    float64_array a_vals = nsrc["a"].value();
+    int32_array   d_vals = nsrc["b/d"].value();
+    for(index_t i = 0; i < 1000; i++)
+    {
+        a_vals[i] = 0.5 * i;
+    }
+    for(index_t i = 0; i < 10; i++)
+    {
+        d_vals[i] = (int32)(i * i);
+    }
+
+    nsrc.save("tout_conduit_load_mmap.conduit_bin");
+
+    Node nmmap;
+    nmmap.load_mmap("tout_conduit_load_mmap.conduit_bin");
+    EXPECT_EQ(nmmap.total_bytes_mmaped(),
+              nsrc.total_bytes_compact());
+
+    Node info;
+    EXPECT_FALSE(nsrc.diff(nmmap,info));
+
+    // writes to the mapping are not carried to the file
+    nmmap["b/d"].as_int32_ptr()[0] = -1;
+    EXPECT_EQ(nmmap["b/d"].as_int32_ptr()[0], -1);
+
+    Node ntest;
+    ntest.load("tout_conduit_load_mmap.conduit_bin");
+    EXPECT_EQ(ntest["b/d"].as_int32_ptr()[0], 0);
+    EXPECT_FALSE(nsrc.diff(ntest,info));
+
+    // access pattern hints
+    Node opts;
+    const char *advice[] = {"normal", "sequential", "random", "willneed"};
+    for(int i = 0; i < 4; i++)
+    {
+        opts["advice"] = advice[i];
+        Node nadv;
+        nadv.load_mmap("tout_conduit_load_mmap.conduit_bin",opts);
+        EXPECT_FALSE(nsrc.diff(nadv,info));
+    }
+
+    opts["advice"] = "bananas";
+    EXPECT_THROW(nmmap.load_mmap("tout_conduit_load_mmap.conduit_bin",opts),
+                 conduit::Error);
+
+    // missing files
+    EXPECT_THROW(nmmap.load_mmap("tout_conduit_load_mmap_missing.conduit_bin"),
+                 conduit::Error);
+}
@@ -11,6 +11,7 @@
 #include "conduit.hpp"
 
 #include <iostream>
+#include <sstream>
 #include "gtest/gtest.h"
 
 using namespace conduit;
@@ -104,3 +105,92 @@ TEST(conduit_node_compact, compact_3)
         EXPECT_EQ(n_arr[i],nc_arr[i]);
     }
 }
+
+//-----------------------------------------------------------------------------
+TEST(conduit_node_compact, compact_to_arena)
+{
+    float64 vals[] = { 100.0,-100.0,200.0,-200.0,300.0,-300.0,400.0,-400.0,500.0,-500.0};
+
+    Node n;
+    // strided leaf, so this case can't use a single copy
+    n["fields/a/values"].set_external(vals,5,0,2*sizeof(float64));
+    n["fields/b/values"].set(DataType::int32(4));
+    n["fields/b/values"].as_int32_array().fill(42);
+    n["fields/b/association"] = "vertex";
+    n["list"].append() = 10;
+    n["list"].append() = "here";
+    n["list"].append();
+    n["empty"];
+
+    Node nc;
+    n.compact_to_arena(nc);
+    nc.print();
+    EXPECT_TRUE(nc.is_arena_enabled());
+    EXPECT_TRUE(nc.is_compact());
+    EXPECT_TRUE(nc.is_contiguous());
+
+    Node info;
+    EXPECT_FALSE(n.diff(nc,info));
+
+    // the skeleton fits in a single slab
+    Node a_info;
+    nc.arena_info(a_info);
+    a_info.print();
+    EXPECT_EQ(a_info["number_of_slabs"].to_index_t(),1);
+
+    float64_array nc_arr = nc["fields/a/values"].value();
+    EXPECT_EQ(nc_arr[1],200.0);
+
+    // compact source case (single copy)
+    Node nc2;
+    nc.compact_to_arena(nc2);
+    EXPECT_FALSE(nc.diff(nc2,info));
+    EXPECT_NE(nc["fields/b/values"].data_ptr(),
+              nc2["fields/b/values"].data_ptr());
+
+    // reuses the existing arena
+    n.compact_to_arena(nc2);
+    EXPECT_FALSE(n.diff(nc2,info));
+    nc2.arena_info(a_info);
+    EXPECT_EQ(a_info["number_of_slabs"].to_index_t(),1);
+
+    // modifying the compacted tree
+    nc2["fields/c"] = 3.1415;
+    nc2["fields"].remove_child("a");
+    EXPECT_FALSE(nc2.has_path("fields/a"));
+    EXPECT_EQ(nc2["fields/c"].to_float64(),3.1415);
+
+    // dest must be a root
+    EXPECT_THROW(n.compact_to_arena(nc["fields"]),conduit::Error);
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_node_compact, compact_to_arena_many_leaves)
+{
+    Node n;
+    for(int d=0; d < 2; d++)
+    {
+        std::ostringstream oss;
+        oss << "domain_" << d << "/fields/";
+        for(int f=0; f < 20; f++)
+        {
+            std::ostringstream f_oss;
+            f_oss << oss.str() << "f" << f;
+            Node &fld = n[f_oss.str()];
+            fld["association"] = "element";
+            fld["topology"]    = "mesh";
+            fld["values"].set(DataType::float64(8));
+        }
+    }
+
+    Node n_res;
+    Node info;
+
+    n.compact_to(n_res);
+    EXPECT_FALSE(n.diff(n_res,info));
+
+    n_res.reset();
+    n.compact_to_arena(n_res);
+    EXPECT_FALSE(n.diff(n_res,info));
+    EXPECT_TRUE(n_res.is_compact());
+}
@@ -182,6 +182,49 @@ TEST(conduit_node_compare, compare_leaf_numeric)
         }
     }
 }
+
+//-----------------------------------------------------------------------------
+TEST(conduit_node_compare, compare_compatible_child_order)
+{
+    Node n_ref;
+    n_ref["a"].set((int64)1);
+    n_ref["b"].set((float64)2.0);
+    n_ref["c/d"].set((int32)3);
+
+    { // Same Schema, Different Values //
+        Node n(n_ref), o(n_ref), info;
+        EXPECT_EQ(n.schema().fingerprint(), o.schema().fingerprint());
+        EXPECT_FALSE(n.diff_compatible(o, info, 0.0));
+
+        o["c/d"].set((int32)4);
+        EXPECT_TRUE(n.diff_compatible(o, info, 0.0));
+        EXPECT_TRUE(info["children/diff"].has_child("c"));
+        EXPECT_EQ(info["children/diff"].number_of_children(), 3);
+    }
+
+    { // Same Children, Different Order //
+        Node n(n_ref), o, info;
+        o["c/d"].set((int32)3);
+        o["b"].set((float64)2.0);
+        o["a"].set((int64)1);
+        EXPECT_NE(n.schema().fingerprint(), o.schema().fingerprint());
+        EXPECT_FALSE(n.diff_compatible(o, info, 0.0));
+
+        o["a"].set((int64)5);
+        EXPECT_TRUE(n.diff_compatible(o, info, 0.0));
+        EXPECT_FALSE(info["children"].has_child("extra"));
+        EXPECT_EQ(info["children/diff/a/value"].as_int64(), -4);
+    }
+
+    { // Subset With Extra Children in the Other Node //
+        Node n, o(n_ref), info;
+        n["b"].set((float64)2.0);
+        EXPECT_FALSE(n.diff_compatible(o, info, 0.0));
+        n["e"].set((float64)2.0);
+        EXPECT_TRUE(n.diff_compatible(o, info, 0.0));
+        EXPECT_EQ(info["children/extra"].number_of_children(), 1);
+    }
+}
 #if 0
 //-----------------------------------------------------------------------------
 TEST(conduit_node_compare, compare_leaf_string)
@@ -11,6 +11,9 @@
 #include "conduit.hpp"
 
 #include <iostream>
+#include <memory>
+#include <type_traits>
+#include <vector>
 #include "gtest/gtest.h"
 
 using namespace conduit;
@@ -170,3 +173,168 @@ TEST(conduit_node_move_and_swap, move)
 
 
 }
+
+//-----------------------------------------------------------------------------
+TEST(conduit_node_move_and_swap, move_ctor_and_assign)
+{
+    Node n_a;
+    n_a["data"].set(DataType::float64(100));
+    n_a["name"] = "a";
+    const void *data_ptr_orig = n_a["data"].data_ptr();
+
+    // move constructor
+    Node n_b(std::move(n_a));
+    EXPECT_TRUE(n_a.dtype().is_empty());
+    EXPECT_EQ(n_b["data"].data_ptr(),data_ptr_orig);
+    EXPECT_EQ(n_b["name"].as_string(),"a");
+
+    // move assignment into a sub tree
+    Node n_c;
+    n_c["sub"] = std::move(n_b);
+    EXPECT_TRUE(n_b.dtype().is_empty());
+    EXPECT_EQ(n_c["sub/data"].data_ptr(),data_ptr_orig);
+    EXPECT_TRUE(n_c.has_path("sub/name"));
+
+    // set(Node&&) from a sub tree
+    Node n_d;
+    n_d.set(std::move(n_c["sub"]));
+    EXPECT_TRUE(n_c["sub"].dtype().is_empty());
+    EXPECT_EQ(n_d["data"].data_ptr(),data_ptr_orig);
+
+    // the move constructor is noexcept, so std::vector<Node> moves
+    // (rather than copies) nodes when it grows
+    static_assert(std::is_nothrow_move_constructible<Node>::value,
+                  "Node must be nothrow move constructible");
+    EXPECT_TRUE(std::is_nothrow_move_constructible<Node>::value);
+    std::vector<Node> nodes;
+    nodes.push_back(std::move(n_d));
+    for(int i=0; i < 10; i++)
+    {
+        Node n_v;
+        n_v["value"] = i;
+        nodes.push_back(std::move(n_v));
+    }
+    EXPECT_EQ(nodes[0]["data"].data_ptr(),data_ptr_orig);
+    EXPECT_EQ(nodes[10]["value"].to_int(),9);
+
+    // moved arena children outlive the arena tree
+    Node n_e;
+    {
+        Node n_arena;
+        n_arena.enable_arena();
+        n_arena["a/b"] = 42;
+        n_e = std::move(n_arena["a"]);
+    }
+    EXPECT_EQ(n_e["b"].to_int(),42);
+    Node n_f(std::move(n_e));
+    EXPECT_EQ(n_f["b"].to_int(),42);
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_node_move_and_swap, move_and_swap_parents)
+{
+    // swap hands children to their new owners
+    Node n_a, n_b;
+    // fetch_existing with ".." requires object nodes
+    n_a["a/x"] = 1;
+    n_a["b"] = 2;
+    n_b["c"] = 3;
+    n_a.swap(n_b);
+    EXPECT_EQ(n_a["c"].parent(),&n_a);
+    EXPECT_EQ(n_b["a"].parent(),&n_b);
+    EXPECT_EQ(n_b["a"].fetch_existing("../b").to_int(),2);
+
+    // moved from temporaries
+    Node n_c(std::move(n_b));
+    EXPECT_EQ(n_c["a"].parent(),&n_c);
+    Node n_d;
+    n_d = std::move(n_c);
+    EXPECT_EQ(n_d["a"].parent(),&n_d);
+    n_c.set(std::move(n_d));
+    EXPECT_EQ(n_c["a"].parent(),&n_c);
+
+    // push trees until the vector reallocates
+    std::vector<Node> nodes;
+    size_t capacity = nodes.capacity();
+    int num_reallocs = 0;
+    for(int i=0; num_reallocs < 3; i++)
+    {
+        Node n;
+        n["a/x"] = i;
+        n["b"] = i * 2;
+        n["c/d/y"] = i * 3;
+        nodes.push_back(std::move(n));
+        if(nodes.capacity() != capacity)
+        {
+            capacity = nodes.capacity();
+            num_reallocs++;
+        }
+    }
+
+    for(size_t i=0; i < nodes.size(); i++)
+    {
+        EXPECT_EQ(nodes[i]["a"].parent(),&nodes[i]);
+        EXPECT_EQ(nodes[i]["c/d"].parent(),&nodes[i]["c"]);
+        EXPECT_EQ(nodes[i]["a"].fetch_existing("../b").to_int(),(int)i * 2);
+        EXPECT_EQ(nodes[i]["c/d"].fetch_existing("../../a/x").to_int(),(int)i);
+    }
+    EXPECT_EQ(nodes[0]["a"].parent(),&nodes[0]);
+    EXPECT_EQ(nodes[0]["a"].fetch_existing("../b").to_int(),0);
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_node_move_and_swap, adopt)
+{
+    std::vector<float64> vals(1000,1.0);
+    const float64 *vals_ptr = vals.data();
+
+    Node n;
+    n["vals"].adopt(std::move(vals));
+    EXPECT_EQ(n["vals"].dtype().id(),DataType::FLOAT64_ID);
+    EXPECT_EQ(n["vals"].dtype().number_of_elements(),1000);
+    EXPECT_EQ((const float64*)n["vals"].data_ptr(),vals_ptr);
+    EXPECT_TRUE(n["vals"].is_data_shared());
+    // the adopted buffer is written to in place
+    n["vals"].as_float64_ptr()[0] = 2.0;
+    EXPECT_EQ((const float64*)n["vals"].data_ptr(),vals_ptr);
+    EXPECT_EQ(n["vals"].as_float64_array().sum(),1001.0);
+
+    std::unique_ptr<int32[]> ids(new int32[10]);
+    const int32 *ids_ptr = ids.get();
+    for(int i=0; i < 10; i++)
+    {
+        ids[i] = i;
+    }
+    n["ids"].adopt(std::move(ids),10);
+    EXPECT_TRUE(ids.get() == NULL);
+    EXPECT_EQ(n["ids"].as_int32_ptr(),ids_ptr);
+    EXPECT_EQ(n["ids"].as_int32_array()[9],9);
+
+    // copy-on-write nodes share adopted buffers
+    Node n_cow;
+    n_cow.enable_copy_on_write();
+    n_cow.set(n);
+    const Node &n_cow_const = n_cow;
+    EXPECT_EQ(n_cow_const["ids"].data_ptr(),(const void*)ids_ptr);
+    n.reset();
+    EXPECT_EQ(n_cow["ids"].as_int32_array()[5],5);
+
+    // rvalue vectors are adopted by set and operator=
+    std::vector<int64> vec(10,7);
+    const int64 *vec_ptr = vec.data();
+    Node n_vec;
+    n_vec["a"] = std::move(vec);
+    EXPECT_EQ(n_vec["a"].as_int64_ptr(),vec_ptr);
+
+    std::vector<uint8> empty_vec;
+    n_vec["empty"].set(std::move(empty_vec));
+    EXPECT_EQ(n_vec["empty"].dtype().number_of_elements(),0);
+
+    // compatible external data is written in place
+    std::vector<int64> ext(10,0);
+    n_vec["ext"].set_external(ext);
+    std::vector<int64> vec_b(10,3);
+    n_vec["ext"].set(std::move(vec_b));
+    EXPECT_EQ(ext[9],3);
+    EXPECT_EQ(n_vec["ext"].as_int64_ptr(),ext.data());
+}
@@ -115,3 +115,80 @@ TEST(conduit_node_paths, path_empty_slashes)
 
 
 
+//-----------------------------------------------------------------------------
+TEST(conduit_node_paths, compiled_path)
+{
+    Path p("/fields//pressure/values/");
+    EXPECT_EQ(p.number_of_segments(),3);
+    EXPECT_EQ(p.segment(0),"fields");
+    EXPECT_EQ(p.segment(1),"pressure");
+    EXPECT_EQ(p.segment(2),"values");
+    EXPECT_EQ(p.path(),"/fields//pressure/values/");
+    EXPECT_NE(p.to_string().find("\"pressure\""),std::string::npos);
+
+    Node n;
+    EXPECT_FALSE(n.has_path(p));
+    EXPECT_TRUE(n.fetch_ptr(p) != NULL);
+    EXPECT_TRUE(n.has_path(p));
+    EXPECT_TRUE(n.has_path("fields/pressure/values"));
+
+    n[p].set(42);
+    EXPECT_EQ(n["fields/pressure/values"].to_int64(),42);
+    EXPECT_EQ(&n.fetch_existing(p),&n["fields/pressure/values"]);
+
+    const Node &n_const = n;
+    EXPECT_EQ(n_const.fetch(p).to_int64(),42);
+    EXPECT_EQ(n_const[p].to_int64(),42);
+
+    // same shape, different tree, reuses cached indices
+    Node n2;
+    n2["fields/pressure/values"] = 43;
+    EXPECT_EQ(n2.fetch_existing(p).to_int64(),43);
+
+    // different shape, cache must not return the wrong child
+    Node n3;
+    n3["fields/density/values"] = 1;
+    n3["fields/pressure/values"] = 44;
+    EXPECT_EQ(n3.fetch_existing(p).to_int64(),44);
+    EXPECT_EQ(n.fetch_existing(p).to_int64(),42);
+
+    // removing a sibling shifts indices
+    n3.remove("fields/density");
+    EXPECT_EQ(n3.fetch_existing(p).to_int64(),44);
+
+    // missing paths
+    Node n4;
+    n4["fields/pressure"] = 1;
+    EXPECT_FALSE(n4.has_path(p));
+    const Node &n4_const = n4;
+    EXPECT_TRUE(n4_const.fetch_ptr(p) == NULL);
+    EXPECT_THROW(n4.fetch_existing(p),conduit::Error);
+    EXPECT_THROW(n4.fetch_existing(Path("fields/density")),conduit::Error);
+
+    // empty path
+    Path p_empty("//");
+    EXPECT_TRUE(p_empty.is_empty());
+    EXPECT_THROW(n.fetch(p_empty),conduit::Error);
+    EXPECT_FALSE(n.has_path(p_empty));
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_node_paths, compiled_path_parent)
+{
+    Node n;
+    n["a/b"] = 10;
+    n["c"] = 20;
+
+    Path p("a/b/../../c");
+    EXPECT_EQ(n.fetch_existing(p).to_int64(),20);
+    EXPECT_TRUE(n.has_path(p));
+
+    Path p_new("a/../d/e");
+    n[p_new] = 30;
+    EXPECT_EQ(n["d/e"].to_int64(),30);
+
+    Path p_bad("../a");
+    EXPECT_THROW(n.fetch_existing(p_bad),conduit::Error);
+    EXPECT_FALSE(n.has_path(p_bad));
+}
+
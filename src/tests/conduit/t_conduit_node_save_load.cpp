@@ -11,6 +11,8 @@
 #include "conduit.hpp"
 
 #include <iostream>
+#include <fstream>
+#include <iterator>
 #include "gtest/gtest.h"
 
 
@@ -509,3 +511,66 @@ TEST(conduit_node_save_load, load_save_array)
 
 
 
+
+//-----------------------------------------------------------------------------
+std::string
+read_file_bytes(const std::string &fname)
+{
+    std::ifstream ifs(fname.c_str(), std::ios::in | std::ios::binary);
+    return std::string((std::istreambuf_iterator<char>(ifs)),
+                        std::istreambuf_iterator<char>());
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_node_save_load, bin_binary_and_json_schema_files)
+{
+    Node n;
+    n["a/b"].set(DataType::int64(4));
+    n["a/c"].set(DataType::float32(3));
+    n["d"].append().set("text");
+    int64_array b_vals = n["a/b"].value();
+    b_vals.fill(-7);
+
+    std::string fname = "tout_node_save_load_bin_schema_files.conduit_bin";
+    Node n_compact;
+    n.compact_to(n_compact);
+    Node info;
+
+    // json schema files by default
+    EXPECT_EQ(Node::conduit_bin_schema_protocol(),"json");
+    n.save(fname);
+    std::string schema_txt;
+    schema_txt = read_file_bytes(fname + "_json");
+    EXPECT_FALSE(Schema::is_binary(schema_txt.data(),
+                                   (index_t)schema_txt.size()));
+    EXPECT_EQ(Schema(schema_txt).to_json(),n_compact.schema().to_json());
+
+    Node n_load;
+    n_load.load(fname);
+    EXPECT_FALSE(n.diff(n_load,info));
+
+    // opt into the binary schema encoding
+    Node::set_conduit_bin_schema_protocol("conduit_bin_schema");
+    n.save(fname);
+    Node::set_conduit_bin_schema_protocol("json");
+
+    schema_txt = read_file_bytes(fname + "_json");
+    EXPECT_TRUE(Schema::is_binary(schema_txt.data(),
+                                  (index_t)schema_txt.size()));
+    Schema s_file;
+    s_file.load(fname + "_json");
+    EXPECT_TRUE(s_file.equals(n_compact.schema()));
+
+    n_load.reset();
+    n_load.load(fname);
+    EXPECT_FALSE(n.diff(n_load,info));
+
+    n_load.reset();
+    n_load.mmap(fname);
+    EXPECT_FALSE(n.diff(n_load,info));
+    n_load.reset();
+
+    EXPECT_THROW(Node::set_conduit_bin_schema_protocol("yaml"),
+                 conduit::Error);
+    EXPECT_EQ(Node::conduit_bin_schema_protocol(),"json");
+}
@@ -9,12 +9,15 @@
 //-----------------------------------------------------------------------------
 
 #include "conduit.hpp"
+#include "conduit_execution.hpp"
 
 #include <iostream>
+#include <sstream>
 #include "gtest/gtest.h"
 
 
 using namespace conduit;
+using namespace conduit::utils;
 
 
 //-----------------------------------------------------------------------------
@@ -435,6 +438,463 @@ TEST(schema_basics, schema_to_string)
 }
 
 
+//-----------------------------------------------------------------------------
+TEST(schema_basics, object_index)
+{
+    index_t orig_threshold = Schema::object_index_threshold();
+    Schema::set_object_index_threshold(4);
+
+    Schema s;
+    for(int i=0; i < 100; i++)
+    {
+        std::ostringstream oss;
+        oss << "child_" << i;
+        s[oss.str()].set(DataType::int64(i+1));
+    }
+
+    EXPECT_EQ(s.number_of_children(),100);
+    EXPECT_TRUE(s.has_child("child_0"));
+    EXPECT_TRUE(s.has_child("child_99"));
+    EXPECT_FALSE(s.has_child("child_100"));
+    EXPECT_TRUE(s.has_path("child_42"));
+    EXPECT_EQ(s.child_index("child_42"),42);
+    EXPECT_EQ(s["child_42"].dtype().number_of_elements(),43);
+
+    // removal shifts indices
+    s.remove("child_10");
+    s.remove(0);
+    EXPECT_EQ(s.number_of_children(),98);
+    EXPECT_FALSE(s.has_child("child_0"));
+    EXPECT_FALSE(s.has_child("child_10"));
+    EXPECT_EQ(s.child_index("child_42"),40);
+    EXPECT_EQ(s["child_42"].dtype().number_of_elements(),43);
+
+    // rename
+    s.rename_child("child_42","renamed");
+    EXPECT_FALSE(s.has_child("child_42"));
+    EXPECT_EQ(s.child_index("renamed"),40);
+
+    // copies
+    Schema s2(s);
+    EXPECT_TRUE(s2.equals(s));
+    EXPECT_EQ(s2.child_index("renamed"),40);
+    EXPECT_EQ(s2.child_index("child_99"),97);
+
+    // removing below the threshold drops the index
+    while(s.number_of_children() > 2)
+    {
+        s.remove(0);
+    }
+    EXPECT_TRUE(s.has_child("child_98"));
+    EXPECT_TRUE(s.has_child("child_99"));
+    EXPECT_EQ(s.child_index("child_99"),1);
+
+    Schema::set_object_index_threshold(orig_threshold);
+}
+
+//-----------------------------------------------------------------------------
+TEST(schema_basics, object_index_lookup)
+{
+    index_t orig_threshold = Schema::object_index_threshold();
+
+    index_t num_children_cases[3] = {10, 100, 1000};
+    index_t num_lookups = 5000;
+
+    for(int c=0; c < 3; c++)
+    {
+        index_t num_children = num_children_cases[c];
+        std::vector<std::string> names;
+        for(index_t i=0; i < num_children; i++)
+        {
+            std::ostringstream oss;
+            oss << "field_" << i;
+            names.push_back(oss.str());
+        }
+
+        for(int use_index=0; use_index < 2; use_index++)
+        {
+            // threshold of 0 disables the hash index
+            Schema::set_object_index_threshold(use_index ? 1 : 0);
+
+            Schema s;
+            for(index_t i=0; i < num_children; i++)
+            {
+                s.add_child(names[(size_t)i]);
+            }
+
+            index_t sum = 0;
+            for(index_t i=0; i < num_lookups; i++)
+            {
+                sum += s.child_index(names[(size_t)(i % num_children)]);
+            }
+
+            index_t num_full = num_lookups / num_children;
+            index_t rem = num_lookups % num_children;
+            index_t expected = num_full * (num_children * (num_children - 1) / 2)
+                               + rem * (rem - 1) / 2;
+            EXPECT_EQ(sum,expected);
+        }
+    }
+
+    Schema::set_object_index_threshold(orig_threshold);
+}
+
+//-----------------------------------------------------------------------------
+TEST(schema_basics, fingerprint)
+{
+    Schema s;
+    s["a"].set(DataType::int64(10));
+    s["b/c"].set(DataType::float64(5));
+    s["d"].append().set(DataType::uint8(3));
+
+    uint64 fp = s.fingerprint();
+    // cached value is stable
+    EXPECT_EQ(fp,s.fingerprint());
+
+    // copies and identical schemas share a fingerprint
+    Schema s_copy(s);
+    EXPECT_EQ(fp,s_copy.fingerprint());
+    Schema s_same;
+    s_same["a"].set(DataType::int64(10));
+    s_same["b/c"].set(DataType::float64(5));
+    s_same["d"].append().set(DataType::uint8(3));
+    EXPECT_EQ(fp,s_same.fingerprint());
+    EXPECT_TRUE(s.equals(s_copy));
+    EXPECT_TRUE(s.compatible(s_copy));
+
+    // child order matters
+    Schema s_order;
+    s_order["b/c"].set(DataType::float64(5));
+    s_order["a"].set(DataType::int64(10));
+    s_order["d"].append().set(DataType::uint8(3));
+    EXPECT_NE(fp,s_order.fingerprint());
+
+    // changing a leaf changes the leaf and all of its ancestors
+    uint64 fp_b = s["b"].fingerprint();
+    s["b/c"].set(DataType::float64(6));
+    EXPECT_NE(fp,s.fingerprint());
+    EXPECT_NE(fp_b,s["b"].fingerprint());
+    EXPECT_FALSE(s.equals(s_copy));
+    s["b/c"].set(DataType::float64(5));
+    EXPECT_EQ(fp,s.fingerprint());
+
+    // in place dtype changes
+    s["a"].dtype().set_endianness(Endianness::BIG_ID);
+    EXPECT_NE(fp,s.fingerprint());
+    s["a"].dtype().set_endianness(Endianness::DEFAULT_ID);
+    EXPECT_EQ(fp,s.fingerprint());
+
+    // adding, renaming and removing children
+    s["e"].set(DataType::int32(1));
+    EXPECT_NE(fp,s.fingerprint());
+    s.rename_child("e","f");
+    uint64 fp_f = s.fingerprint();
+    EXPECT_NE(fp,fp_f);
+    s.remove("f");
+    EXPECT_EQ(fp,s.fingerprint());
+
+    s["d"].append().set(DataType::uint8(3));
+    EXPECT_NE(fp,s.fingerprint());
+    s["d"].remove(1);
+    EXPECT_EQ(fp,s.fingerprint());
+
+    // compatible still checks the structure when fingerprints differ
+    Schema s_sub;
+    s_sub["a"].set(DataType::int64(5));
+    EXPECT_NE(s_sub.fingerprint(),s.fingerprint());
+    EXPECT_TRUE(s.compatible(s_sub));
+    EXPECT_FALSE(s_sub.compatible(s));
+}
+
+//-----------------------------------------------------------------------------
+TEST(schema_basics, fingerprint_node_updates)
+{
+    Node n;
+    n["a"].set(DataType::int64(10));
+    n["b"].set(DataType::float64(5));
+
+    uint64 fp = n.schema().fingerprint();
+
+    // node mutations invalidate the fingerprint
+    n["b"].set(DataType::float32(5));
+    EXPECT_NE(fp,n.schema().fingerprint());
+    n["b"].set(DataType::float64(5));
+    EXPECT_EQ(fp,n.schema().fingerprint());
+
+    n.endian_swap_to_big();
+    uint64 fp_big = n.schema().fingerprint();
+    EXPECT_NE(fp,fp_big);
+    n.endian_swap_to_little();
+    EXPECT_NE(fp_big,n.schema().fingerprint());
+
+    Node n_other;
+    n_other["x"].set(DataType::int32(2));
+    uint64 fp_other = n_other.schema().fingerprint();
+    n["b"].swap(n_other["x"]);
+    EXPECT_NE(fp,n.schema().fingerprint());
+    EXPECT_NE(fp_other,n_other.schema().fingerprint());
+
+    // update_compatible fast path for identical compact trees
+    Node n_src;
+    n_src["a"].set(DataType::int64(10));
+    n_src["b"].set(DataType::float64(5));
+    n_src["c"].append().set(DataType::int32(4));
+    int64_array a_vals = n_src["a"].value();
+    float64_array b_vals = n_src["b"].value();
+    int32_array c_vals = n_src["c"][0].value();
+    a_vals.fill(42);
+    b_vals.fill(3.5);
+    c_vals.fill(-1);
+
+    Node n_src_compact;
+    n_src.compact_to(n_src_compact);
+
+    Node n_dest;
+    n_dest.set(n_src_compact.schema());
+    EXPECT_EQ(n_src_compact.schema().fingerprint(),
+              n_dest.schema().fingerprint());
+    n_dest.update_compatible(n_src_compact);
+    Node info;
+    EXPECT_FALSE(n_src.diff(n_dest,info));
+
+    // non contiguous source takes the regular path
+    n_dest.set(n_src_compact.schema());
+    n_dest.update_compatible(n_src);
+    EXPECT_FALSE(n_src.diff(n_dest,info));
+}
+
+//-----------------------------------------------------------------------------
+TEST(schema_basics, fingerprint_compatible_many_children)
+{
+    Schema s;
+    for(index_t i = 0; i < 50; i++)
+    {
+        std::ostringstream oss;
+        oss << "field_" << i;
+        s[oss.str() + "/values"].set(DataType::float64(100));
+        s[oss.str() + "/ids"].set(DataType::int32(100));
+    }
+    Schema s_copy(s);
+
+    // seed the cached fingerprints
+    EXPECT_EQ(s.fingerprint(),s_copy.fingerprint());
+    EXPECT_TRUE(s.compatible(s_copy));
+    EXPECT_TRUE(s_copy.compatible(s));
+
+    // a different schema falls back to the full walk
+    s_copy["field_0/extra"].set(DataType::int32(1));
+    EXPECT_NE(s.fingerprint(),s_copy.fingerprint());
+    EXPECT_TRUE(s_copy.compatible(s));
+
+    // as does an incompatible one
+    Schema s_bad(s);
+    s_bad["field_1/ids"].set(DataType::float64(100));
+    EXPECT_FALSE(s_bad.compatible(s));
+}
+
+//-----------------------------------------------------------------------------
+TEST(schema_basics, fingerprint_concurrent_reads)
+{
+    Schema s;
+    for(index_t i = 0; i < 200; i++)
+    {
+        std::ostringstream oss;
+        oss << "field_" << i;
+        s[oss.str() + "/values"].set(DataType::float64(100));
+    }
+    uint64 fp_expected = Schema(s).fingerprint();
+
+    // fill the (empty) cache from several threads at once
+    index_t orig_num_threads = execution::task::number_of_workers();
+    execution::task::set_number_of_threads(4);
+
+    std::vector<uint64> fps(16,0);
+    execution::task::run_tasks(16, [&](index_t i)
+    {
+        fps[(size_t)i] = s.fingerprint();
+    });
+
+    execution::task::set_number_of_threads(orig_num_threads);
+
+    for(size_t i = 0; i < fps.size(); i++)
+    {
+        EXPECT_EQ(fps[i],fp_expected);
+    }
+
+    // equals() rejects on a fingerprint mismatch, and still walks
+    // the tree when the fingerprints match
+    Schema s_diff(s);
+    s_diff["field_7/values"].set(DataType::float64(99));
+    EXPECT_FALSE(s.equals(s_diff));
+    EXPECT_TRUE(s.equals(Schema(s)));
+}
+
+//-----------------------------------------------------------------------------
+TEST(schema_basics, binary_round_trip)
+{
+    Schema s;
+    s["a"].set(DataType::int64(10));
+    s["b/c"].set(DataType::float64(5,80,16));
+    s["b/d"].set(DataType::char8_str(12));
+    s["b/big"].set(DataType::uint8(3,0,1,1,Endianness::BIG_ID));
+    s["e"].append().set(DataType::int32(2));
+    s["e"].append()["a"].set(DataType::uint16(1));
+    s["e"].append();
+    s["f"].set(DataType::object());
+    s["g"].set(DataType::list());
+    s["h"];
+    s.add_child("name/with/slashes").set(DataType::float32(4));
+    s["i/a"].set(DataType::int8(1));
+
+    std::vector<uint8> bin;
+    s.to_binary(bin);
+    EXPECT_TRUE(Schema::is_binary(bin.data(),(index_t)bin.size()));
+
+    std::string json = s.to_json();
+    EXPECT_FALSE(Schema::is_binary(json.data(),(index_t)json.size()));
+    // smaller than the json schema
+    EXPECT_LT(bin.size(),json.size());
+
+    Schema s_bin;
+    s_bin.from_binary(bin);
+    EXPECT_TRUE(s.equals(s_bin));
+    EXPECT_EQ(s.to_json(),s_bin.to_json());
+    EXPECT_TRUE(s_bin.has_child("name/with/slashes"));
+
+    // leaf and empty roots
+    Schema s_leaf(DataType::float64(7));
+    s_leaf.to_binary(bin);
+    s_bin.from_binary(bin);
+    EXPECT_TRUE(s_leaf.equals(s_bin));
+
+    Schema s_empty;
+    s_empty.to_binary(bin);
+    s_bin.from_binary(bin);
+    EXPECT_TRUE(s_bin.dtype().is_empty());
+
+    // generator protocol
+    s.to_binary(bin);
+    std::string bin_str(bin.begin(),bin.end());
+    Generator g(bin_str,"conduit_bin_schema");
+    Schema s_gen;
+    g.walk(s_gen);
+    EXPECT_TRUE(s.equals(s_gen));
+
+    Schema s_compact;
+    s.compact_to(s_compact);
+    s_compact.to_binary(bin);
+    bin_str.assign(bin.begin(),bin.end());
+    Node n_src(s_compact);
+    Node n_gen;
+    Generator g_data(bin_str,"conduit_bin_schema",n_src.data_ptr());
+    g_data.walk(n_gen);
+    EXPECT_TRUE(n_gen.schema().equals(s_compact));
+    EXPECT_EQ(n_gen["a"].data_ptr(),n_src["a"].data_ptr());
+
+    g_data.set_data_ptr(NULL);
+    g_data.walk(n_gen);
+    EXPECT_TRUE(n_gen.schema().equals(s_compact));
+    EXPECT_NE(n_gen["a"].data_ptr(),n_src["a"].data_ptr());
+
+    // negative offsets and strides (zigzag encoded)
+    Schema s_neg;
+    s_neg["a"].set(DataType::int64(4,-8,-16));
+    s_neg["b"].set(DataType::float32(2,-1,-4096));
+    std::vector<uint8> neg_bin;
+    s_neg.to_binary(neg_bin);
+    Schema s_neg_bin;
+    s_neg_bin.from_binary(neg_bin);
+    EXPECT_TRUE(s_neg.equals(s_neg_bin));
+    EXPECT_EQ(s_neg_bin["a"].dtype().offset(),-8);
+    EXPECT_EQ(s_neg_bin["b"].dtype().stride(),-4096);
+
+    // file round trip
+    std::string ofname = "tout_schema_binary_round_trip.conduit_bin_schema";
+    s.save(ofname,"conduit_bin_schema");
+    Schema s_load;
+    s_load.load(ofname);
+    EXPECT_TRUE(s.equals(s_load));
+}
+
+//-----------------------------------------------------------------------------
+TEST(schema_basics, binary_errors)
+{
+    Schema s;
+    s["a"].set(DataType::int64(10));
+    s["b/c"].set(DataType::float64(5));
+
+    std::vector<uint8> bin;
+    s.to_binary(bin);
+
+    Schema s_bin;
+    // not a binary schema
+    std::string json = s.to_json();
+    EXPECT_THROW(s_bin.from_binary(json.data(),(index_t)json.size()),
+                 conduit::Error);
+
+    // truncated data
+    for(size_t i = 0; i < bin.size(); i++)
+    {
+        EXPECT_THROW(s_bin.from_binary(bin.data(),(index_t)i),
+                     conduit::Error);
+    }
+
+    // unknown version
+    std::vector<uint8> bad = bin;
+    bad[4] = 99;
+    EXPECT_THROW(s_bin.from_binary(bad),conduit::Error);
+
+    // trailing data after the schema
+    std::vector<uint8> trailing = bin;
+    trailing.push_back(0);
+    EXPECT_THROW(s_bin.from_binary(trailing),conduit::Error);
+
+    // a failed parse leaves an empty schema
+    EXPECT_TRUE(s_bin.dtype().is_empty());
+}
+
+//-----------------------------------------------------------------------------
+TEST(schema_basics, binary_vs_json_mesh_schema)
+{
+    // mesh like schema with many leaves
+    Schema s;
+    for(index_t d = 0; d < 20; d++)
+    {
+        std::ostringstream oss;
+        oss << "domain_" << d;
+        Schema &dom = s[oss.str()];
+        dom["coordsets/coords/type"].set(DataType::char8_str(9));
+        dom["coordsets/coords/values/x"].set(DataType::float64(100));
+        dom["coordsets/coords/values/y"].set(DataType::float64(100));
+        dom["coordsets/coords/values/z"].set(DataType::float64(100));
+        dom["topologies/mesh/type"].set(DataType::char8_str(13));
+        dom["topologies/mesh/coordset"].set(DataType::char8_str(7));
+        dom["topologies/mesh/elements/shape"].set(DataType::char8_str(4));
+        dom["topologies/mesh/elements/connectivity"].set(DataType::int32(400));
+        for(index_t f = 0; f < 12; f++)
+        {
+            std::ostringstream f_oss;
+            f_oss << "fields/field_" << f;
+            dom[f_oss.str() + "/values"].set(DataType::float64(100));
+        }
+    }
+    Schema s_compact;
+    s.compact_to(s_compact);
+
+    std::string json = s_compact.to_json();
+    Schema s_json(json);
+
+    std::vector<uint8> bin;
+    s_compact.to_binary(bin);
+    Schema s_bin;
+    s_bin.from_binary(bin);
+
+    EXPECT_EQ(json,s_json.to_json());
+    EXPECT_TRUE(s_compact.equals(s_bin));
+    // names are stored once, so the binary schema is much smaller
+    EXPECT_LT(bin.size() * 4,json.size());
+}
+
 //-----------------------------------------------------------------------------
 ///
 /// commented out b/c spanned_bytes is now private, 
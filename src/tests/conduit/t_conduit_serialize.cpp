@@ -10,7 +10,9 @@
 
 #include "conduit.hpp"
 
+#include <fstream>
 #include <iostream>
+#include <iterator>
 #include "gtest/gtest.h"
 using namespace conduit;
 
@@ -193,3 +195,60 @@ TEST(conduit_serialize, seralize_multiple)
 }
 
 
+
+//-----------------------------------------------------------------------------
+TEST(conduit_serialize, serialize_iov)
+{
+    float64 vals[] = { 100.0, -100.0,
+                       200.0, -200.0,
+                       300.0, -300.0};
+
+    Node n;
+    n["a"].set(DataType::int32(4));
+    n["b"].set(DataType::float64(3));
+    // strided, not compact
+    n["c"].set_external(DataType::float64(3,8,16),vals);
+    n["d"].set_external(vals,2);
+    n["e"]; // empty
+
+    int32_array a_vals = n["a"].value();
+    float64_array b_vals = n["b"].value();
+    for(index_t i=0; i < 4; i++)
+        a_vals[i] = (int32) i;
+    for(index_t i=0; i < 3; i++)
+        b_vals[i] = (float64) i * 0.5;
+
+    std::vector<uint8> bytes;
+    n.serialize(bytes);
+
+    std::vector<std::pair<const void*,index_t> > iov;
+    std::vector<uint8> staging;
+    n.serialize_iov(iov,staging);
+
+    // only the strided leaf is staged
+    EXPECT_EQ(staging.size(),(size_t)(3 * sizeof(float64)));
+
+    std::vector<uint8> iov_bytes;
+    for(size_t i=0; i < iov.size(); i++)
+    {
+        const uint8 *ptr = (const uint8*) iov[i].first;
+        iov_bytes.insert(iov_bytes.end(), ptr, ptr + iov[i].second);
+    }
+    EXPECT_EQ(iov_bytes, bytes);
+
+    // pieces that are adjacent in memory are merged, a compact node
+    // is described by a single piece
+    Node n_compact;
+    n.compact_to(n_compact);
+    n_compact.serialize_iov(iov,staging);
+    ASSERT_EQ(iov.size(),(size_t)1);
+    EXPECT_EQ(iov[0].first,n_compact.data_ptr());
+    EXPECT_EQ(iov[0].second,n_compact.total_bytes_compact());
+
+    // ofstream serialize matches
+    n.serialize("tout_serialize_iov.bin");
+    std::ifstream ifs("tout_serialize_iov.bin", std::ios_base::binary);
+    std::vector<uint8> file_bytes((std::istreambuf_iterator<char>(ifs)),
+                                  std::istreambuf_iterator<char>());
+    EXPECT_EQ(file_bytes, bytes);
+}
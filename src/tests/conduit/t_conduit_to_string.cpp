@@ -362,3 +362,39 @@ c:
     EXPECT_EQ(tres,texpect);
 
 }
+
+//-----------------------------------------------------------------------------
+TEST(conduit_to_string, number_emission_round_trip)
+{
+    const index_t nele = 10000;
+    Node n;
+    n["int64"].set(DataType::int64(nele));
+    n["float32"].set(DataType::float32(nele));
+    n["float64"].set(DataType::float64(nele));
+
+    int64   *i64_ptr = n["int64"].value();
+    float32 *f32_ptr = n["float32"].value();
+    float64 *f64_ptr = n["float64"].value();
+    for(index_t i = 0; i < nele; i++)
+    {
+        i64_ptr[i] = i * 7919 - nele;
+        f32_ptr[i] = (float32)(i * 0.1);
+        f64_ptr[i] = i * 1.0e-3 + 1.0 / (i + 1);
+    }
+
+    const char *names[3] = {"int64","float32","float64"};
+    for(int i = 0; i < 3; i++)
+    {
+        const Node &n_leaf = n[names[i]];
+
+        // check that values round trip exactly
+        Node n_parsed, n_parsed_conv, info;
+        n_parsed.parse(n_leaf.to_json(),"json");
+        n_parsed.to_data_type(n_leaf.dtype().id(),n_parsed_conv);
+        EXPECT_FALSE(n_leaf.diff(n_parsed_conv,info,0.0));
+
+        n_parsed.parse(n_leaf.to_yaml(),"yaml");
+        n_parsed.to_data_type(n_leaf.dtype().id(),n_parsed_conv);
+        EXPECT_FALSE(n_leaf.diff(n_parsed_conv,info,0.0));
+    }
+}
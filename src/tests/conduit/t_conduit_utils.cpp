@@ -10,7 +10,10 @@
 
 
 #include "conduit.hpp"
+#include "conduit_execution.hpp"
 
+#include <algorithm>
+#include <cstring>
 #include <iostream>
 #include <limits>
 #include "gtest/gtest.h"
@@ -319,6 +322,59 @@ TEST(conduit_utils, float64_to_string)
     EXPECT_EQ("nan",utils::float64_to_string(v));
 }
 
+//-----------------------------------------------------------------------------
+TEST(conduit_utils, append_json_number)
+{
+    std::string res;
+    utils::append_json_number(res,(int64)-42);
+    EXPECT_EQ("-42",res);
+
+    res.clear();
+    utils::append_json_number(res,std::numeric_limits<uint64>::max());
+    EXPECT_EQ("18446744073709551615",res);
+
+    // other native types
+    res.clear();
+    utils::append_json_number(res,(int8)-3);
+    utils::append_json_number(res,(unsigned char)200);
+    EXPECT_EQ("-3200",res);
+
+    // floats always have a '.' or exponent
+    res.clear();
+    utils::append_json_number(res,10.0);
+    EXPECT_EQ("10.0",res);
+
+    res.clear();
+    utils::append_json_number(res,1.0e16);
+    EXPECT_EQ("1e+16",res);
+
+    // shortest form that round trips
+    res.clear();
+    utils::append_json_number(res,0.1);
+    EXPECT_EQ("0.1",res);
+
+    res.clear();
+    utils::append_json_number(res,0.1f);
+    EXPECT_EQ("0.1",res);
+
+    res.clear();
+    utils::append_json_number(res,1.0/3.0);
+    EXPECT_EQ(1.0/3.0,utils::string_to_value<float64>(res));
+
+    // inf and nan are quoted
+    res.clear();
+    utils::append_json_number(res,std::numeric_limits<float64>::infinity());
+    EXPECT_EQ("\"inf\"",res);
+
+    res.clear();
+    utils::append_json_number(res,-std::numeric_limits<float32>::infinity());
+    EXPECT_EQ("\"-inf\"",res);
+
+    res.clear();
+    utils::append_json_number(res,std::numeric_limits<float64>::quiet_NaN());
+    EXPECT_EQ("\"nan\"",res);
+}
+
 
 
 //-----------------------------------------------------------------------------
@@ -429,6 +485,70 @@ TEST(conduit_utils, base64_enc_dec)
     EXPECT_EQ(n_src["c"].as_int32(), n_res["c"].as_int32());
 }
 
+//-----------------------------------------------------------------------------
+// encodes, checks the encoded length and padding, and decodes
+void
+check_base64_round_trip(const std::vector<uint8> &src)
+{
+    const index_t nbytes = (index_t)src.size();
+    std::vector<char> enc((size_t)utils::base64_encode_buffer_size(nbytes));
+    utils::base64_encode(src.data(),nbytes,enc.data());
+
+    const index_t enc_len = (index_t)strlen(enc.data());
+    EXPECT_EQ(enc_len, ((nbytes + 2) / 3) * 4);
+
+    std::vector<uint8> dec((size_t)utils::base64_decode_buffer_size(enc_len));
+    utils::base64_decode(enc.data(),enc_len,dec.data());
+    EXPECT_TRUE(std::equal(src.begin(),src.end(),dec.begin()));
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_utils, base64_enc_dec_sizes)
+{
+    // known values, including all padding cases
+    const char *txts[] = {"", "f", "fo", "foo", "foob", "fooba", "foobar"};
+    const char *encs[] = {"", "Zg==", "Zm8=", "Zm9v", "Zm9vYg==",
+                          "Zm9vYmE=", "Zm9vYmFy"};
+    for(int i = 0; i < 7; i++)
+    {
+        index_t nbytes = (index_t)strlen(txts[i]);
+        std::vector<char> enc((size_t)utils::base64_encode_buffer_size(nbytes));
+        utils::base64_encode(txts[i],nbytes,enc.data());
+        EXPECT_EQ(std::string(enc.data()),std::string(encs[i]));
+
+        index_t enc_len = (index_t)strlen(encs[i]);
+        std::vector<char> dec((size_t)utils::base64_decode_buffer_size(enc_len),0);
+        utils::base64_decode(encs[i],enc_len,dec.data());
+        EXPECT_EQ(std::string(dec.data(),(size_t)nbytes),std::string(txts[i]));
+    }
+
+    // chars outside the alphabet are skipped
+    const std::string enc_ws = "Zm9v\nYmFy\r\n";
+    std::vector<char> dec((size_t)utils::base64_decode_buffer_size(enc_ws.size()),0);
+    utils::base64_decode(enc_ws.c_str(),(index_t)enc_ws.size(),dec.data());
+    EXPECT_EQ(std::string(dec.data(),6),"foobar");
+
+    // all byte values, and each tail size
+    std::vector<uint8> src;
+    for(int i = 0; i < 1024; i++)
+    {
+        src.push_back((uint8)(i * 7 + 3));
+        check_base64_round_trip(src);
+    }
+
+    // buffers of at least 1 MiB are split into chunks (~6 here), also
+    // use threads
+    src.resize((1 << 20) + 2);
+    for(size_t i = 0; i < src.size(); i++)
+    {
+        src[i] = (uint8)((i * 2654435761u) >> 13);
+    }
+    check_base64_round_trip(src);
+    execution::task::set_number_of_threads(4);
+    check_base64_round_trip(src);
+    execution::task::set_number_of_threads(1);
+}
+
 //-----------------------------------------------------------------------------
 TEST(conduit_utils, dir_create_and_remove_tests)
 {
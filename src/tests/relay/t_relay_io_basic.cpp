@@ -43,6 +43,36 @@ TEST(conduit_relay_io_basic, basic_bin)
     EXPECT_EQ(n_load["c"].as_uint32(), c_val);
 }
 
+//-----------------------------------------------------------------------------
+TEST(conduit_relay_io_basic, basic_bin_mmap)
+{
+    Node n;
+    n["a"].set(DataType::float64(100));
+    n["b"] = "value";
+    float64_array a_vals = n["a"].value();
+    for(index_t i = 0; i < 100; i++)
+    {
+        a_vals[i] = 1.0 * i;
+    }
+
+    io::save(n, "test_conduit_relay_io_dump_mmap.conduit_bin");
+
+    Node opts;
+    opts["mmap"] = "true";
+    opts["mmap_advice"] = "random";
+
+    Node n_load, info;
+    io::load("test_conduit_relay_io_dump_mmap.conduit_bin",opts,n_load);
+    EXPECT_EQ(n_load.total_bytes_mmaped(),n.total_bytes_compact());
+    EXPECT_FALSE(n.diff(n_load,info));
+
+    // sub paths are copied out of the mapping
+    Node n_sub;
+    io::load("test_conduit_relay_io_dump_mmap.conduit_bin:a",opts,n_sub);
+    EXPECT_EQ(n_sub.total_bytes_mmaped(),0);
+    EXPECT_FALSE(n["a"].diff(n_sub,info));
+}
+
 //-----------------------------------------------------------------------------
 TEST(conduit_relay_io_basic, json)
 {
@@ -295,3 +325,34 @@ TEST(conduit_relay_io_basic, save_empty)
     Node n;
     io::save(n, "test_conduit_relay_io_save_empty.conduit_bin");
 }
+
+//-----------------------------------------------------------------------------
+TEST(conduit_relay_io_basic, instrumentation)
+{
+    Node n;
+    n["a"].set(DataType::float64(10));
+    n["b"].set(DataType::int32(4));
+
+    instrumentation::enable();
+    instrumentation::reset();
+
+    io::save(n, "tout_relay_io_basic_instrumentation.conduit_bin");
+
+    Node n_load;
+    io::load("tout_relay_io_basic_instrumentation.conduit_bin",n_load);
+
+    Node n_merged;
+    n_merged["c"] = 1.0;
+    io::load_merged("tout_relay_io_basic_instrumentation.conduit_bin",
+                    n_merged);
+
+    Node info;
+    instrumentation::snapshot(info);
+    info.print();
+    instrumentation::disable();
+
+    EXPECT_EQ(info["relay_io/writes"].to_uint64(),1);
+    EXPECT_EQ(info["relay_io/bytes_written"].to_uint64(),96);
+    EXPECT_EQ(info["relay_io/reads"].to_uint64(),2);
+    EXPECT_EQ(info["relay_io/bytes_read"].to_uint64(),192);
+}
@@ -889,3 +889,430 @@ TEST(conduit_relay_io_handle, test_ref_path_error_msg)
     }
 
 }
+
+//-----------------------------------------------------------------------------
+TEST(conduit_relay_io_handle, test_async_write)
+{
+    std::vector<std::string> protocols;
+    protocols.push_back("conduit_bin");
+    protocols.push_back("yaml");
+
+    Node n_about;
+    io::about(n_about);
+
+    if(n_about["protocols/hdf5"].as_string() == "enabled")
+        protocols.push_back("hdf5");
+
+    std::vector<std::string> snapshots;
+    snapshots.push_back("compact");
+    snapshots.push_back("copy_on_write");
+
+    for(size_t i = 0; i < protocols.size(); i++)
+    {
+        for(size_t j = 0; j < snapshots.size(); j++)
+        {
+            std::string protocol = protocols[i];
+            std::string tfile = "tout_conduit_relay_io_handle_async_" +
+                                snapshots[j] + "." + protocol;
+            CONDUIT_INFO("Testing async Relay IO Handle with protocol: "
+                         << protocol << " snapshot: " << snapshots[j]);
+
+            utils::remove_path_if_exists(tfile);
+
+            Node opts;
+            opts["async"] = "true";
+            opts["async_snapshot"] = snapshots[j];
+            opts["async_max_pending"] = 2;
+
+            Node n;
+            n["a"].set(DataType::float64(100));
+            n["b"] = (int64) 8;
+
+            io::IOHandle h;
+            h.open(tfile,opts);
+
+            Node expected;
+            for(int step = 0; step < 5; step++)
+            {
+                float64_array vals = n["a"].value();
+                vals.fill(step);
+                std::ostringstream oss;
+                oss << "step_" << step;
+                h.write(n,oss.str());
+                expected[oss.str()].set(n);
+                // changing the node after write must not change
+                // what is written (with copy_on_write, pointers fetched
+                // before the write refer to the shared buffer)
+                float64_array new_vals = n["a"].value();
+                new_vals.fill(-1.0);
+            }
+
+            h.flush();
+            EXPECT_TRUE(h.has_path("step_4/a"));
+
+            h.write(n["b"],"last");
+            h.close();
+
+            expected["last"].set(n["b"]);
+
+            Node n_read;
+            h.open(tfile);
+            h.read(n_read);
+            h.close();
+
+            Node info;
+            bool has_diff = expected.diff(n_read, info, 0.0, true);
+            EXPECT_FALSE(has_diff);
+            if(has_diff)
+            {
+                info.print();
+            }
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_relay_io_handle, test_async_write_errors)
+{
+    Node opts;
+    opts["async"] = "true";
+    opts["async_snapshot"] = "bad";
+
+    io::IOHandle h;
+    EXPECT_THROW(h.open("tout_conduit_relay_io_handle_async_error.conduit_bin",
+                        opts),
+                 conduit::Error);
+
+    // flush is a no-op for sync handles
+    utils::remove_path_if_exists("tout_conduit_relay_io_handle_async_error.conduit_bin");
+    h.open("tout_conduit_relay_io_handle_async_error.conduit_bin");
+    h.flush();
+    h.close();
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_relay_io_handle, test_read_schema)
+{
+    std::vector<std::string> protocols;
+
+    protocols.push_back("conduit_bin");
+    protocols.push_back("json");
+    protocols.push_back("yaml");
+
+    Node n_about;
+    io::about(n_about);
+
+    if(n_about["protocols/hdf5"].as_string() == "enabled")
+        protocols.push_back("hdf5");
+
+    Node n;
+    n["a"].set(DataType::float64(10));
+    n["b/c"].set(DataType::int32(5));
+    n["b/d"] = "a string!";
+    n["e"].append().set((int64)1);
+    n["e"].append().set(DataType::uint8(3));
+
+    for (std::vector<std::string>::const_iterator itr = protocols.begin();
+             itr < protocols.end(); ++itr)
+    {
+        std::string protocol = *itr;
+        CONDUIT_INFO("Testing Relay IO Handle read_schema with protocol: "
+                     << protocol );
+        std::string test_file_name = "tout_conduit_relay_handle_read_schema."
+                                     + protocol;
+        conduit::relay::io::save(n,test_file_name,protocol);
+
+        Node opts;
+        opts["mode"] = "r";
+
+        // the binary protocols can provide a schema without reading data
+        bool expect_no_reads = protocol == "conduit_bin" ||
+                               protocol == "hdf5";
+
+        instrumentation::enable();
+        instrumentation::reset();
+
+        io::IOHandle h;
+        h.open(test_file_name, protocol, opts);
+
+        Schema s_root;
+        h.read_schema(s_root);
+
+        Schema s_sub;
+        h.read_schema("b",s_sub);
+
+        Node n_stats;
+        instrumentation::snapshot(n_stats);
+        instrumentation::disable();
+
+        if(expect_no_reads)
+        {
+            EXPECT_EQ(n_stats["relay_io/reads"].to_uint64(),0);
+        }
+
+        s_root.print();
+        EXPECT_TRUE(s_root.is_compact());
+        EXPECT_TRUE(s_root.has_path("b/c"));
+        EXPECT_EQ(s_root["a"].dtype().number_of_elements(),10);
+        EXPECT_EQ(s_root["b/c"].dtype().number_of_elements(),5);
+        EXPECT_TRUE(s_root["e"].dtype().is_list());
+        EXPECT_EQ(s_root["e"].number_of_children(),2);
+
+        // the schema matches the compact form of what read() returns
+        Node n_read;
+        h.read(n_read);
+        Schema s_read;
+        n_read.schema().compact_to(s_read);
+        EXPECT_EQ(s_root.to_json(),s_read.to_json());
+
+        n_read.reset();
+        h.read("b",n_read);
+        n_read.schema().compact_to(s_read);
+        EXPECT_EQ(s_sub.to_json(),s_read.to_json());
+
+        h.close();
+    }
+
+    // write only handles can't read schemas
+    Node opts;
+    opts["mode"] = "w";
+    io::IOHandle h;
+    h.open("tout_conduit_relay_handle_read_schema.conduit_bin", opts);
+    Schema s;
+    EXPECT_THROW(h.read_schema(s),conduit::Error);
+    h.close();
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_relay_io_handle, test_lazy_open_write)
+{
+    // handles load existing files on first use, make sure writes
+    // still merge with the existing contents
+    Node n;
+    n["a"] = (int64) 10;
+    n["b"] = (int64) 20;
+    std::string test_file_name = "tout_conduit_relay_handle_lazy_open.json";
+    conduit::relay::io::save(n,test_file_name,"json");
+
+    io::IOHandle h;
+    h.open(test_file_name);
+    Node n_val;
+    n_val = (int64) 30;
+    h.write(n_val,"c");
+    h.close();
+
+    Node n_load;
+    conduit::relay::io::load(test_file_name,"json",n_load);
+    EXPECT_EQ(n_load["a"].to_int64(),10);
+    EXPECT_EQ(n_load["b"].to_int64(),20);
+    EXPECT_EQ(n_load["c"].to_int64(),30);
+
+    // opening and closing without changes leaves the file as is
+    h.open(test_file_name);
+    h.close();
+    n_load.reset();
+    conduit::relay::io::load(test_file_name,"json",n_load);
+    EXPECT_EQ(n_load.number_of_children(),3);
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_relay_io_handle, test_sub_range_reads)
+{
+    std::vector<std::string> protocols;
+
+    protocols.push_back("conduit_bin");
+    protocols.push_back("json");
+    protocols.push_back("yaml");
+
+    Node n_about;
+    io::about(n_about);
+
+    if(n_about["protocols/hdf5"].as_string() == "enabled")
+        protocols.push_back("hdf5");
+
+    // data holds a 2 x 3 x 4 (z,y,x) array
+    Node n;
+    n["data"].set(DataType::int64(24));
+    int64_array data_vals = n["data"].value();
+    for(index_t i=0; i < 24; i++)
+    {
+        data_vals[i] = i;
+    }
+
+    n["tree/a"].set(DataType::float64(10));
+    n["tree/b"].set(DataType::int32(10));
+    float64_array a_vals = n["tree/a"].value();
+    int32_array   b_vals = n["tree/b"].value();
+    for(index_t i=0; i < 10; i++)
+    {
+        a_vals[i] = (float64) i;
+        b_vals[i] = (int32) i;
+    }
+
+    for (std::vector<std::string>::const_iterator itr = protocols.begin();
+             itr < protocols.end(); ++itr)
+    {
+        std::string protocol = *itr;
+        CONDUIT_INFO("Testing Relay IO Handle sub-range reads with protocol: "
+                     << protocol );
+        std::string test_file_name = "tout_conduit_relay_handle_sub_range."
+                                     + protocol;
+        conduit::relay::io::save(n,test_file_name,protocol);
+
+        Node opts;
+        opts["mode"] = "r";
+
+        io::IOHandle h;
+        h.open(test_file_name, protocol, opts);
+
+        Node n_read, read_opts;
+
+        // 1d offset, stride and size apply to each leaf of a tree
+        read_opts["offset"] = 2;
+        read_opts["stride"] = 3;
+        read_opts["size"]   = 3;
+        h.read("tree",n_read,read_opts);
+        n_read.print();
+        EXPECT_EQ(n_read["a"].dtype().number_of_elements(),3);
+        EXPECT_EQ(n_read["b"].dtype().number_of_elements(),3);
+        // (plain json reads integers back as int64)
+        Node n_b;
+        n_read["b"].to_int32_array(n_b);
+        float64_array a_read = n_read["a"].value();
+        int32_array   b_read = n_b.value();
+        EXPECT_EQ(a_read[0],2.0);
+        EXPECT_EQ(a_read[1],5.0);
+        EXPECT_EQ(a_read[2],8.0);
+        EXPECT_EQ(b_read[0],2);
+        EXPECT_EQ(b_read[1],5);
+        EXPECT_EQ(b_read[2],8);
+
+        // size defaults to the rest of the array
+        n_read.reset();
+        read_opts.reset();
+        read_opts["offset"] = 7;
+        h.read("tree/b",n_read,read_opts);
+        EXPECT_EQ(n_read.dtype().number_of_elements(),3);
+        n_read.to_int32_array(n_b);
+        b_read = n_b.value();
+        EXPECT_EQ(b_read[0],7);
+        EXPECT_EQ(b_read[2],9);
+
+        // z-slab of the 3d array
+        index_t shape[3]   = {2, 3, 4};
+        index_t offsets[3] = {1, 0, 0};
+        index_t sizes[3]   = {1, 3, 4};
+        index_t strides[3] = {1, 1, 2};
+
+        n_read.reset();
+        read_opts.reset();
+        read_opts["shape"].set(shape,3);
+        read_opts["offsets"].set(offsets,3);
+        read_opts["sizes"].set(sizes,3);
+        h.read("data",n_read,read_opts);
+        n_read.print();
+        EXPECT_EQ(n_read.dtype().number_of_elements(),12);
+        int64_array data_read = n_read.value();
+        for(index_t i=0; i < 12; i++)
+        {
+            EXPECT_EQ(data_read[i],12 + i);
+        }
+
+        // every other x
+        n_read.reset();
+        read_opts.reset();
+        read_opts["shape"].set(shape,3);
+        read_opts["strides"].set(strides,3);
+        h.read("data",n_read,read_opts);
+        n_read.print();
+        EXPECT_EQ(n_read.dtype().number_of_elements(),12);
+        data_read = n_read.value();
+        for(index_t i=0; i < 12; i++)
+        {
+            EXPECT_EQ(data_read[i],2 * i);
+        }
+
+        // inner 2 x 2 x 2 block
+        n_read.reset();
+        read_opts.reset();
+        offsets[0] = 0; offsets[1] = 1; offsets[2] = 1;
+        sizes[0] = 2; sizes[1] = 2; sizes[2] = 2;
+        read_opts["shape"].set(shape,3);
+        read_opts["offsets"].set(offsets,3);
+        read_opts["sizes"].set(sizes,3);
+        h.read("data",n_read,read_opts);
+        n_read.print();
+        EXPECT_EQ(n_read.dtype().number_of_elements(),8);
+        data_read = n_read.value();
+        int64 block_vals[8] = {5, 6, 9, 10, 17, 18, 21, 22};
+        for(index_t i=0; i < 8; i++)
+        {
+            EXPECT_EQ(data_read[i],block_vals[i]);
+        }
+
+        // error conditions
+
+        // zero stride
+        n_read.reset();
+        read_opts.reset();
+        read_opts["stride"] = 0;
+        EXPECT_THROW(h.read("data",n_read,read_opts),conduit::Error);
+
+        // neg size
+        n_read.reset();
+        read_opts.reset();
+        read_opts["size"] = -100;
+        EXPECT_THROW(h.read("data",n_read,read_opts),conduit::Error);
+
+        // huge size
+        n_read.reset();
+        read_opts.reset();
+        read_opts["size"] = 1000;
+        EXPECT_THROW(h.read("data",n_read,read_opts),conduit::Error);
+
+        // huge offset
+        n_read.reset();
+        read_opts.reset();
+        read_opts["offset"] = 1000;
+        EXPECT_THROW(h.read("data",n_read,read_opts),conduit::Error);
+
+        // shape that doesn't match the number of elements
+        n_read.reset();
+        read_opts.reset();
+        index_t bad_shape[2] = {5, 5};
+        read_opts["shape"].set(bad_shape,2);
+        EXPECT_THROW(h.read("data",n_read,read_opts),conduit::Error);
+
+        // wrong number of offsets for the shape
+        n_read.reset();
+        read_opts.reset();
+        read_opts["shape"].set(shape,3);
+        read_opts["offsets"].set(offsets,2);
+        EXPECT_THROW(h.read("data",n_read,read_opts),conduit::Error);
+
+        h.close();
+    }
+
+    // conduit_bin handles only read the selected bytes
+    instrumentation::enable();
+    instrumentation::reset();
+
+    Node opts;
+    opts["mode"] = "r";
+    io::IOHandle h;
+    h.open("tout_conduit_relay_handle_sub_range.conduit_bin",
+           "conduit_bin",
+           opts);
+
+    Node n_read, read_opts;
+    read_opts["offset"] = 12;
+    h.read("data",n_read,read_opts);
+    h.close();
+
+    Node n_stats;
+    instrumentation::snapshot(n_stats);
+    instrumentation::disable();
+
+    EXPECT_EQ(n_read.dtype().number_of_elements(),12);
+    EXPECT_EQ(n_stats["relay_io/bytes_read"].to_uint64(),12 * sizeof(int64));
+}
@@ -283,6 +283,121 @@ TEST(conduit_relay_io_handle, test_sidre_bad_reads)
 
 }
 
+//-----------------------------------------------------------------------------
+TEST(conduit_relay_io_handle, test_sidre_read_schema)
+{
+    Node io_protos;
+    relay::io::about(io_protos["io"]);
+    bool hdf5_enabled = io_protos["io/protocols/hdf5"].as_string() == "enabled";
+    if(!hdf5_enabled)
+    {
+        CONDUIT_INFO("HDF5 disabled, skipping sidre read_schema test");
+        return;
+    }
+
+    std::vector<std::string> tests;
+    // single tree case, with scalar, string, buffer and external views
+    tests.push_back(relay_test_data_path("texample_sidre_basic_ds_demo.sidre_hdf5"));
+    tests.push_back(relay_test_data_path("texample_sidre_basic_ds_demo.sidre_hdf5")
+                    + ":my_arrays");
+    // spio index case
+    tests.push_back(relay_test_data_path("out_spio_blueprint_example.root")
+                    + ":1/mesh");
+    tests.push_back(relay_test_data_path("out_spio_blueprint_example.root")
+                    + ":root/blueprint_index");
+
+    for(size_t i=0; i < tests.size(); i++)
+    {
+        std::string file_path;
+        std::string sub_path;
+        utils::split_file_path(tests[i],
+                               std::string(":"),
+                               file_path,
+                               sub_path);
+        io::IOHandle h;
+        h.open(file_path,"sidre_hdf5");
+
+        Schema s;
+        h.read_schema(sub_path,s);
+
+        // the schema matches the compact form of what read() returns
+        Node n_read;
+        h.read(sub_path,n_read);
+        Schema s_read;
+        n_read.schema().compact_to(s_read);
+        EXPECT_EQ(s.to_json(),s_read.to_json());
+        h.close();
+    }
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_relay_io_handle, test_sidre_sub_range_reads)
+{
+    Node io_protos;
+    relay::io::about(io_protos["io"]);
+    bool hdf5_enabled = io_protos["io/protocols/hdf5"].as_string() == "enabled";
+    if(!hdf5_enabled)
+    {
+        CONDUIT_INFO("HDF5 disabled, skipping sidre sub-range read test");
+        return;
+    }
+
+    io::IOHandle h;
+    h.open(relay_test_data_path("texample_sidre_basic_ds_demo.sidre_hdf5"),
+           "sidre_hdf5");
+
+    // buffer views (including strided views of a shared buffer),
+    // external views and empty views
+    Node n_read, opts;
+    opts["offset"] = 1;
+    opts["size"]   = 2;
+    h.read("my_arrays",n_read,opts);
+    n_read.print();
+
+    EXPECT_EQ(n_read["a0_i64"].dtype().number_of_elements(),0);
+    EXPECT_EQ(n_read["b_v0"].dtype().number_of_elements(),0);
+
+    int64_array a5_vals = n_read["a5_i64"].value();
+    EXPECT_EQ(a5_vals.number_of_elements(),2);
+    EXPECT_EQ(a5_vals[0],1);
+    EXPECT_EQ(a5_vals[1],2);
+
+    int64_array a5_ext_vals = n_read["a5_i64_ext"].value();
+    EXPECT_EQ(a5_ext_vals.number_of_elements(),2);
+    EXPECT_EQ(a5_ext_vals[0],1);
+    EXPECT_EQ(a5_ext_vals[1],2);
+
+    float64_array b_v1_vals = n_read["b_v1"].value();
+    EXPECT_EQ(b_v1_vals.number_of_elements(),2);
+    EXPECT_EQ(b_v1_vals[0],1.0);
+    EXPECT_EQ(b_v1_vals[1],1.0);
+
+    float64_array b_v2_vals = n_read["b_v2"].value();
+    EXPECT_EQ(b_v2_vals.number_of_elements(),2);
+    EXPECT_EQ(b_v2_vals[0],2.0);
+    EXPECT_EQ(b_v2_vals[1],2.0);
+
+    // strided read of a single buffer view
+    n_read.reset();
+    opts.reset();
+    opts["stride"] = 2;
+    h.read("my_arrays/a5_i64",n_read,opts);
+    n_read.print();
+    a5_vals = n_read.value();
+    EXPECT_EQ(a5_vals.number_of_elements(),3);
+    EXPECT_EQ(a5_vals[0],0);
+    EXPECT_EQ(a5_vals[1],2);
+    EXPECT_EQ(a5_vals[2],4);
+
+    // out of range selections are errors
+    n_read.reset();
+    opts.reset();
+    opts["offset"] = 10;
+    EXPECT_THROW(h.read("my_arrays/b_v2",n_read,opts),conduit::Error);
+
+    h.close();
+}
+
 //-----------------------------------------------------------------------------
 TEST(conduit_relay_io_handle, test_sidre_read_mesh_bp)
 {
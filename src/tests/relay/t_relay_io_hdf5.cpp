@@ -9,7 +9,9 @@
 //-----------------------------------------------------------------------------
 
 #include "conduit_relay.hpp"
+#include "conduit_blueprint.hpp"
 #include "conduit_relay_io_hdf5.hpp"
+#include "conduit_execution.hpp"
 #include "hdf5.h"
 #include <math.h>
 #include <stdlib.h>
@@ -2006,7 +2008,271 @@ TEST(conduit_relay_io_hdf5, conduit_hdf5_write_read_string_compress)
     EXPECT_EQ(check_h5_open_ids(),DO_NO_HARM);
 }
 //
+//-----------------------------------------------------------------------------
+#if H5_VERSION_GE(1, 10, 5)
+// reads the raw (compressed) bytes and filter mask of each chunk
+// of a chunked dataset
+void
+hdf5_dataset_raw_chunks(const std::string &file_path,
+                        const std::string &dset_path,
+                        std::vector<std::vector<uint8> > &chunks,
+                        std::vector<unsigned int> &filter_masks)
+{
+    chunks.clear();
+    filter_masks.clear();
+
+    hid_t h5_file_id = H5Fopen(file_path.c_str(),
+                               H5F_ACC_RDONLY,
+                               H5P_DEFAULT);
+    hid_t h5_dset_id = H5Dopen(h5_file_id, dset_path.c_str(), H5P_DEFAULT);
+    hid_t h5_space_id = H5Dget_space(h5_dset_id);
+
+    hsize_t num_chunks = 0;
+    H5Dget_num_chunks(h5_dset_id, h5_space_id, &num_chunks);
+    chunks.resize((size_t)num_chunks);
+    filter_masks.resize((size_t)num_chunks);
+
+    for(hsize_t i = 0; i < num_chunks; i++)
+    {
+        hsize_t offset[1] = {0};
+        haddr_t addr = 0;
+        hsize_t num_bytes = 0;
+        H5Dget_chunk_info(h5_dset_id, h5_space_id, i,
+                          offset, &filter_masks[i], &addr, &num_bytes);
+        chunks[i].resize((size_t)num_bytes);
+        uint32_t read_mask = 0;
+        H5Dread_chunk(h5_dset_id, H5P_DEFAULT, offset,
+                      &read_mask, chunks[i].data());
+    }
+
+    H5Sclose(h5_space_id);
+    H5Dclose(h5_dset_id);
+    H5Fclose(h5_file_id);
+}
+#endif
+
+//-----------------------------------------------------------------------------
+TEST(conduit_relay_io_hdf5, conduit_hdf5_write_read_gzip_parallel)
+{
+    // get objects in flight already
+    int DO_NO_HARM = check_h5_open_ids();
+
+    std::string tout_serial   = "tout_hdf5_wr_gzip_serial.hdf5";
+    std::string tout_parallel = "tout_hdf5_wr_gzip_parallel.hdf5";
+
+    // sizes that leave partial edge chunks
+    index_t num_eles = 100003;
+
+    Node n;
+    n["vals_f64"].set(DataType::float64(num_eles));
+    n["vals_i32"].set(DataType::int32(num_eles));
+    n["vals_u8"].set(DataType::uint8(num_eles));
+    float64_array f64_vals = n["vals_f64"].value();
+    int32_array   i32_vals = n["vals_i32"].value();
+    uint8_array   u8_vals  = n["vals_u8"].value();
+    for(index_t i=0; i < num_eles; i++)
+    {
+        f64_vals[i] = sin(i * 0.001);
+        i32_vals[i] = (int32)(i % 1000);
+        u8_vals[i]  = (uint8)(i % 7);
+    }
+    // a strided (non compact) leaf
+    n["vals_f64_strided"].set_external(DataType::float64(num_eles/2,
+                                                         0,
+                                                         2 * sizeof(float64)),
+                                       n["vals_f64"].data_ptr());
+
+    Node opts;
+    opts["hdf5/chunking/threshold"]  = 1000;
+    opts["hdf5/chunking/chunk_size"] = 8000;
+
+    io::save(n,tout_serial, "hdf5", opts);
+
+    index_t orig_num_threads = conduit::execution::task::number_of_workers();
+    conduit::execution::task::set_number_of_threads(4);
+    opts["hdf5/chunking/compression/parallel"] = "true";
+    io::save(n,tout_parallel, "hdf5", opts);
+    conduit::execution::task::set_number_of_threads(orig_num_threads);
+
+    // the option only applies to this save
+    Node h5_opts;
+    io::hdf5_options(h5_opts);
+    EXPECT_EQ(h5_opts["chunking/compression/parallel"].as_string(),"false");
+
+    Node n_serial, n_parallel, info;
+    io::load(tout_serial, n_serial);
+    io::load(tout_parallel, n_parallel);
+
+    Node n_check;
+    n.compact_to(n_check);
+    EXPECT_FALSE(n_check.diff(n_serial,info));
+    EXPECT_FALSE(n_check.diff(n_parallel,info));
+
+    int64 serial_fs   = utils::file_size(tout_serial);
+    int64 parallel_fs = utils::file_size(tout_parallel);
+    CONDUIT_INFO("fs test: serial = "
+                 << serial_fs
+                 << ", parallel = "
+                 << parallel_fs);
+    EXPECT_TRUE(parallel_fs < (int64)n_check.total_bytes_compact());
+
+#if H5_VERSION_GE(1, 10, 5)
+    // both paths use the same deflate settings,
+    // so the stored chunks are byte for byte identical
+    NodeConstIterator itr = n.children();
+    while(itr.has_next())
+    {
+        itr.next();
+        std::string dset_path = itr.name();
+        std::vector<std::vector<uint8> > serial_chunks, parallel_chunks;
+        std::vector<unsigned int> serial_masks, parallel_masks;
+        hdf5_dataset_raw_chunks(tout_serial, dset_path,
+                                serial_chunks, serial_masks);
+        hdf5_dataset_raw_chunks(tout_parallel, dset_path,
+                                parallel_chunks, parallel_masks);
+        EXPECT_GT(serial_chunks.size(), 1u) << dset_path;
+        EXPECT_EQ(serial_masks, parallel_masks) << dset_path;
+        EXPECT_TRUE(serial_chunks == parallel_chunks) << dset_path;
+    }
+#endif
+
+    // make sure we aren't leaking
+    EXPECT_EQ(check_h5_open_ids(),DO_NO_HARM);
+}
+//
 //
+//-----------------------------------------------------------------------------
+// returns the chunk length of a (1D) dataset, or 0 if it is not chunked
+hsize_t
+hdf5_dataset_chunk_length(const std::string &file_path,
+                          const std::string &dset_path)
+{
+    hsize_t res = 0;
+    hid_t h5_file_id = H5Fopen(file_path.c_str(),
+                               H5F_ACC_RDONLY,
+                               H5P_DEFAULT);
+    hid_t h5_dset_id  = H5Dopen(h5_file_id, dset_path.c_str(), H5P_DEFAULT);
+    hid_t h5_plist_id = H5Dget_create_plist(h5_dset_id);
+
+    if(H5Pget_layout(h5_plist_id) == H5D_CHUNKED)
+    {
+        H5Pget_chunk(h5_plist_id, 1, &res);
+    }
+
+    H5Pclose(h5_plist_id);
+    H5Dclose(h5_dset_id);
+    H5Fclose(h5_file_id);
+    return res;
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_relay_io_hdf5, conduit_hdf5_chunk_shapes)
+{
+    // get objects in flight already
+    int DO_NO_HARM = check_h5_open_ids();
+
+    std::string tout_shapes = "tout_hdf5_chunk_shapes.hdf5";
+    std::string tout_no_bp  = "tout_hdf5_chunk_shapes_no_bp.hdf5";
+
+    Node n;
+    // uniform mesh with 100 x 60 elements
+    Node &n_uni = n["uni"];
+    n_uni["coordsets/coords/type"] = "uniform";
+    n_uni["coordsets/coords/dims/i"] = 101;
+    n_uni["coordsets/coords/dims/j"] = 61;
+    n_uni["topologies/mesh/type"] = "uniform";
+    n_uni["topologies/mesh/coordset"] = "coords";
+    n_uni["fields/ele/association"] = "element";
+    n_uni["fields/ele/topology"] = "mesh";
+    n_uni["fields/ele/values"].set(DataType::float64(100 * 60));
+    n_uni["fields/vert/association"] = "vertex";
+    n_uni["fields/vert/topology"] = "mesh";
+    n_uni["fields/vert/values"].set(DataType::float64(101 * 61));
+
+    // strided structured mesh with 100 x 36 elements, its fields are
+    // stored with 2 elements of padding on each side (104 x 40 values)
+    Node desc;
+    conduit::blueprint::mesh::examples::strided_structured(desc,
+                                                           101,
+                                                           37,
+                                                           0,
+                                                           n["str"]);
+
+    // leaves we provide shapes and chunk dims for
+    n["misc/shaped"].set(DataType::float64(50 * 120));
+    n["misc/explicit"].set(DataType::float64(50 * 120));
+    n["misc/plain"].set(DataType::float64(50 * 120));
+
+    Node opts;
+    opts["hdf5/chunking/threshold"]  = 1000;
+    opts["hdf5/chunking/chunk_size"] = 1100 * 8;
+    opts["hdf5/chunking/shapes/misc/shaped"].set(DataType::index_t(2));
+    opts["hdf5/chunking/chunk_dims/misc/explicit"].set(DataType::index_t(2));
+    index_t_array shaped_dims = opts["hdf5/chunking/shapes/misc/shaped"].value();
+    shaped_dims[0] = 50;
+    shaped_dims[1] = 120;
+    index_t_array chunk_dims = opts["hdf5/chunking/chunk_dims/misc/explicit"].value();
+    chunk_dims[0] = 4;
+    chunk_dims[1] = 100;
+
+    io::save(n, tout_shapes, "hdf5", opts);
+
+    // shape options only apply to this save
+    Node h5_opts;
+    io::hdf5_options(h5_opts);
+    EXPECT_EQ(h5_opts["chunking/shapes"].number_of_children(),0);
+    EXPECT_EQ(h5_opts["chunking/chunk_dims"].number_of_children(),0);
+    EXPECT_EQ(h5_opts["chunking/blueprint_shapes"].as_string(),"true");
+
+    // 10 whole rows of 100, (11 rows would straddle the 60 rows)
+    EXPECT_EQ(hdf5_dataset_chunk_length(tout_shapes,"uni/fields/ele/values"),
+              1000);
+    // 10 whole rows of 101, (61 rows has no nearby divisor)
+    EXPECT_EQ(hdf5_dataset_chunk_length(tout_shapes,"uni/fields/vert/values"),
+              1010);
+    // 10 whole padded rows of 104, (which evenly divides the 40 rows)
+    EXPECT_EQ(hdf5_dataset_chunk_length(tout_shapes,"str/fields/ele_vals/values"),
+              1040);
+    EXPECT_EQ(hdf5_dataset_chunk_length(tout_shapes,"str/fields/vert_vals/values"),
+              1040);
+    // 5 whole rows of 120, which evenly divides the 50 rows
+    EXPECT_EQ(hdf5_dataset_chunk_length(tout_shapes,"misc/shaped"),
+              600);
+    EXPECT_EQ(hdf5_dataset_chunk_length(tout_shapes,"misc/explicit"),
+              400);
+    EXPECT_EQ(hdf5_dataset_chunk_length(tout_shapes,"misc/plain"),
+              1100);
+
+    Node n_load, info;
+    io::load(tout_shapes, n_load);
+    EXPECT_FALSE(n.diff(n_load,info));
+
+    // turn off blueprint detection
+    opts["hdf5/chunking/blueprint_shapes"] = "false";
+    io::save(n, tout_no_bp, "hdf5", opts);
+
+    EXPECT_EQ(hdf5_dataset_chunk_length(tout_no_bp,"uni/fields/ele/values"),
+              1100);
+    EXPECT_EQ(hdf5_dataset_chunk_length(tout_no_bp,"str/fields/ele_vals/values"),
+              1100);
+    EXPECT_EQ(hdf5_dataset_chunk_length(tout_no_bp,"misc/shaped"),
+              600);
+
+    // bad dims
+    Node bad_opts;
+    bad_opts["chunking/chunk_dims/misc/explicit"] = -1;
+    EXPECT_THROW(io::hdf5_set_options(bad_opts),
+                 conduit::Error);
+    bad_opts.reset();
+    bad_opts["chunking/shapes/misc/shaped"] = "50x120";
+    EXPECT_THROW(io::hdf5_set_options(bad_opts),
+                 conduit::Error);
+    io::hdf5_set_options(h5_opts);
+
+    // make sure we aren't leaking
+    EXPECT_EQ(check_h5_open_ids(),DO_NO_HARM);
+}
+
 //-----------------------------------------------------------------------------
 TEST(conduit_relay_io_hdf5, conduit_hdf5_list)
 {
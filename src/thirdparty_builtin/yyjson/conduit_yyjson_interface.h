@@ -95,7 +95,10 @@ public:
     }
     bool IsInt64() const
     {
-        return yyjson_is_sint(value);
+        // like rapidjson, unsigned values that fit are also int64s
+        return yyjson_is_sint(value) ||
+               (yyjson_is_uint(value) &&
+                yyjson_get_uint(value) <= (uint64_t)INT64_MAX);
     }
     bool IsUint() const
     {
@@ -103,7 +106,9 @@ public:
     }
     bool IsInt() const
     {
-        return yyjson_is_int(value);
+        return IsInt64() &&
+               yyjson_get_sint(value) >= INT32_MIN &&
+               yyjson_get_sint(value) <= INT32_MAX;
     }
     bool IsDouble() const
     {
@@ -151,7 +156,8 @@ public:
     }
     double GetDouble() const
     {
-        return yyjson_get_real(value);
+        // like rapidjson, integers convert to double
+        return yyjson_get_num(value);
     }
     bool GetBool() const
     {